@@ -0,0 +1,222 @@
+#include "Commands/EpicUnrealMCPActorFilter.h"
+#include "Commands/EpicUnrealMCPJsonReaders.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+#if UE_ENABLE_ICU
+THIRD_PARTY_INCLUDES_START
+#include <unicode/regex.h>
+THIRD_PARTY_INCLUDES_END
+#endif
+
+namespace
+{
+	// FRegexMatcher dereferences the compiled pattern without checking it, so a pattern ICU rejects
+	// has to be caught here rather than when the first actor is matched
+	bool IsValidRegex(const FString& RegexString, FString& OutError)
+	{
+#if UE_ENABLE_ICU
+		UErrorCode Status = U_ZERO_ERROR;
+		UParseError ParseError;
+		const icu::UnicodeString ICUString = icu::UnicodeString::fromUTF8(TCHAR_TO_UTF8(*RegexString));
+		TUniquePtr<icu::RegexPattern> Compiled(icu::RegexPattern::compile(ICUString, 0, ParseError, Status));
+		if (U_FAILURE(Status) || !Compiled)
+		{
+			OutError = FString::Printf(TEXT("Invalid regex '%s': %s at offset %d"), *RegexString, UTF8_TO_TCHAR(u_errorName(Status)), ParseError.offset);
+			return false;
+		}
+#endif
+		return true;
+	}
+}
+
+FEpicUnrealMCPActorFilter::FEpicUnrealMCPActorFilter()
+	: MatchMode(EMatchMode::Contains)
+	, MatchField(EMatchField::Name)
+	, SearchCase(ESearchCase::CaseSensitive)
+	, ClassFilter(nullptr)
+	, bHasBounds(false)
+	, Bounds(ForceInit)
+	, MaxResults(0)
+{
+}
+
+bool FEpicUnrealMCPActorFilter::Compile(const TSharedPtr<FJsonObject>& Params, FString& OutError)
+{
+	if (!Params.IsValid())
+	{
+		return true;
+	}
+
+	Params->TryGetStringField(TEXT("pattern"), Pattern);
+
+	FString ModeString;
+	if (Params->TryGetStringField(TEXT("match_mode"), ModeString))
+	{
+		if (ModeString == TEXT("contains")) MatchMode = EMatchMode::Contains;
+		else if (ModeString == TEXT("exact")) MatchMode = EMatchMode::Exact;
+		else if (ModeString == TEXT("glob")) MatchMode = EMatchMode::Glob;
+		else if (ModeString == TEXT("regex")) MatchMode = EMatchMode::Regex;
+		else
+		{
+			OutError = FString::Printf(TEXT("Unknown match_mode: %s"), *ModeString);
+			return false;
+		}
+	}
+
+	bool bCaseSensitive = true;
+	Params->TryGetBoolField(TEXT("case_sensitive"), bCaseSensitive);
+	SearchCase = bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+
+	FString FieldString;
+	if (Params->TryGetStringField(TEXT("match_field"), FieldString))
+	{
+		if (FieldString == TEXT("name")) MatchField = EMatchField::Name;
+		else if (FieldString == TEXT("label")) MatchField = EMatchField::Label;
+		else if (FieldString == TEXT("either")) MatchField = EMatchField::Either;
+		else
+		{
+			OutError = FString::Printf(TEXT("Unknown match_field: %s"), *FieldString);
+			return false;
+		}
+	}
+
+	if (MatchMode == EMatchMode::Regex && !Pattern.IsEmpty())
+	{
+		// ICU inline flag; avoids depending on pattern flag enums that differ between engine versions
+		const FString RegexString = bCaseSensitive ? Pattern : TEXT("(?i)") + Pattern;
+		if (!IsValidRegex(RegexString, OutError))
+		{
+			return false;
+		}
+		RegexPattern.Emplace(RegexString);
+	}
+
+	FString ClassName;
+	if (Params->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+	{
+		if (ClassName.Contains(TEXT("/")))
+		{
+			ClassFilter = LoadObject<UClass>(nullptr, *ClassName);
+		}
+		else
+		{
+			ClassFilter = FindObject<UClass>(ANY_PACKAGE, *ClassName);
+		}
+
+		if (!ClassFilter || !ClassFilter->IsChildOf(AActor::StaticClass()))
+		{
+			OutError = FString::Printf(TEXT("Unknown actor class: %s"), *ClassName);
+			return false;
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* TagArray;
+	if (Params->TryGetArrayField(TEXT("tags"), TagArray))
+	{
+		for (const TSharedPtr<FJsonValue>& TagValue : *TagArray)
+		{
+			RequiredTags.Add(FName(*TagValue->AsString()));
+		}
+	}
+
+	if (Params->TryGetStringField(TEXT("folder"), Folder))
+	{
+		Folder.RemoveFromEnd(TEXT("/"));
+	}
+
+	FVector BoundsMin, BoundsMax;
+	const bool bHasMin = EpicUnrealMCPJsonReaders::TryReadVector(Params, TEXT("bounds_min"), BoundsMin);
+	const bool bHasMax = EpicUnrealMCPJsonReaders::TryReadVector(Params, TEXT("bounds_max"), BoundsMax);
+	if (bHasMin != bHasMax)
+	{
+		OutError = TEXT("'bounds_min' and 'bounds_max' must be given together");
+		return false;
+	}
+	if (bHasMin)
+	{
+		Bounds = FBox(BoundsMin.ComponentMin(BoundsMax), BoundsMin.ComponentMax(BoundsMax));
+		bHasBounds = true;
+	}
+
+	Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+	MaxResults = FMath::Max(MaxResults, 0);
+
+	return true;
+}
+
+bool FEpicUnrealMCPActorFilter::IsEmpty() const
+{
+	return Pattern.IsEmpty() && !ClassFilter && RequiredTags.Num() == 0 && Folder.IsEmpty() && !bHasBounds;
+}
+
+bool FEpicUnrealMCPActorFilter::MatchesString(const FString& Candidate) const
+{
+	switch (MatchMode)
+	{
+	case EMatchMode::Exact:
+		return Candidate.Equals(Pattern, SearchCase);
+	case EMatchMode::Glob:
+		return Candidate.MatchesWildcard(Pattern, SearchCase);
+	case EMatchMode::Regex:
+	{
+		FRegexMatcher Matcher(RegexPattern.GetValue(), Candidate);
+		return Matcher.FindNext();
+	}
+	case EMatchMode::Contains:
+	default:
+		return Candidate.Contains(Pattern, SearchCase);
+	}
+}
+
+bool FEpicUnrealMCPActorFilter::Matches(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	if (ClassFilter && !Actor->IsA(ClassFilter))
+	{
+		return false;
+	}
+
+	for (const FName& Tag : RequiredTags)
+	{
+		if (!Actor->ActorHasTag(Tag))
+		{
+			return false;
+		}
+	}
+
+	if (!Folder.IsEmpty())
+	{
+		const FString ActorFolder = Actor->GetFolderPath().ToString();
+		if (!ActorFolder.Equals(Folder, ESearchCase::IgnoreCase) &&
+			!ActorFolder.StartsWith(Folder + TEXT("/"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+	}
+
+	if (bHasBounds && !Bounds.IsInsideOrOn(Actor->GetActorLocation()))
+	{
+		return false;
+	}
+
+	if (Pattern.IsEmpty())
+	{
+		return true;
+	}
+
+	switch (MatchField)
+	{
+	case EMatchField::Label:
+		return MatchesString(Actor->GetActorLabel());
+	case EMatchField::Either:
+		return MatchesString(Actor->GetName()) || MatchesString(Actor->GetActorLabel());
+	case EMatchField::Name:
+	default:
+		return MatchesString(Actor->GetName());
+	}
+}
@@ -0,0 +1,282 @@
+#include "Commands/EpicUnrealMCPActorIndex.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+
+FEpicUnrealMCPActorIndex::FEpicUnrealMCPActorIndex()
+	: bDirty(true)
+	, bDelegatesBound(false)
+{
+}
+
+FEpicUnrealMCPActorIndex::~FEpicUnrealMCPActorIndex()
+{
+	UnbindDelegates();
+}
+
+void FEpicUnrealMCPActorIndex::BindDelegates()
+{
+	// GEngine does not exist yet when the module starts up, so delegates are bound on first use
+	if (bDelegatesBound || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorDeleted);
+	ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorListChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FEpicUnrealMCPActorIndex::OnMapChange);
+	PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FEpicUnrealMCPActorIndex::OnPostUndoRedo);
+	bDelegatesBound = true;
+}
+
+void FEpicUnrealMCPActorIndex::UnbindDelegates()
+{
+	if (!bDelegatesBound)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+	bDelegatesBound = false;
+}
+
+UWorld* FEpicUnrealMCPActorIndex::GetWorld()
+{
+	EnsureUpToDate();
+	return IndexedWorld.Get();
+}
+
+void FEpicUnrealMCPActorIndex::EnsureUpToDate()
+{
+	BindDelegates();
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (bDirty || World != IndexedWorld.Get())
+	{
+		Rebuild(World);
+	}
+}
+
+void FEpicUnrealMCPActorIndex::Rebuild(UWorld* World)
+{
+	Actors.Reset();
+	KeyToSlot.Reset();
+	NameToLevels.Reset();
+	IndexedWorld = World;
+	bDirty = false;
+
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AddActor(*It);
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("FEpicUnrealMCPActorIndex: Rebuilt index with %d actors"), Actors.Num());
+}
+
+void FEpicUnrealMCPActorIndex::AddActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	const FName LevelName = GetLevelName(Actor);
+	const FName Name = Actor->GetFName();
+	if (int32* ExistingSlot = KeyToSlot.Find(TPair<FName, FName>(LevelName, Name)))
+	{
+		Actors[*ExistingSlot] = Actor;
+		return;
+	}
+
+	KeyToSlot.Add(TPair<FName, FName>(LevelName, Name), Actors.Add(Actor));
+	NameToLevels.Add(Name, LevelName);
+}
+
+void FEpicUnrealMCPActorIndex::RemoveActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	const FName LevelName = GetLevelName(Actor);
+	int32 Slot = INDEX_NONE;
+	if (!KeyToSlot.RemoveAndCopyValue(TPair<FName, FName>(LevelName, Actor->GetFName()), Slot))
+	{
+		return;
+	}
+	NameToLevels.RemoveSingle(Actor->GetFName(), LevelName);
+
+	// Swap-remove and patch the slot of whichever entry moved into the hole
+	const int32 LastSlot = Actors.Num() - 1;
+	if (Slot != LastSlot)
+	{
+		Actors[Slot] = Actors[LastSlot];
+		if (AActor* Moved = Actors[Slot].Get())
+		{
+			KeyToSlot.Add(TPair<FName, FName>(GetLevelName(Moved), Moved->GetFName()), Slot);
+		}
+		else
+		{
+			// A stale entry moved; simplest to rebuild lazily
+			bDirty = true;
+		}
+	}
+	Actors.RemoveAt(LastSlot, 1, false);
+}
+
+AActor* FEpicUnrealMCPActorIndex::FindByName(const FString& ActorName)
+{
+	// Object names cannot contain ':', so this can only be a path name
+	if (ActorName.Contains(TEXT(":")))
+	{
+		AActor* Actor = FindObject<AActor>(nullptr, *ActorName);
+		return IsValid(Actor) && Actor->GetWorld() == GetWorld() ? Actor : nullptr;
+	}
+	return FindByName(FName(*ActorName, FNAME_Find));
+}
+
+AActor* FEpicUnrealMCPActorIndex::FindByName(FName ActorName)
+{
+	// FNAME_Find yields NAME_None for strings that were never interned, so no actor can have that name
+	if (ActorName.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (AActor* Actor = Find(NAME_None, ActorName))
+	{
+		return Actor;
+	}
+
+	TArray<FName, TInlineAllocator<4>> LevelNames;
+	NameToLevels.MultiFind(ActorName, LevelNames);
+	for (FName LevelName : LevelNames)
+	{
+		if (AActor* Actor = Find(LevelName, ActorName))
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+
+AActor* FEpicUnrealMCPActorIndex::Find(FName LevelName, FName ActorName)
+{
+	if (ActorName.IsNone())
+	{
+		return nullptr;
+	}
+
+	EnsureUpToDate();
+
+	const int32* Slot = KeyToSlot.Find(TPair<FName, FName>(LevelName, ActorName));
+	if (!Slot)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = Actors[*Slot].Get();
+	if (!IsValid(Actor) || Actor->GetFName() != ActorName)
+	{
+		// Renamed or destroyed behind our back
+		bDirty = true;
+		return nullptr;
+	}
+	return Actor;
+}
+
+FName FEpicUnrealMCPActorIndex::GetLevelName(const ULevel* Level)
+{
+	if (!Level || Level->IsPersistentLevel())
+	{
+		return NAME_None;
+	}
+	return FPackageName::GetShortFName(Level->GetOutermost()->GetFName());
+}
+
+FName FEpicUnrealMCPActorIndex::GetLevelName(const AActor* Actor)
+{
+	return GetLevelName(Actor->GetLevel());
+}
+
+const TArray<TWeakObjectPtr<AActor>>& FEpicUnrealMCPActorIndex::GetActors()
+{
+	EnsureUpToDate();
+	return Actors;
+}
+
+int32 FEpicUnrealMCPActorIndex::Num()
+{
+	EnsureUpToDate();
+	return Actors.Num();
+}
+
+void FEpicUnrealMCPActorIndex::NotifyActorRenamed(AActor* Actor, FName OldName)
+{
+	if (bDirty || !Actor)
+	{
+		return;
+	}
+
+	const FName LevelName = GetLevelName(Actor);
+	int32 Slot = INDEX_NONE;
+	if (KeyToSlot.RemoveAndCopyValue(TPair<FName, FName>(LevelName, OldName), Slot))
+	{
+		KeyToSlot.Add(TPair<FName, FName>(LevelName, Actor->GetFName()), Slot);
+		NameToLevels.RemoveSingle(OldName, LevelName);
+		NameToLevels.Add(Actor->GetFName(), LevelName);
+	}
+	else
+	{
+		bDirty = true;
+	}
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorAdded(AActor* Actor)
+{
+	if (!bDirty && Actor && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		AddActor(Actor);
+	}
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorDeleted(AActor* Actor)
+{
+	if (!bDirty && Actor && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		RemoveActor(Actor);
+	}
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorListChanged()
+{
+	bDirty = true;
+}
+
+void FEpicUnrealMCPActorIndex::OnMapChange(uint32 MapChangeFlags)
+{
+	bDirty = true;
+}
+
+void FEpicUnrealMCPActorIndex::OnPostUndoRedo()
+{
+	bDirty = true;
+}
@@ -0,0 +1,157 @@
+#include "Commands/EpicUnrealMCPAssetCache.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "UObject/PackageReload.h"
+#include "UObject/UObjectGlobals.h"
+
+FEpicUnrealMCPAssetCache::FEpicUnrealMCPAssetCache()
+	: bDelegatesBound(false)
+	, Hits(0)
+	, Misses(0)
+	, LoadFailures(0)
+	, Invalidations(0)
+{
+}
+
+FEpicUnrealMCPAssetCache::~FEpicUnrealMCPAssetCache()
+{
+	UnbindDelegates();
+}
+
+void FEpicUnrealMCPAssetCache::BindDelegates()
+{
+	if (bDelegatesBound)
+	{
+		return;
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRenamedHandle = AssetRegistryModule.Get().OnAssetRenamed().AddRaw(this, &FEpicUnrealMCPAssetCache::OnAssetRenamed);
+	PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FEpicUnrealMCPAssetCache::OnPackageReloaded);
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FEpicUnrealMCPAssetCache::OnObjectsReplaced);
+	bDelegatesBound = true;
+}
+
+void FEpicUnrealMCPAssetCache::UnbindDelegates()
+{
+	if (!bDelegatesBound)
+	{
+		return;
+	}
+
+	// The asset registry may already be gone during shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	bDelegatesBound = false;
+}
+
+UObject* FEpicUnrealMCPAssetCache::LoadObjectCached(const FString& AssetPath, UClass* AssetClass)
+{
+	if (AssetPath.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	BindDelegates();
+
+	if (TWeakObjectPtr<UObject>* Cached = Entries.Find(AssetPath))
+	{
+		UObject* Object = Cached->Get();
+		if (Object && Object->IsA(AssetClass))
+		{
+			++Hits;
+			return Object;
+		}
+	}
+
+	++Misses;
+	UObject* Object = StaticLoadObject(AssetClass, nullptr, *AssetPath);
+	if (!Object)
+	{
+		++LoadFailures;
+		Entries.Remove(AssetPath);
+		return nullptr;
+	}
+
+	Entries.Add(AssetPath, Object);
+	return Object;
+}
+
+UClass* FEpicUnrealMCPAssetCache::LoadBlueprintClass(const FString& BlueprintPath, UClass* BaseClass)
+{
+	FString ClassPath = BlueprintPath;
+	if (!ClassPath.EndsWith(TEXT("_C")))
+	{
+		ClassPath += TEXT("_C");
+	}
+
+	UClass* Class = Load<UClass>(ClassPath);
+	return Class && Class->IsChildOf(BaseClass) ? Class : nullptr;
+}
+
+TSharedPtr<FStreamableHandle> FEpicUnrealMCPAssetCache::RequestAsyncLoad(const TArray<FSoftObjectPath>& Paths, FStreamableDelegate OnLoaded)
+{
+	BindDelegates();
+	return StreamableManager.RequestAsyncLoad(Paths, MoveTemp(OnLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void FEpicUnrealMCPAssetCache::Reset()
+{
+	Invalidations += Entries.Num();
+	Entries.Reset();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCache::GetStatsJson() const
+{
+	const uint64 Lookups = Hits + Misses;
+
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetNumberField(TEXT("entries"), Entries.Num());
+	Stats->SetNumberField(TEXT("hits"), Hits);
+	Stats->SetNumberField(TEXT("misses"), Misses);
+	Stats->SetNumberField(TEXT("load_failures"), LoadFailures);
+	Stats->SetNumberField(TEXT("invalidations"), Invalidations);
+	Stats->SetNumberField(TEXT("hit_rate"), Lookups > 0 ? double(Hits) / double(Lookups) : 0.0);
+	return Stats;
+}
+
+void FEpicUnrealMCPAssetCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	// Keys can be package paths, object paths or "_C" class paths, so match the old package itself or
+	// anything inside it; a bare prefix would also drop siblings such as "/Game/Door" vs "/Game/Door_Old"
+	const FString OldPackageName = FPackageName::ObjectPathToPackageName(OldObjectPath);
+	const FString OldPackagePrefix = OldPackageName + TEXT(".");
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() == OldPackageName || It.Key().StartsWith(OldPackagePrefix))
+		{
+			It.RemoveCurrent();
+			++Invalidations;
+		}
+	}
+}
+
+void FEpicUnrealMCPAssetCache::OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+	if (Phase == EPackageReloadPhase::PostPackageFixup)
+	{
+		Reset();
+	}
+}
+
+void FEpicUnrealMCPAssetCache::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	for (TPair<FString, TWeakObjectPtr<UObject>>& Entry : Entries)
+	{
+		if (UObject* const* Replacement = ReplacementMap.Find(Entry.Value.Get()))
+		{
+			Entry.Value = *Replacement;
+			++Invalidations;
+		}
+	}
+}
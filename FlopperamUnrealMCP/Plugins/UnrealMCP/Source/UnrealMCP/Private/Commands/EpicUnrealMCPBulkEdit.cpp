@@ -0,0 +1,413 @@
+#include "Commands/EpicUnrealMCPBulkEdit.h"
+#include "Editor.h"
+#include "EditorViewportClient.h"
+#include "LevelEditorViewport.h"
+#include "Engine/Selection.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#define LOCTEXT_NAMESPACE "EpicUnrealMCPBulkEdit"
+
+namespace
+{
+	// Sees key presses and clicks before any widget does, so the user's edit that follows lands in its own transaction
+	class FUserInputWatcher : public IInputProcessor
+	{
+	public:
+		explicit FUserInputWatcher(TFunction<void()>&& InOnUserInput)
+			: OnUserInput(MoveTemp(InOnUserInput))
+		{
+		}
+
+		virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override
+		{
+		}
+
+		virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override
+		{
+			OnUserInput();
+			return false;
+		}
+
+		virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+		{
+			OnUserInput();
+			return false;
+		}
+
+	private:
+		TFunction<void()> OnUserInput;
+	};
+}
+
+FEpicUnrealMCPBulkEdit::FEpicUnrealMCPBulkEdit()
+	: Depth(0)
+	, bExplicit(false)
+	, bNoUndoScope(false)
+	, bOwnsTransaction(false)
+	, bRecordingStopped(false)
+	, ExplicitDeadline(0.0)
+	, bRedrawRequested(false)
+	, LastFlushProperties(0)
+	, LastFlushMoves(0)
+	, LastFlushPackages(0)
+	, LastFlushSeconds(0.0)
+	, NumScopes(0)
+	, NumDeferred(0)
+	, NumCoalesced(0)
+{
+}
+
+FEpicUnrealMCPBulkEdit::~FEpicUnrealMCPBulkEdit()
+{
+	// A scope still open at shutdown is flushed and its transaction closed, or the editor would keep it open
+	if (bExplicit)
+	{
+		EndExplicit();
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FEpicUnrealMCPBulkEdit::Begin()
+{
+	if (Depth++ > 0)
+	{
+		return;
+	}
+
+	++NumScopes;
+	if (GEditor)
+	{
+		GEditor->GetSelectedActors()->BeginBatchSelectOperation();
+	}
+}
+
+void FEpicUnrealMCPBulkEdit::End()
+{
+	if (!ensure(Depth > 0) || --Depth > 0)
+	{
+		return;
+	}
+
+	Flush();
+
+	if (GEditor)
+	{
+		GEditor->GetSelectedActors()->EndBatchSelectOperation(false);
+	}
+}
+
+void FEpicUnrealMCPBulkEdit::BeginExplicit(float TimeoutSeconds, bool bTransact)
+{
+	ExplicitDeadline = FPlatformTime::Seconds() + (TimeoutSeconds > 0.0f ? TimeoutSeconds : 60.0f);
+	if (bExplicit)
+	{
+		return;
+	}
+
+	bExplicit = true;
+	bNoUndoScope = !bTransact;
+	bRecordingStopped = false;
+	Begin();
+
+	// Per-request transactions opened while this one is active merge into it
+	if (bTransact && GEditor)
+	{
+		GEditor->BeginTransaction(TEXT("UnrealMCP"), LOCTEXT("BulkEditTransaction", "MCP Bulk Edit"), nullptr);
+		bOwnsTransaction = true;
+
+		// Requests run to completion within one tick, so input can only arrive between them.
+		// The watcher stays registered until the scope ends; Slate is iterating it when it fires.
+		if (FSlateApplication::IsInitialized())
+		{
+			InputWatcher = MakeShared<FUserInputWatcher>([this]()
+			{
+				if (bOwnsTransaction)
+				{
+					UE_LOG(LogTemp, Log, TEXT("UnrealMCP: Editor input during a bulk edit, closing its undo transaction"));
+					bRecordingStopped = true;
+					StopRecording();
+				}
+			});
+			FSlateApplication::Get().RegisterInputPreProcessor(InputWatcher);
+		}
+	}
+
+	// Nothing is visible mid-edit anyway, so stop the level viewports rendering every frame
+	if (GEditor)
+	{
+		for (FLevelEditorViewportClient* ViewportClient : GEditor->GetLevelViewportClients())
+		{
+			if (ViewportClient)
+			{
+				ViewportClient->AddRealtimeOverride(false, LOCTEXT("BulkEditRealtimeOverride", "MCP Bulk Edit"));
+				RealtimeOverrides.Add(ViewportClient);
+			}
+		}
+	}
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEpicUnrealMCPBulkEdit::OnTick), 1.0f);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBulkEdit::EndExplicit()
+{
+	if (!bExplicit)
+	{
+		return nullptr;
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Viewports closed during the scope took their override with them
+	if (GEditor)
+	{
+		const TArray<FLevelEditorViewportClient*>& LiveClients = GEditor->GetLevelViewportClients();
+		for (FLevelEditorViewportClient* ViewportClient : RealtimeOverrides)
+		{
+			if (LiveClients.Contains(ViewportClient))
+			{
+				ViewportClient->RemoveRealtimeOverride(LOCTEXT("BulkEditRealtimeOverride", "MCP Bulk Edit"), false);
+			}
+		}
+	}
+	RealtimeOverrides.Reset();
+
+	bRedrawRequested = true;
+	End();
+
+	// Flushed notifications still belong to the transaction, so it closes last
+	StopRecording();
+	if (InputWatcher.IsValid())
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().UnregisterInputPreProcessor(InputWatcher);
+		}
+		InputWatcher.Reset();
+	}
+	bExplicit = false;
+	bNoUndoScope = false;
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("properties"), LastFlushProperties);
+	Result->SetNumberField(TEXT("moved"), LastFlushMoves);
+	Result->SetNumberField(TEXT("packages"), LastFlushPackages);
+	Result->SetNumberField(TEXT("flush_ms"), LastFlushSeconds * 1000.0);
+	Result->SetBoolField(TEXT("still_active"), IsActive());
+	Result->SetBoolField(TEXT("recording_stopped"), bRecordingStopped);
+	return Result;
+}
+
+void FEpicUnrealMCPBulkEdit::StopRecording()
+{
+	if (bOwnsTransaction && GEditor)
+	{
+		GEditor->EndTransaction();
+	}
+	bOwnsTransaction = false;
+}
+
+bool FEpicUnrealMCPBulkEdit::OnTick(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() < ExplicitDeadline)
+	{
+		return true;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Bulk edit was not ended in time, flushing"));
+
+	// Returning false removes the ticker, so EndExplicit must not remove it again
+	TickerHandle.Reset();
+	EndExplicit();
+	return false;
+}
+
+void FEpicUnrealMCPBulkEdit::NotifyPropertyChanged(UObject* Object, FProperty* Property)
+{
+	if (!Object || !Property)
+	{
+		return;
+	}
+
+	if (!IsActive())
+	{
+		FPropertyChangedEvent PropertyChangedEvent(Property);
+		Object->PostEditChangeProperty(PropertyChangedEvent);
+		return;
+	}
+
+	FPendingProperty Pending;
+	Pending.Owner = Property->GetOwnerStruct();
+	Pending.Name = Property->GetFName();
+
+	TArray<FPendingProperty>& Properties = ChangedProperties.FindOrAdd(Object);
+	if (Properties.Contains(Pending))
+	{
+		++NumCoalesced;
+		return;
+	}
+	Properties.Add(Pending);
+	++NumDeferred;
+}
+
+void FEpicUnrealMCPBulkEdit::NotifyActorMoved(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (!IsActive())
+	{
+		Actor->PostEditMove(true);
+		return;
+	}
+
+	bool bAlreadyMoved = false;
+	MovedActors.Add(Actor, &bAlreadyMoved);
+	if (bAlreadyMoved)
+	{
+		++NumCoalesced;
+	}
+	else
+	{
+		++NumDeferred;
+	}
+}
+
+void FEpicUnrealMCPBulkEdit::NotifyPackageDirty(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	if (!IsActive())
+	{
+		Object->MarkPackageDirty();
+		return;
+	}
+
+	bool bAlreadyDirty = false;
+	DirtyPackages.Add(Object->GetOutermost(), &bAlreadyDirty);
+	if (bAlreadyDirty)
+	{
+		++NumCoalesced;
+	}
+	else
+	{
+		++NumDeferred;
+	}
+}
+
+void FEpicUnrealMCPBulkEdit::RequestRedraw()
+{
+	if (!IsActive())
+	{
+		if (GEditor)
+		{
+			GEditor->RedrawLevelEditingViewports();
+		}
+		return;
+	}
+
+	if (bRedrawRequested)
+	{
+		++NumCoalesced;
+	}
+	else
+	{
+		++NumDeferred;
+	}
+	bRedrawRequested = true;
+}
+
+void FEpicUnrealMCPBulkEdit::Flush()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	LastFlushProperties = 0;
+	for (const TPair<TWeakObjectPtr<UObject>, TArray<FPendingProperty>>& Entry : ChangedProperties)
+	{
+		UObject* Object = Entry.Key.Get();
+		if (!Object)
+		{
+			continue;
+		}
+		for (const FPendingProperty& Pending : Entry.Value)
+		{
+			// Properties removed since they were written have nothing left to notify
+			UStruct* Owner = Pending.Owner.Get();
+			FProperty* Property = Owner ? FindFProperty<FProperty>(Owner, Pending.Name) : nullptr;
+			if (!Property)
+			{
+				continue;
+			}
+
+			FPropertyChangedEvent PropertyChangedEvent(Property);
+			Object->PostEditChangeProperty(PropertyChangedEvent);
+			++LastFlushProperties;
+		}
+	}
+	ChangedProperties.Reset();
+
+	LastFlushMoves = 0;
+	for (const TWeakObjectPtr<AActor>& ActorPtr : MovedActors)
+	{
+		if (AActor* Actor = ActorPtr.Get())
+		{
+			Actor->PostEditMove(true);
+			++LastFlushMoves;
+		}
+	}
+	MovedActors.Reset();
+
+	LastFlushPackages = 0;
+	for (const TWeakObjectPtr<UPackage>& PackagePtr : DirtyPackages)
+	{
+		if (UPackage* Package = PackagePtr.Get())
+		{
+			Package->MarkPackageDirty();
+			++LastFlushPackages;
+		}
+	}
+	DirtyPackages.Reset();
+
+	if ((bRedrawRequested || LastFlushMoves > 0 || LastFlushProperties > 0) && GEditor)
+	{
+		GEditor->RedrawLevelEditingViewports();
+	}
+	bRedrawRequested = false;
+
+	LastFlushSeconds = FPlatformTime::Seconds() - StartTime;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBulkEdit::GetStatsJson() const
+{
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetBoolField(TEXT("active"), IsActive());
+	Stats->SetBoolField(TEXT("explicit"), bExplicit);
+	Stats->SetBoolField(TEXT("no_undo"), IsNoUndo());
+	Stats->SetBoolField(TEXT("recording"), IsTransacting());
+	Stats->SetNumberField(TEXT("pending_properties"), ChangedProperties.Num());
+	Stats->SetNumberField(TEXT("pending_moves"), MovedActors.Num());
+	Stats->SetNumberField(TEXT("pending_packages"), DirtyPackages.Num());
+	Stats->SetNumberField(TEXT("scopes"), NumScopes);
+	Stats->SetNumberField(TEXT("deferred"), NumDeferred);
+	Stats->SetNumberField(TEXT("coalesced"), NumCoalesced);
+	Stats->SetNumberField(TEXT("last_flush_ms"), LastFlushSeconds * 1000.0);
+	return Stats;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,97 @@
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+#include "Editor.h"
+#include "Misc/HotReloadInterface.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPCacheStats::ToJson(int32 NumEntries) const
+{
+	const uint64 Lookups = Hits + Misses;
+
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetNumberField(TEXT("entries"), NumEntries);
+	Stats->SetNumberField(TEXT("hits"), Hits);
+	Stats->SetNumberField(TEXT("misses"), Misses);
+	Stats->SetNumberField(TEXT("invalidations"), Invalidations);
+	Stats->SetNumberField(TEXT("hit_rate"), Lookups > 0 ? double(Hits) / double(Lookups) : 0.0);
+	return Stats;
+}
+
+FEpicUnrealMCPCacheInvalidation::FEpicUnrealMCPCacheInvalidation()
+	: bDelegatesBound(false)
+{
+}
+
+FEpicUnrealMCPCacheInvalidation::~FEpicUnrealMCPCacheInvalidation()
+{
+	UnbindDelegates();
+}
+
+FDelegateHandle FEpicUnrealMCPCacheInvalidation::Register(FSimpleDelegate Callback)
+{
+	return OnInvalidate.Add(MoveTemp(Callback));
+}
+
+void FEpicUnrealMCPCacheInvalidation::Unregister(FDelegateHandle Handle)
+{
+	OnInvalidate.Remove(Handle);
+}
+
+void FEpicUnrealMCPCacheInvalidation::BindDelegates()
+{
+	if (bDelegatesBound || !GEditor)
+	{
+		return;
+	}
+
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FEpicUnrealMCPCacheInvalidation::OnObjectsReplaced);
+	BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FEpicUnrealMCPCacheInvalidation::OnBlueprintCompiled);
+	if (IHotReloadInterface* HotReload = FModuleManager::GetModulePtr<IHotReloadInterface>(TEXT("HotReload")))
+	{
+		HotReloadHandle = HotReload->OnHotReload().AddRaw(this, &FEpicUnrealMCPCacheInvalidation::OnHotReload);
+	}
+	bDelegatesBound = true;
+}
+
+void FEpicUnrealMCPCacheInvalidation::UnbindDelegates()
+{
+	if (!bDelegatesBound)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	if (IHotReloadInterface* HotReload = FModuleManager::GetModulePtr<IHotReloadInterface>(TEXT("HotReload")))
+	{
+		HotReload->OnHotReload().Remove(HotReloadHandle);
+	}
+	bDelegatesBound = false;
+}
+
+void FEpicUnrealMCPCacheInvalidation::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	OnInvalidate.Broadcast();
+}
+
+void FEpicUnrealMCPCacheInvalidation::OnBlueprintCompiled()
+{
+	OnInvalidate.Broadcast();
+}
+
+void FEpicUnrealMCPCacheInvalidation::OnHotReload(bool bWasTriggeredAutomatically)
+{
+	OnInvalidate.Broadcast();
+}
+
+void FEpicUnrealMCPCacheInvalidation::PreChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType)
+{
+}
+
+void FEpicUnrealMCPCacheInvalidation::PostChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType)
+{
+	OnInvalidate.Broadcast();
+}
@@ -0,0 +1,162 @@
+#include "Commands/EpicUnrealMCPComponentIndex.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UnrealType.h"
+
+FEpicUnrealMCPComponentIndex::FEpicUnrealMCPComponentIndex(FEpicUnrealMCPCacheInvalidation& InInvalidation)
+	: SweepThreshold(64)
+	, Invalidation(InInvalidation)
+{
+	InvalidationHandle = Invalidation.Register(FSimpleDelegate::CreateRaw(this, &FEpicUnrealMCPComponentIndex::Reset));
+}
+
+FEpicUnrealMCPComponentIndex::~FEpicUnrealMCPComponentIndex()
+{
+	Invalidation.Unregister(InvalidationHandle);
+}
+
+void FEpicUnrealMCPComponentIndex::Reset()
+{
+	if (Entries.Num() > 0)
+	{
+		++Stats.Invalidations;
+	}
+	Entries.Reset();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPComponentIndex::GetStatsJson() const
+{
+	return Stats.ToJson(Entries.Num());
+}
+
+bool FEpicUnrealMCPComponentIndex::IsStale(const FActorEntry& Entry, AActor* Actor)
+{
+	// A stale actor means it was destroyed and another one now lives at the same address
+	if (Entry.Actor.Get() != Actor || Entry.Components.Num() != Actor->GetComponents().Num())
+	{
+		return true;
+	}
+	for (const FEpicUnrealMCPComponentEntry& Component : Entry.Components)
+	{
+		if (!Component.Component.IsValid())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FEpicUnrealMCPComponentIndex::Build(AActor* Actor, FActorEntry& Out)
+{
+	Out.Actor = Actor;
+	Out.Components.Reset();
+	Out.NameToSlot.Reset();
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component)
+		{
+			FEpicUnrealMCPComponentEntry& Entry = Out.Components.AddDefaulted_GetRef();
+			Entry.Component = Component;
+			Entry.Name = Component->GetFName();
+		}
+	}
+
+	// Owned components live in a set, so sort by name for listings that do not reshuffle between calls
+	Out.Components.Sort([](const FEpicUnrealMCPComponentEntry& A, const FEpicUnrealMCPComponentEntry& B)
+	{
+		return A.Name.LexicalLess(B.Name);
+	});
+	for (int32 Slot = 0; Slot < Out.Components.Num(); ++Slot)
+	{
+		Out.NameToSlot.Add(Out.Components[Slot].Name, Slot);
+	}
+
+	// Property names are aliases; they never shadow an object name
+	for (TFieldIterator<FObjectProperty> PropIt(Actor->GetClass()); PropIt; ++PropIt)
+	{
+		FObjectProperty* ObjProp = *PropIt;
+		if (!ObjProp->PropertyClass || !ObjProp->PropertyClass->IsChildOf(UActorComponent::StaticClass()))
+		{
+			continue;
+		}
+
+		UObject* Value = ObjProp->GetObjectPropertyValue_InContainer(Actor);
+		if (!Value)
+		{
+			continue;
+		}
+
+		if (const int32* Slot = Out.NameToSlot.Find(Value->GetFName()))
+		{
+			FEpicUnrealMCPComponentEntry& Entry = Out.Components[*Slot];
+			if (Entry.PropertyName.IsNone())
+			{
+				Entry.PropertyName = ObjProp->GetFName();
+			}
+			if (!Out.NameToSlot.Contains(ObjProp->GetFName()))
+			{
+				Out.NameToSlot.Add(ObjProp->GetFName(), *Slot);
+			}
+		}
+	}
+}
+
+void FEpicUnrealMCPComponentIndex::SweepDestroyedActors()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Actor.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	SweepThreshold = FMath::Max(64, Entries.Num() * 2);
+}
+
+FEpicUnrealMCPComponentIndex::FActorEntry& FEpicUnrealMCPComponentIndex::FindOrBuild(AActor* Actor, bool bForceRebuild)
+{
+	// Entries are keyed by address, so a deleted actor's entry stays until it is swept or the address is reused
+	if (Entries.Num() >= SweepThreshold && !Entries.Contains(Actor))
+	{
+		SweepDestroyedActors();
+	}
+
+	FActorEntry& Entry = Entries.FindOrAdd(Actor);
+	if (!bForceRebuild && !IsStale(Entry, Actor))
+	{
+		++Stats.Hits;
+		return Entry;
+	}
+
+	++Stats.Misses;
+	Invalidation.BindDelegates();
+	Build(Actor, Entry);
+	return Entry;
+}
+
+UActorComponent* FEpicUnrealMCPComponentIndex::Find(AActor* Actor, const FString& ComponentName)
+{
+	if (!Actor || ComponentName.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FName Name(*ComponentName);
+	const FActorEntry* Entry = &FindOrBuild(Actor, false);
+	const int32* Slot = Entry->NameToSlot.Find(Name);
+
+	// The count check cannot see one component replaced by another, so an unknown name rebuilds once before giving up
+	if (!Slot)
+	{
+		Entry = &FindOrBuild(Actor, true);
+		Slot = Entry->NameToSlot.Find(Name);
+	}
+	return Slot ? Entry->Components[*Slot].Component.Get() : nullptr;
+}
+
+const TArray<FEpicUnrealMCPComponentEntry>& FEpicUnrealMCPComponentIndex::GetComponents(AActor* Actor)
+{
+	static const TArray<FEpicUnrealMCPComponentEntry> NoComponents;
+	return Actor ? FindOrBuild(Actor, false).Components : NoComponents;
+}
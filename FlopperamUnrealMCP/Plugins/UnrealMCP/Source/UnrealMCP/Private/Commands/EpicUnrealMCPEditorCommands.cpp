@@ -1,4 +1,17 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
+#include "Commands/EpicUnrealMCPActorIndex.h"
+#include "Commands/EpicUnrealMCPActorFilter.h"
+#include "Commands/EpicUnrealMCPAssetCache.h"
+#include "Commands/EpicUnrealMCPStructureBuilder.h"
+#include "Commands/EpicUnrealMCPPatternGenerator.h"
+#include "Commands/EpicUnrealMCPBulkEdit.h"
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+#include "Commands/EpicUnrealMCPWorldSnapshot.h"
+#include "Commands/EpicUnrealMCPPropertyResolver.h"
+#include "Commands/EpicUnrealMCPPropertyConverter.h"
+#include "Commands/EpicUnrealMCPNotifyPolicy.h"
+#include "Commands/EpicUnrealMCPComponentIndex.h"
+#include "Commands/EpicUnrealMCPPropertyWatch.h"
 #include "Editor.h"
 #include "UObject/UnrealType.h"
 #include "UObject/PropertyPortFlags.h"
@@ -10,10 +23,15 @@
 #include "Engine/GameViewportClient.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/PackageName.h"
 #include "Misc/App.h"
 #include "Misc/EngineVersion.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Selection.h"
+#include "GameFramework/WorldSettings.h"
+#include "ActorEditorUtils.h"
+#include "ScopedTransaction.h"
+#include "Editor/TransBuffer.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/DirectionalLight.h"
@@ -21,6 +39,9 @@
 #include "Engine/SpotLight.h"
 #include "Camera/CameraActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/SplineComponent.h"
+#include "Materials/MaterialInterface.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/LevelStreaming.h"
@@ -53,13 +74,73 @@
 #include "Kismet2/KismetEditorUtilities.h"
 #include "ObjectTools.h"
 #include "Engine/DataTable.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Misc/Base64.h"
 
 FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 {
+	CacheInvalidation = MakeShared<FEpicUnrealMCPCacheInvalidation>();
+	ActorIndex = MakeShared<FEpicUnrealMCPActorIndex>();
+	AssetCache = MakeShared<FEpicUnrealMCPAssetCache>();
+	BulkEdit = MakeShared<FEpicUnrealMCPBulkEdit>();
+	PropertyResolver = MakeShared<FEpicUnrealMCPPropertyResolver>(*CacheInvalidation);
+	PropertyConverter = MakeShared<FEpicUnrealMCPPropertyConverter>(*CacheInvalidation);
+	NotifyPolicy = MakeShared<FEpicUnrealMCPNotifyPolicy>(*CacheInvalidation);
+	ComponentIndex = MakeShared<FEpicUnrealMCPComponentIndex>(*CacheInvalidation);
+	PropertyWatch = MakeShared<FEpicUnrealMCPPropertyWatch>(*PropertyResolver);
+}
+
+// Commands that change the level or assets and therefore run inside an undo transaction
+static bool IsUndoableCommand(const FString& CommandType)
+{
+	static const TSet<FString> UndoableCommands = {
+		TEXT("spawn_actor"), TEXT("delete_actor"), TEXT("set_actor_transform"), TEXT("rename_actor"),
+		TEXT("add_widget_to_blueprint"), TEXT("set_widget_properties"), TEXT("rename_widget"),
+		TEXT("reparent_widget"), TEXT("remove_widget_from_blueprint"),
+		TEXT("set_actor_property"), TEXT("spawn_blueprint_actor"), TEXT("copy_actor"),
+		TEXT("set_asset_property"), TEXT("set_blueprint_default_property"),
+		TEXT("set_data_table_row_field"), TEXT("add_data_table_row"), TEXT("delete_data_table_row"),
+		TEXT("set_data_table_array_element"),
+		TEXT("spawn_actors"), TEXT("convert_to_instances"), TEXT("set_actor_transforms"),
+		TEXT("delete_actors"), TEXT("set_actors_folder"),
+		TEXT("build_structure"), TEXT("stamp_prefab"), TEXT("spawn_pattern"), TEXT("restore_world"),
+		TEXT("set_properties"), TEXT("set_component_property"), TEXT("set_component_transform")
+	};
+	return UndoableCommands.Contains(CommandType);
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
+	// Each mutating request is one undo step; batch helpers and an open bulk edit transaction nest into it.
+	// 'no_undo' skips recording entirely, which keeps very large generated content out of the undo buffer.
+	bool bRequestNoUndo = false;
+	if (Params.IsValid())
+	{
+		Params->TryGetBoolField(TEXT("no_undo"), bRequestNoUndo);
+	}
+
+	// The transaction of a recording bulk edit stays open across requests and captures every Modify,
+	// so a single request cannot opt out of it
+	const bool bUndoable = IsUndoableCommand(CommandType);
+	if (bUndoable && bRequestNoUndo && BulkEdit->IsTransacting())
+	{
+		return CreateErrorResponse(TEXT("no_undo has no effect inside a bulk edit that records undo; pass no_undo to begin_bulk_edit instead"));
+	}
+
+	const bool bNoUndo = bRequestNoUndo || BulkEdit->IsNoUndo();
+	if (bUndoable && bNoUndo)
+	{
+		++NumNoUndoRequests;
+	}
+	else if (bUndoable)
+	{
+		++NumTransactions;
+	}
+	const FScopedTransaction Transaction(
+		FText::Format(NSLOCTEXT("UnrealMCP", "CommandTransaction", "MCP {0}"), FText::FromString(CommandType)),
+		bUndoable && !bNoUndo);
+
 	// Actor manipulation commands
 	if (CommandType == TEXT("get_actors_in_level"))
 	{
@@ -122,6 +203,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
 	{
 		return HandleEditorMoveCamera(Params);
 	}
+	else if (CommandType == TEXT("get_server_stats"))
+	{
+		return HandleGetServerStats(Params);
+	}
+	else if (CommandType == TEXT("reload_notify_policy"))
+	{
+		return HandleReloadNotifyPolicy(Params);
+	}
 	// Widget Blueprint commands - CREATE
 	else if (CommandType == TEXT("create_widget_blueprint"))
 	{
@@ -232,6 +321,124 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
 	{
 		return HandleSetDataTableArrayElement(Params);
 	}
+	// Bulk Actor commands
+	else if (CommandType == TEXT("get_actor_transforms_bulk"))
+	{
+		return HandleGetActorTransformsBulk(Params);
+	}
+	else if (CommandType == TEXT("spawn_actors"))
+	{
+		return HandleSpawnActors(Params);
+	}
+	else if (CommandType == TEXT("convert_to_instances"))
+	{
+		return HandleConvertToInstances(Params);
+	}
+	else if (CommandType == TEXT("set_actor_transforms"))
+	{
+		return HandleSetActorTransforms(Params);
+	}
+	else if (CommandType == TEXT("delete_actors"))
+	{
+		return HandleDeleteActors(Params);
+	}
+	else if (CommandType == TEXT("set_actors_folder"))
+	{
+		return HandleSetActorsFolder(Params);
+	}
+	// Async asset loading commands
+	else if (CommandType == TEXT("preload_assets"))
+	{
+		return HandlePreloadAssets(Params);
+	}
+	else if (CommandType == TEXT("get_async_job"))
+	{
+		return HandleGetAsyncJob(Params);
+	}
+	// Structure builder commands
+	else if (CommandType == TEXT("build_structure"))
+	{
+		return HandleBuildStructure(Params);
+	}
+	// Prefab commands
+	else if (CommandType == TEXT("capture_prefab"))
+	{
+		return HandleCapturePrefab(Params);
+	}
+	else if (CommandType == TEXT("stamp_prefab"))
+	{
+		return HandleStampPrefab(Params);
+	}
+	// Pattern spawn commands
+	else if (CommandType == TEXT("spawn_pattern"))
+	{
+		return HandleSpawnPattern(Params);
+	}
+	// Bulk edit commands
+	else if (CommandType == TEXT("begin_bulk_edit"))
+	{
+		return HandleBeginBulkEdit(Params);
+	}
+	else if (CommandType == TEXT("end_bulk_edit"))
+	{
+		return HandleEndBulkEdit(Params);
+	}
+	// World snapshot commands
+	else if (CommandType == TEXT("snapshot_world"))
+	{
+		return HandleSnapshotWorld(Params);
+	}
+	else if (CommandType == TEXT("restore_world"))
+	{
+		return HandleRestoreWorld(Params);
+	}
+	else if (CommandType == TEXT("diff_world"))
+	{
+		return HandleDiffWorld(Params);
+	}
+	// Multi-object property commands
+	else if (CommandType == TEXT("get_properties"))
+	{
+		return HandleGetProperties(Params);
+	}
+	else if (CommandType == TEXT("set_properties"))
+	{
+		return HandleSetProperties(Params);
+	}
+	else if (CommandType == TEXT("dump_overrides"))
+	{
+		return HandleDumpOverrides(Params);
+	}
+	// Component commands
+	else if (CommandType == TEXT("list_components"))
+	{
+		return HandleListComponents(Params);
+	}
+	else if (CommandType == TEXT("get_component_property"))
+	{
+		return HandleGetComponentProperty(Params);
+	}
+	else if (CommandType == TEXT("set_component_property"))
+	{
+		return HandleSetComponentProperty(Params);
+	}
+	else if (CommandType == TEXT("set_component_transform"))
+	{
+		return HandleSetComponentTransform(Params);
+	}
+	// Property watch commands
+	else if (CommandType == TEXT("watch_properties"))
+	{
+		return HandleWatchProperties(Params);
+	}
+	else if (CommandType == TEXT("poll_property_changes"))
+	{
+		return HandlePollPropertyChanges(Params);
+	}
+	else if (CommandType == TEXT("unwatch_properties"))
+	{
+		return HandleUnwatchProperties(Params);
+	}
 
 	return CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
@@ -360,19 +567,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::ActorToJsonObject(AActor*
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World)
+	if (!ActorIndex->GetWorld())
 	{
 		return CreateErrorResponse(TEXT("No editor world available"));
 	}
 
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-
 	TArray<TSharedPtr<FJsonValue>> ActorArray;
-	for (AActor* Actor : AllActors)
+	for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
 	{
-		if (Actor)
+		AActor* Actor = ActorPtr.Get();
+		if (IsValid(Actor))
 		{
 			ActorArray.Add(ActorToJson(Actor));
 		}
@@ -387,26 +591,38 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(con
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
 {
-	FString Pattern;
-	if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+	// Compile the query once; it is then evaluated per actor without re-parsing
+	FEpicUnrealMCPActorFilter Filter;
+	FString FilterError;
+	if (!Filter.Compile(Params, FilterError))
+	{
+		return CreateErrorResponse(FilterError);
+	}
+
+	if (Filter.IsEmpty() && !Params->HasField(TEXT("pattern")))
 	{
 		return CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
 	}
 
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World)
+	if (!ActorIndex->GetWorld())
 	{
 		return CreateErrorResponse(TEXT("No editor world available"));
 	}
 
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+	const int32 MaxResults = Filter.GetMaxResults();
+	bool bTruncated = false;
 
 	TArray<TSharedPtr<FJsonValue>> MatchingActors;
-	for (AActor* Actor : AllActors)
+	for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
 	{
-		if (Actor && Actor->GetName().Contains(Pattern))
+		AActor* Actor = ActorPtr.Get();
+		if (IsValid(Actor) && Filter.Matches(Actor))
 		{
+			if (MaxResults > 0 && MatchingActors.Num() >= MaxResults)
+			{
+				bTruncated = true;
+				break;
+			}
 			MatchingActors.Add(ActorToJson(Actor));
 		}
 	}
@@ -414,6 +630,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(con
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
 	ResultObj->SetNumberField(TEXT("count"), MatchingActors.Num());
+	ResultObj->SetBoolField(TEXT("truncated"), bTruncated);
 
 	return ResultObj;
 }
@@ -427,6 +644,25 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
 		return CreateErrorResponse(TEXT("Missing 'type' parameter"));
 	}
 
+	// With async=true, unloaded meshes/materials are streamed in first and the spawn finishes as a job
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		CollectSpawnAssetPaths(Params, AssetPaths);
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("spawn_actor"), Params, AssetPaths))
+		{
+			return Pending;
+		}
+	}
+
+	bool bInstanced = false;
+	Params->TryGetBoolField(TEXT("instanced"), bInstanced);
+	if (bInstanced)
+	{
+		return SpawnInstancedActor(Params);
+	}
+
 	FString ActorName;
 	if (!Params->TryGetStringField(TEXT("name"), ActorName))
 	{
@@ -442,21 +678,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
 		Scale = GetVectorFromJson(Params, TEXT("scale"));
 	}
 
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	UWorld* World = ActorIndex->GetWorld();
 	if (!World)
 	{
 		return CreateErrorResponse(TEXT("Failed to get editor world"));
 	}
 
 	// Check if an actor with this name already exists
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-	for (AActor* Actor : AllActors)
+	if (ActorIndex->FindByName(ActorName))
 	{
-		if (Actor && Actor->GetName() == ActorName)
-		{
-			return CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
-		}
+		return CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
 	}
 
 	FActorSpawnParameters SpawnParams;
@@ -473,7 +704,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
 			FString MeshPath;
 			if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
 			{
-				UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+				UStaticMesh* Mesh = AssetCache->Load<UStaticMesh>(MeshPath);
 				if (Mesh)
 				{
 					NewMeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
@@ -483,6 +714,20 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
 					UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *MeshPath);
 				}
 			}
+
+			FString MaterialPath;
+			if (Params->TryGetStringField(TEXT("material"), MaterialPath))
+			{
+				UMaterialInterface* Material = AssetCache->Load<UMaterialInterface>(MaterialPath);
+				if (Material)
+				{
+					NewMeshActor->GetStaticMeshComponent()->SetMaterial(0, Material);
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Could not find material at path: %s"), *MaterialPath);
+				}
+			}
 		}
 		NewActor = NewMeshActor;
 	}
@@ -544,8 +789,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
 			// Store actor info before deletion for the response
 			TSharedPtr<FJsonObject> ActorInfo = ActorToJsonObject(Actor);
 
-			// Delete the actor
-			Actor->Destroy();
+			// Delete the actor; EditorDestroyActor records the level change for undo
+			World->EditorDestroyActor(Actor, true);
 
 			TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 			ResultObj->SetBoolField(TEXT("success"), true);
@@ -612,8 +857,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleRenameActor(const TS
 	}
 
 	// Rename the actor
+	const FName OldObjectName = TargetActor->GetFName();
 	TargetActor->Rename(*NewName, nullptr);
 	TargetActor->SetActorLabel(NewName);
+	ActorIndex->NotifyActorRenamed(TargetActor, OldObjectName);
 
 	// Return success with actor info
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -643,26 +890,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
 		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World)
-	{
-		return CreateErrorResponse(TEXT("No editor world available"));
-	}
-
-	// Find the actor
-	AActor* TargetActor = nullptr;
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && Actor->GetName() == ActorName)
-		{
-			TargetActor = Actor;
-			break;
-		}
-	}
-
+	AActor* TargetActor = ActorIndex->FindByName(ActorName);
 	if (!TargetActor)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
@@ -684,8 +912,11 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
 		NewTransform.SetScale3D(GetVectorFromJson(Params, TEXT("scale")));
 	}
 
-	// Set the new transform
+	// Set the new transform; PostEditMove and dirtying are deferred inside a bulk edit
+	TargetActor->Modify(false);
 	TargetActor->SetActorTransform(NewTransform);
+	BulkEdit->NotifyActorMoved(TargetActor);
+	BulkEdit->NotifyPackageDirty(TargetActor);
 
 	// Return updated actor info
 	return ActorToJsonObject(TargetActor, true);
@@ -1054,6 +1285,49 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleEditorMoveCamera(con
 	return Result;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleReloadNotifyPolicy(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("rules"), NotifyPolicy->Reload());
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetServerStats(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetObjectField(TEXT("asset_cache"), AssetCache->GetStatsJson());
+
+	TSharedPtr<FJsonObject> IndexStats = MakeShared<FJsonObject>();
+	IndexStats->SetNumberField(TEXT("actors"), ActorIndex->Num());
+	Result->SetObjectField(TEXT("actor_index"), IndexStats);
+	Result->SetNumberField(TEXT("async_jobs"), AsyncJobs.Num());
+	Result->SetObjectField(TEXT("bulk_edit"), BulkEdit->GetStatsJson());
+	Result->SetObjectField(TEXT("property_paths"), PropertyResolver->GetStatsJson());
+	Result->SetObjectField(TEXT("property_conversion"), PropertyConverter->GetStatsJson());
+	Result->SetObjectField(TEXT("notify_policy"), NotifyPolicy->GetStatsJson());
+	Result->SetObjectField(TEXT("components"), ComponentIndex->GetStatsJson());
+	Result->SetObjectField(TEXT("property_watch"), PropertyWatch->GetStatsJson());
+
+	TSharedPtr<FJsonObject> UndoStats = MakeShared<FJsonObject>();
+	UndoStats->SetNumberField(TEXT("transactions"), NumTransactions);
+	UndoStats->SetNumberField(TEXT("no_undo_requests"), NumNoUndoRequests);
+	if (GEditor && GEditor->Trans)
+	{
+		UndoStats->SetNumberField(TEXT("queue_length"), GEditor->Trans->GetQueueLength());
+		if (const UTransBuffer* TransBuffer = Cast<UTransBuffer>(GEditor->Trans))
+		{
+			UndoStats->SetNumberField(TEXT("buffer_bytes"), double(TransBuffer->GetUndoSize()));
+			UndoStats->SetNumberField(TEXT("max_bytes"), double(TransBuffer->MaxMemory));
+		}
+	}
+	Result->SetObjectField(TEXT("undo"), UndoStats);
+
+	Result->SetBoolField(TEXT("success"), true);
+
+	return Result;
+}
+
 // ============================================================================
 // Widget Blueprint Helper Methods
 // ============================================================================
@@ -1760,1718 +2034,5016 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleShowWidget(const TSh
 
 AActor* FEpicUnrealMCPEditorCommands::FindActorByName(const FString& ActorName)
 {
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World) return nullptr;
+	return ActorIndex->FindByName(ActorName);
+}
 
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+FString FEpicUnrealMCPEditorCommands::GetPropertyTypeName(FProperty* Property)
+{
+	return FEpicUnrealMCPPropertyConverter::GetTypeName(Property);
+}
 
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && Actor->GetName() == ActorName)
-		{
-			return Actor;
-		}
-	}
-	return nullptr;
+TSharedPtr<FJsonValue> FEpicUnrealMCPEditorCommands::PropertyToJsonValue(FProperty* Property, const void* ValuePtr)
+{
+	return PropertyConverter->ToJson(Property, ValuePtr);
 }
 
-FString FEpicUnrealMCPEditorCommands::GetPropertyTypeName(UProperty* Property)
+TSharedPtr<FJsonValue> FEpicUnrealMCPEditorCommands::PropertyToJsonValue(FProperty* Property, const void* ValuePtr, const FEpicUnrealMCPConvertLimits& Limits, const FString& Path)
 {
-	if (!Property) return TEXT("Unknown");
+	return PropertyConverter->ToJson(Property, ValuePtr, Limits, Path);
+}
 
-	if (Cast<UBoolProperty>(Property)) return TEXT("Bool");
-	if (UByteProperty* ByteProp = Cast<UByteProperty>(Property))
-	{
-		return ByteProp->Enum ? FString::Printf(TEXT("Enum:%s"), *ByteProp->Enum->GetName()) : TEXT("Byte");
-	}
-	if (Cast<UIntProperty>(Property)) return TEXT("Int");
-	if (Cast<UInt64Property>(Property)) return TEXT("Int64");
-	if (Cast<UFloatProperty>(Property)) return TEXT("Float");
-	if (Cast<UDoubleProperty>(Property)) return TEXT("Double");
-	if (Cast<UStrProperty>(Property)) return TEXT("String");
-	if (Cast<UNameProperty>(Property)) return TEXT("Name");
-	if (Cast<UTextProperty>(Property)) return TEXT("Text");
-	if (UStructProperty* StructProp = Cast<UStructProperty>(Property))
-	{
-		return FString::Printf(TEXT("Struct:%s"), *StructProp->Struct->GetName());
-	}
-	if (UEnumProperty* EnumProp = Cast<UEnumProperty>(Property))
-	{
-		return FString::Printf(TEXT("Enum:%s"), *EnumProp->GetEnum()->GetName());
-	}
-	if (UObjectProperty* ObjProp = Cast<UObjectProperty>(Property))
-	{
-		return FString::Printf(TEXT("Object:%s"), *ObjProp->PropertyClass->GetName());
-	}
-	if (UClassProperty* ClassProp = Cast<UClassProperty>(Property))
-	{
-		return FString::Printf(TEXT("Class:%s"), *ClassProp->MetaClass->GetName());
-	}
-	if (UArrayProperty* ArrayProp = Cast<UArrayProperty>(Property))
+bool FEpicUnrealMCPEditorCommands::JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ValuePtr)
+{
+	return PropertyConverter->FromJson(JsonValue, Property, ValuePtr);
+}
+
+/** Size limits and encoding shared by every read */
+static void ReadConvertLimits(const TSharedPtr<FJsonObject>& Params, FEpicUnrealMCPConvertLimits& OutLimits)
+{
+	Params->TryGetNumberField(TEXT("max_elements"), OutLimits.MaxElements);
+	Params->TryGetNumberField(TEXT("max_depth"), OutLimits.MaxDepth);
+	Params->TryGetBoolField(TEXT("packed"), OutLimits.bPacked);
+}
+
+/**
+ * Property path, size limits and encoding of a single-value read.
+ * 'continuation' (as returned inside a truncated value) replaces 'property'
+ * and 'offset'.
+ */
+static bool ReadPropertyRequest(const TSharedPtr<FJsonObject>& Params, FString& OutPath, FEpicUnrealMCPConvertLimits& OutLimits, FString& OutError)
+{
+	FString Continuation;
+	if (Params->TryGetStringField(TEXT("continuation"), Continuation))
 	{
-		return FString::Printf(TEXT("Array<%s>"), *GetPropertyTypeName(ArrayProp->Inner));
+		if (!FEpicUnrealMCPPropertyConverter::ParseContinuation(Continuation, OutPath, OutLimits.Offset))
+		{
+			OutError = FString::Printf(TEXT("Invalid continuation token: %s"), *Continuation);
+			return false;
+		}
 	}
-	if (UMapProperty* MapProp = Cast<UMapProperty>(Property))
+	else if (!Params->TryGetStringField(TEXT("property"), OutPath))
 	{
-		return FString::Printf(TEXT("Map<%s, %s>"),
-			*GetPropertyTypeName(MapProp->KeyProp),
-			*GetPropertyTypeName(MapProp->ValueProp));
+		OutError = TEXT("Missing 'property' parameter");
+		return false;
 	}
-	if (USetProperty* SetProp = Cast<USetProperty>(Property))
+	else
 	{
-		return FString::Printf(TEXT("Set<%s>"), *GetPropertyTypeName(SetProp->ElementProp));
+		Params->TryGetNumberField(TEXT("offset"), OutLimits.Offset);
 	}
 
-	return Property->GetClass()->GetName();
+	ReadConvertLimits(Params, OutLimits);
+	return true;
 }
 
-TSharedPtr<FJsonValue> FEpicUnrealMCPEditorCommands::PropertyToJsonValue(UProperty* Property, const void* ValuePtr)
+/** Full element count of a single-value read whose value is a container */
+static void SetPropertyCount(FJsonObject& Response, FProperty* Property, const void* ValuePtr)
 {
-	if (!Property || !ValuePtr)
+	const int32 NumElements = FEpicUnrealMCPPropertyConverter::GetNumElements(Property, ValuePtr);
+	if (NumElements != INDEX_NONE)
 	{
-		return MakeShared<FJsonValueNull>();
+		Response.SetNumberField(TEXT("count"), NumElements);
 	}
+}
 
-	// Boolean
-	if (UBoolProperty* BoolProp = Cast<UBoolProperty>(Property))
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString ActorName;
+	if (!Params->TryGetStringField(TEXT("name"), ActorName))
 	{
-		return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	// Integer types
-	if (UByteProperty* ByteProp = Cast<UByteProperty>(Property))
-	{
-		if (ByteProp->Enum)
-		{
-			uint8 Value = ByteProp->GetPropertyValue(ValuePtr);
-			FString EnumName = ByteProp->Enum->GetNameStringByIndex(Value);
-			return MakeShared<FJsonValueString>(EnumName);
-		}
-		return MakeShared<FJsonValueNumber>(ByteProp->GetPropertyValue(ValuePtr));
-	}
-	if (UIntProperty* IntProp = Cast<UIntProperty>(Property))
+	FString PropertyName;
+	FEpicUnrealMCPConvertLimits Limits;
+	FString RequestError;
+	if (!ReadPropertyRequest(Params, PropertyName, Limits, RequestError))
 	{
-		return MakeShared<FJsonValueNumber>(IntProp->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(RequestError);
 	}
-	if (UInt64Property* Int64Prop = Cast<UInt64Property>(Property))
+
+	AActor* Actor = FindActorByName(ActorName);
+	if (!Actor)
 	{
-		return MakeShared<FJsonValueNumber>((double)Int64Prop->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
 	}
 
-	// Float types
-	if (UFloatProperty* FloatProp = Cast<UFloatProperty>(Property))
+	// Resolve the (possibly nested) property path on the actor
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Actor, PropertyName, Resolved, PathError))
 	{
-		return MakeShared<FJsonValueNumber>(FloatProp->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(PathError);
 	}
-	if (UDoubleProperty* DoubleProp = Cast<UDoubleProperty>(Property))
+	FProperty* Property = Resolved.Property;
+	const void* ValuePtr = Resolved.ValuePtr;
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), ActorName);
+	Result->SetStringField(TEXT("property"), PropertyName);
+	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
+	Result->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr, Limits, PropertyName));
+	SetPropertyCount(*Result, Property, ValuePtr);
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString ActorName;
+	if (!Params->TryGetStringField(TEXT("name"), ActorName))
 	{
-		return MakeShared<FJsonValueNumber>(DoubleProp->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	// String types
-	if (UStrProperty* StrProp = Cast<UStrProperty>(Property))
+	FString PropertyName;
+	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
 	{
-		return MakeShared<FJsonValueString>(StrProp->GetPropertyValue(ValuePtr));
+		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
 	}
-	if (UNameProperty* NameProp = Cast<UNameProperty>(Property))
+
+	if (!Params->HasField(TEXT("value")))
 	{
-		return MakeShared<FJsonValueString>(NameProp->GetPropertyValue(ValuePtr).ToString());
+		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
 	}
-	if (UTextProperty* TextProp = Cast<UTextProperty>(Property))
+
+	AActor* Actor = FindActorByName(ActorName);
+	if (!Actor)
 	{
-		return MakeShared<FJsonValueString>(TextProp->GetPropertyValue(ValuePtr).ToString());
+		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
 	}
 
-	// Struct types (Vector, Rotator, Transform, Color, LinearColor)
-	if (UStructProperty* StructProp = Cast<UStructProperty>(Property))
+	// Special handling for FolderPath - use SetFolderPath() to properly register with World Outliner
+	if (PropertyName == TEXT("FolderPath"))
 	{
-		UScriptStruct* Struct = StructProp->Struct;
-
-		if (Struct == TBaseStructure<FVector>::Get())
-		{
-			const FVector* Vec = static_cast<const FVector*>(ValuePtr);
-			TArray<TSharedPtr<FJsonValue>> Arr;
-			Arr.Add(MakeShared<FJsonValueNumber>(Vec->X));
-			Arr.Add(MakeShared<FJsonValueNumber>(Vec->Y));
-			Arr.Add(MakeShared<FJsonValueNumber>(Vec->Z));
-			return MakeShared<FJsonValueArray>(Arr);
-		}
-		if (Struct == TBaseStructure<FRotator>::Get())
+		FString FolderPath;
+		TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+		if (JsonValue.IsValid() && JsonValue->Type == EJson::String)
 		{
-			const FRotator* Rot = static_cast<const FRotator*>(ValuePtr);
-			TArray<TSharedPtr<FJsonValue>> Arr;
-			Arr.Add(MakeShared<FJsonValueNumber>(Rot->Pitch));
-			Arr.Add(MakeShared<FJsonValueNumber>(Rot->Yaw));
-			Arr.Add(MakeShared<FJsonValueNumber>(Rot->Roll));
-			return MakeShared<FJsonValueArray>(Arr);
+			FolderPath = JsonValue->AsString();
 		}
-		if (Struct == TBaseStructure<FTransform>::Get())
-		{
-			const FTransform* Trans = static_cast<const FTransform*>(ValuePtr);
-			TSharedPtr<FJsonObject> TransObj = MakeShared<FJsonObject>();
-
-			TArray<TSharedPtr<FJsonValue>> LocArr;
-			LocArr.Add(MakeShared<FJsonValueNumber>(Trans->GetLocation().X));
-			LocArr.Add(MakeShared<FJsonValueNumber>(Trans->GetLocation().Y));
-			LocArr.Add(MakeShared<FJsonValueNumber>(Trans->GetLocation().Z));
-			TransObj->SetArrayField(TEXT("location"), LocArr);
 
-			FRotator Rot = Trans->GetRotation().Rotator();
-			TArray<TSharedPtr<FJsonValue>> RotArr;
-			RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Pitch));
-			RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Yaw));
-			RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Roll));
-			TransObj->SetArrayField(TEXT("rotation"), RotArr);
-
-			TArray<TSharedPtr<FJsonValue>> ScaleArr;
-			ScaleArr.Add(MakeShared<FJsonValueNumber>(Trans->GetScale3D().X));
-			ScaleArr.Add(MakeShared<FJsonValueNumber>(Trans->GetScale3D().Y));
-			ScaleArr.Add(MakeShared<FJsonValueNumber>(Trans->GetScale3D().Z));
-			TransObj->SetArrayField(TEXT("scale"), ScaleArr);
-
-			return MakeShared<FJsonValueObject>(TransObj);
-		}
-		if (Struct == TBaseStructure<FLinearColor>::Get())
-		{
-			const FLinearColor* Color = static_cast<const FLinearColor*>(ValuePtr);
-			TArray<TSharedPtr<FJsonValue>> Arr;
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->R));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->G));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->B));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->A));
-			return MakeShared<FJsonValueArray>(Arr);
-		}
-		if (Struct == TBaseStructure<FColor>::Get())
-		{
-			const FColor* Color = static_cast<const FColor*>(ValuePtr);
-			TArray<TSharedPtr<FJsonValue>> Arr;
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->R));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->G));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->B));
-			Arr.Add(MakeShared<FJsonValueNumber>(Color->A));
-			return MakeShared<FJsonValueArray>(Arr);
-		}
-		if (Struct == TBaseStructure<FVector2D>::Get())
-		{
-			const FVector2D* Vec = static_cast<const FVector2D*>(ValuePtr);
-			TArray<TSharedPtr<FJsonValue>> Arr;
-			Arr.Add(MakeShared<FJsonValueNumber>(Vec->X));
-			Arr.Add(MakeShared<FJsonValueNumber>(Vec->Y));
-			return MakeShared<FJsonValueArray>(Arr);
-		}
+		Actor->SetFolderPath(*FolderPath);
+		Actor->Modify(false);
+		BulkEdit->NotifyPackageDirty(Actor);
 
-		// Generic struct - iterate fields as JSON object
-		TSharedPtr<FJsonObject> StructJson = MakeShared<FJsonObject>();
-		for (TFieldIterator<UProperty> PropIt(Struct); PropIt; ++PropIt)
-		{
-			UProperty* FieldProp = *PropIt;
-			const void* FieldPtr = FieldProp->ContainerPtrToValuePtr<void>(ValuePtr);
-			TSharedPtr<FJsonValue> FieldJson = PropertyToJsonValue(FieldProp, FieldPtr);
-			StructJson->SetField(FieldProp->GetName(), FieldJson);
-		}
-		return MakeShared<FJsonValueObject>(StructJson);
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetBoolField(TEXT("success"), true);
+		Result->SetStringField(TEXT("actor"), ActorName);
+		Result->SetStringField(TEXT("property"), PropertyName);
+		Result->SetStringField(TEXT("type"), TEXT("Name"));
+		Result->SetStringField(TEXT("value"), Actor->GetFolderPath().ToString());
+		return Result;
 	}
 
-	// Enum
-	if (UEnumProperty* EnumProp = Cast<UEnumProperty>(Property))
+	// Resolve the (possibly nested) property path; it may end on a component or other subobject
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Actor, PropertyName, Resolved, PathError, true))
 	{
-		UEnum* Enum = EnumProp->GetEnum();
-		UNumericProperty* UnderlyingProp = EnumProp->GetUnderlyingProperty();
-		int64 Value = UnderlyingProp->GetSignedIntPropertyValue(ValuePtr);
-		FString EnumName = Enum->GetNameStringByValue(Value);
-		return MakeShared<FJsonValueString>(EnumName);
+		return CreateErrorResponse(PathError);
 	}
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+	UObject* Target = Resolved.Object;
 
-	// Object reference
-	if (UObjectProperty* ObjProp = Cast<UObjectProperty>(Property))
+	// Check if property is editable
+	if (Property->HasAnyPropertyFlags(CPF_EditConst) || Resolved.MemberProperty->HasAnyPropertyFlags(CPF_EditConst))
 	{
-		UObject* Obj = ObjProp->GetObjectPropertyValue(ValuePtr);
-		if (Obj)
+		return CreateErrorResponse(FString::Printf(TEXT("Property is read-only: %s"), *PropertyName));
+	}
+
+	// Get the JSON value
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+
+	// Record the old state for undo before writing
+	Target->Modify(false);
+
+	// Convert and set the value
+	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	{
+		return CreateErrorResponse(FString::Printf(
+			TEXT("Failed to set property value. Property type: %s"),
+			*GetPropertyTypeName(Property)
+		));
+	}
+
+	{
+		// The property and any configured struct sub-properties are each notified once when the scope ends
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+		BulkEdit->NotifyPackageDirty(Target);
+		NotifyPolicy->NotifyWrite(*BulkEdit, Target, Resolved.MemberProperty, Property);
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), ActorName);
+	Result->SetStringField(TEXT("property"), PropertyName);
+	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
+	Result->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
+
+	return Result;
+}
+
+// ============================================================================
+// Blueprint Actor Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintPath;
+	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+	}
+
+	FString ActorName;
+	if (!Params->TryGetStringField(TEXT("actor_name"), ActorName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+	}
+
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		CollectSpawnAssetPaths(Params, AssetPaths);
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("spawn_blueprint_actor"), Params, AssetPaths))
+		{
+			return Pending;
+		}
+	}
+
+	FVector Location = GetVectorFromJson(Params, TEXT("location"));
+	FRotator Rotation = GetRotatorFromJson(Params, TEXT("rotation"));
+	FVector Scale(1, 1, 1);
+	if (Params->HasField(TEXT("scale")))
+	{
+		Scale = GetVectorFromJson(Params, TEXT("scale"));
+	}
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("No editor world available"));
+	}
+
+	// Load the Blueprint class (append _C if not present)
+	UClass* ActorClass = AssetCache->LoadBlueprintClass(BlueprintPath, AActor::StaticClass());
+	if (!ActorClass)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint class: %s"), *BlueprintPath));
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = FName(*ActorName);
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* NewActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
+	if (!NewActor)
+	{
+		return CreateErrorResponse(TEXT("Failed to spawn Blueprint actor"));
+	}
+
+	NewActor->SetActorScale3D(Scale);
+	NewActor->MarkPackageDirty();
+
+	return ActorToJsonObject(NewActor, true);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCopyActor(const TSharedPtr<FJsonObject>& Params)
+{
+	FString SourceName;
+	if (!Params->TryGetStringField(TEXT("source_name"), SourceName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'source_name' parameter"));
+	}
+
+	FString NewName;
+	if (!Params->TryGetStringField(TEXT("new_name"), NewName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'new_name' parameter"));
+	}
+
+	AActor* SourceActor = FindActorByName(SourceName);
+	if (!SourceActor)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Source actor not found: %s"), *SourceName));
+	}
+
+	UWorld* World = SourceActor->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("No world available"));
+	}
+
+	// Determine spawn location
+	FVector SpawnLocation = SourceActor->GetActorLocation();
+	FRotator SpawnRotation = SourceActor->GetActorRotation();
+
+	if (Params->HasField(TEXT("location")))
+	{
+		SpawnLocation = GetVectorFromJson(Params, TEXT("location"));
+	}
+	else if (Params->HasField(TEXT("offset")))
+	{
+		SpawnLocation += GetVectorFromJson(Params, TEXT("offset"));
+	}
+	else
+	{
+		SpawnLocation += FVector(500, 0, 0); // Default offset
+	}
+
+	if (Params->HasField(TEXT("rotation")))
+	{
+		SpawnRotation = GetRotatorFromJson(Params, TEXT("rotation"));
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = FName(*NewName);
+	SpawnParams.Template = SourceActor; // Copy all properties from source
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* NewActor = World->SpawnActor<AActor>(
+		SourceActor->GetClass(),
+		SpawnLocation,
+		SpawnRotation,
+		SpawnParams
+	);
+
+	if (!NewActor)
+	{
+		return CreateErrorResponse(TEXT("Failed to copy actor"));
+	}
+
+	NewActor->SetActorScale3D(SourceActor->GetActorScale3D());
+	NewActor->MarkPackageDirty();
+
+	return ActorToJsonObject(NewActor, true);
+}
+
+// ============================================================================
+// Asset Property Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetAssetProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString AssetPath;
+	if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
+	}
+
+	FString PropertyName;
+	FEpicUnrealMCPConvertLimits Limits;
+	FString RequestError;
+	if (!ReadPropertyRequest(Params, PropertyName, Limits, RequestError))
+	{
+		return CreateErrorResponse(RequestError);
+	}
+
+	// Load the asset
+	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+	if (!Asset)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath));
+	}
+
+	// Resolve the (possibly nested) property path
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Asset, PropertyName, Resolved, PathError))
+	{
+		return CreateErrorResponse(PathError);
+	}
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("asset"), AssetPath);
+	Response->SetStringField(TEXT("property"), PropertyName);
+	Response->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
+	Response->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr, Limits, PropertyName));
+	SetPropertyCount(*Response, Property, ValuePtr);
+
+	return Response;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetAssetProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString AssetPath;
+	if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
+	}
+
+	FString PropertyName;
+	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+	}
+
+	if (!Params->HasField(TEXT("value")))
+	{
+		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+	}
+
+	// Load the asset
+	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+	if (!Asset)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath));
+	}
+
+	// Resolve the (possibly nested) property path
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Asset, PropertyName, Resolved, PathError, true))
+	{
+		return CreateErrorResponse(PathError);
+	}
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+
+	// Check if editable
+	if (Property->HasAnyPropertyFlags(CPF_EditConst) || Resolved.MemberProperty->HasAnyPropertyFlags(CPF_EditConst))
+	{
+		return CreateErrorResponse(TEXT("Property is read-only"));
+	}
+
+	// Record the old state for undo before writing
+	Resolved.Object->Modify();
+
+	// Set the value using existing helper
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	{
+		return CreateErrorResponse(TEXT("Failed to set property value"));
+	}
+
+	// Mark dirty (no compilation needed for Data Assets)
+	Resolved.Object->MarkPackageDirty();
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("asset"), AssetPath);
+	Response->SetStringField(TEXT("property"), PropertyName);
+	Response->SetField(TEXT("new_value"), PropertyToJsonValue(Property, ValuePtr));
+
+	return Response;
+}
+
+// ============================================================================
+// Blueprint Default Property Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetBlueprintDefaultProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintPath;
+	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+	}
+
+	FString PropertyName;
+	FEpicUnrealMCPConvertLimits Limits;
+	FString RequestError;
+	if (!ReadPropertyRequest(Params, PropertyName, Limits, RequestError))
+	{
+		return CreateErrorResponse(RequestError);
+	}
+
+	// Load the Blueprint class (append _C if not present)
+	UClass* BPClass = AssetCache->LoadBlueprintClass(BlueprintPath, UObject::StaticClass());
+	if (!BPClass)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint class: %s"), *BlueprintPath));
+	}
+
+	// Get the Class Default Object (CDO)
+	UObject* CDO = BPClass->GetDefaultObject();
+	if (!CDO)
+	{
+		return CreateErrorResponse(TEXT("Failed to get Class Default Object"));
+	}
+
+	// Resolve the (possibly nested) property path on the CDO
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(CDO, PropertyName, Resolved, PathError))
+	{
+		return CreateErrorResponse(PathError);
+	}
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("blueprint"), BlueprintPath);
+	Response->SetStringField(TEXT("property"), PropertyName);
+	Response->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
+	Response->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr, Limits, PropertyName));
+	SetPropertyCount(*Response, Property, ValuePtr);
+
+	return Response;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetBlueprintDefaultProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintPath;
+	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+	}
+
+	FString PropertyName;
+	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+	}
+
+	if (!Params->HasField(TEXT("value")))
+	{
+		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+	}
+
+	// Load the Blueprint asset (not just the class)
+	FString BPAssetPath = BlueprintPath;
+	if (BPAssetPath.EndsWith(TEXT("_C")))
+	{
+		BPAssetPath = BPAssetPath.LeftChop(2);
+	}
+
+	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BPAssetPath);
+	if (!Blueprint)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint: %s"), *BPAssetPath));
+	}
+
+	// Get the generated class
+	UClass* BPClass = Blueprint->GeneratedClass;
+	if (!BPClass)
+	{
+		return CreateErrorResponse(TEXT("Blueprint has no GeneratedClass - needs compilation"));
+	}
+
+	// Get the CDO
+	UObject* CDO = BPClass->GetDefaultObject();
+	if (!CDO)
+	{
+		return CreateErrorResponse(TEXT("Failed to get Class Default Object"));
+	}
+
+	// Resolve the (possibly nested) property path on the CDO
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(CDO, PropertyName, Resolved, PathError, true))
+	{
+		return CreateErrorResponse(PathError);
+	}
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+
+	// Check if editable
+	if (Property->HasAnyPropertyFlags(CPF_EditConst) || Resolved.MemberProperty->HasAnyPropertyFlags(CPF_EditConst))
+	{
+		return CreateErrorResponse(TEXT("Property is read-only"));
+	}
+
+	// Record the old state for undo before writing
+	Resolved.Object->Modify();
+
+	// Set the value
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	{
+		return CreateErrorResponse(TEXT("Failed to set property value"));
+	}
+
+	// Read the value back now; compiling may reinstance the CDO and its properties
+	TSharedPtr<FJsonValue> NewValue = PropertyToJsonValue(Property, ValuePtr);
+
+	// Mark Blueprint dirty and recompile
+	Blueprint->Modify();
+	Blueprint->MarkPackageDirty();
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("blueprint"), BlueprintPath);
+	Response->SetStringField(TEXT("property"), PropertyName);
+	Response->SetField(TEXT("new_value"), NewValue);
+
+	return Response;
+}
+
+// ============================================================================
+// Data Table Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::RowStructToJson(UScriptStruct* RowStruct, const void* RowData)
+{
+	// Each field as {type, value}
+	return PropertyConverter->StructToJson(RowStruct, RowData, true);
+}
+
+bool FEpicUnrealMCPEditorCommands::JsonToRowStruct(const TSharedPtr<FJsonObject>& JsonObj, UScriptStruct* RowStruct, void* RowData)
+{
+	if (!JsonObj.IsValid() || !RowStruct || !RowData)
+	{
+		return false;
+	}
+
+	// Support both {type, value} format and direct value
+	TArray<FString> FailedFields;
+	PropertyConverter->StructFromJson(*JsonObj, RowStruct, RowData, true, &FailedFields);
+	for (const FString& PropName : FailedFields)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to set DataTable row property: %s"), *PropName);
+		// Continue with other properties
+	}
+	return true;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleListDataTableRows(const TSharedPtr<FJsonObject>& Params)
+{
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	TArray<FName> RowNames = DataTable->GetRowNames();
+	TArray<TSharedPtr<FJsonValue>> RowNamesJson;
+
+	for (const FName& RowName : RowNames)
+	{
+		RowNamesJson.Add(MakeShared<FJsonValueString>(RowName.ToString()));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_struct"), DataTable->GetRowStruct() ? DataTable->GetRowStruct()->GetName() : TEXT("Unknown"));
+	Result->SetArrayField(TEXT("row_names"), RowNamesJson);
+	Result->SetNumberField(TEXT("count"), RowNames.Num());
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetDataTableRow(const TSharedPtr<FJsonObject>& Params)
+{
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	FString RowName;
+	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+	}
+
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!RowStruct)
+	{
+		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+	}
+
+	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
+	if (!RowData)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
+	}
+
+	const double ConvertStart = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> RowJson = RowStructToJson(const_cast<UScriptStruct*>(RowStruct), RowData);
+	const double ConvertMs = (FPlatformTime::Seconds() - ConvertStart) * 1000.0;
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_name"), RowName);
+	Result->SetStringField(TEXT("row_struct"), RowStruct->GetName());
+	Result->SetObjectField(TEXT("row_data"), RowJson);
+	Result->SetNumberField(TEXT("convert_ms"), ConvertMs);
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetDataTableRowField(const TSharedPtr<FJsonObject>& Params)
+{
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	FString RowName;
+	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+	}
+
+	FString FieldName;
+	if (!Params->TryGetStringField(TEXT("field_name"), FieldName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'field_name' parameter"));
+	}
+
+	if (!Params->HasField(TEXT("value")))
+	{
+		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+	}
+
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!RowStruct)
+	{
+		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+	}
+
+	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
+	if (!RowData)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
+	}
+
+	// Find the property in the row struct
+	FProperty* Property = const_cast<UScriptStruct*>(RowStruct)->FindPropertyByName(FName(*FieldName));
+	if (!Property)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Field not found: %s"), *FieldName));
+	}
+
+	void* FieldPtr = Property->ContainerPtrToValuePtr<void>(RowData);
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+
+	if (!JsonValueToProperty(JsonValue, Property, FieldPtr))
+	{
+		return CreateErrorResponse(FString::Printf(
+			TEXT("Failed to set field value. Field type: %s"),
+			*GetPropertyTypeName(Property)
+		));
+	}
+
+	// Mark dirty and notify
+	DataTable->Modify();
+	DataTable->MarkPackageDirty();
+	DataTable->HandleDataTableChanged(FName(*RowName));
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_name"), RowName);
+	Result->SetStringField(TEXT("field_name"), FieldName);
+	Result->SetStringField(TEXT("field_type"), GetPropertyTypeName(Property));
+	Result->SetField(TEXT("new_value"), PropertyToJsonValue(Property, FieldPtr));
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleAddDataTableRow(const TSharedPtr<FJsonObject>& Params)
+{
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	FString RowName;
+	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+	}
+
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	const UScriptStruct* RowStructConst = DataTable->GetRowStruct();
+	if (!RowStructConst)
+	{
+		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+	}
+	UScriptStruct* RowStruct = const_cast<UScriptStruct*>(RowStructConst);
+
+	// Check if row already exists
+	if (DataTable->FindRowUnchecked(FName(*RowName)))
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Row already exists: %s"), *RowName));
+	}
+
+	// Allocate and initialize new row data
+	void* NewRowData = FMemory::Malloc(RowStruct->GetStructureSize());
+	RowStruct->InitializeStruct(NewRowData);
+
+	// If row_data provided, populate the fields
+	const TSharedPtr<FJsonObject>* RowDataJson;
+	if (Params->TryGetObjectField(TEXT("row_data"), RowDataJson))
+	{
+		if (!JsonToRowStruct(*RowDataJson, RowStruct, NewRowData))
+		{
+			RowStruct->DestroyStruct(NewRowData);
+			FMemory::Free(NewRowData);
+			return CreateErrorResponse(TEXT("Failed to parse row_data"));
+		}
+	}
+
+	// Add the row to the DataTable
+	DataTable->AddRow(FName(*RowName), *(FTableRowBase*)NewRowData);
+
+	// Clean up our temporary allocation (AddRow copies the data)
+	RowStruct->DestroyStruct(NewRowData);
+	FMemory::Free(NewRowData);
+
+	DataTable->Modify();
+	DataTable->MarkPackageDirty();
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_name"), RowName);
+	Result->SetStringField(TEXT("message"), TEXT("Row added successfully"));
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteDataTableRow(const TSharedPtr<FJsonObject>& Params)
+{
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	FString RowName;
+	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+	}
+
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	// Check if row exists
+	if (!DataTable->FindRowUnchecked(FName(*RowName)))
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
+	}
+
+	// Remove the row
+	DataTable->RemoveRow(FName(*RowName));
+
+	DataTable->Modify();
+	DataTable->MarkPackageDirty();
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_name"), RowName);
+	Result->SetStringField(TEXT("message"), TEXT("Row deleted successfully"));
+
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetDataTableArrayElement(const TSharedPtr<FJsonObject>& Params)
+{
+	// Get required parameters
+	FString DataTablePath;
+	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	{
+		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+	}
+
+	FString RowName;
+	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+	}
+
+	FString ArrayFieldName;
+	if (!Params->TryGetStringField(TEXT("array_field"), ArrayFieldName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'array_field' parameter"));
+	}
+
+	int32 ElementIndex = -1;
+	if (!Params->TryGetNumberField(TEXT("element_index"), ElementIndex))
+	{
+		return CreateErrorResponse(TEXT("Missing 'element_index' parameter"));
+	}
+
+	FString ElementFieldName;
+	if (!Params->TryGetStringField(TEXT("element_field"), ElementFieldName))
+	{
+		return CreateErrorResponse(TEXT("Missing 'element_field' parameter"));
+	}
+
+	if (!Params->HasField(TEXT("value")))
+	{
+		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+	}
+
+	// Load the DataTable
+	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	if (!DataTable)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+	}
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!RowStruct)
+	{
+		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+	}
+
+	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
+	if (!RowData)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
+	}
+
+	// Find the array property
+	FProperty* ArrayProperty = const_cast<UScriptStruct*>(RowStruct)->FindPropertyByName(FName(*ArrayFieldName));
+	if (!ArrayProperty)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Array field not found: %s"), *ArrayFieldName));
+	}
+
+	FArrayProperty* ArrayProp = CastField<FArrayProperty>(ArrayProperty);
+	if (!ArrayProp)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Field '%s' is not an array"), *ArrayFieldName));
+	}
+
+	void* ArrayPtr = ArrayProperty->ContainerPtrToValuePtr<void>(RowData);
+	FScriptArrayHelper ArrayHelper(ArrayProp, ArrayPtr);
+
+	// Validate index
+	if (ElementIndex < 0 || ElementIndex >= ArrayHelper.Num())
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Element index %d out of range (array has %d elements)"), ElementIndex, ArrayHelper.Num()));
+	}
+
+	// Get element pointer
+	void* ElementPtr = ArrayHelper.GetRawPtr(ElementIndex);
+
+	// Check if inner property is a struct
+	FStructProperty* StructProp = CastField<FStructProperty>(ArrayProp->Inner);
+	if (!StructProp)
+	{
+		return CreateErrorResponse(TEXT("Array inner type is not a struct"));
+	}
+
+	UScriptStruct* ElementStruct = StructProp->Struct;
+
+	// Find the field within the struct element
+	FProperty* FieldProperty = ElementStruct->FindPropertyByName(FName(*ElementFieldName));
+	if (!FieldProperty)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Field '%s' not found in struct"), *ElementFieldName));
+	}
+
+	void* FieldPtr = FieldProperty->ContainerPtrToValuePtr<void>(ElementPtr);
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+
+	if (!JsonValueToProperty(JsonValue, FieldProperty, FieldPtr))
+	{
+		return CreateErrorResponse(FString::Printf(
+			TEXT("Failed to set field value. Field type: %s"),
+			*GetPropertyTypeName(FieldProperty)
+		));
+	}
+
+	// Mark dirty and notify
+	DataTable->Modify();
+	DataTable->MarkPackageDirty();
+	DataTable->HandleDataTableChanged(FName(*RowName));
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
+	Result->SetStringField(TEXT("row_name"), RowName);
+	Result->SetStringField(TEXT("array_field"), ArrayFieldName);
+	Result->SetNumberField(TEXT("element_index"), ElementIndex);
+	Result->SetStringField(TEXT("element_field"), ElementFieldName);
+	Result->SetStringField(TEXT("field_type"), GetPropertyTypeName(FieldProperty));
+	Result->SetField(TEXT("new_value"), PropertyToJsonValue(FieldProperty, FieldPtr));
+
+	return Result;
+}
+
+// ============================================================================
+// Bulk Actor Commands
+// ============================================================================
+
+// Packs raw floats as little-endian bytes and base64-encodes them.
+// All platforms this plugin builds for are little-endian, so this is a straight copy.
+static FString EncodeFloatsBase64(const TArray<float>& Values)
+{
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Packed float encoding assumes a little-endian host");
+	return FBase64::Encode(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(float));
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorTransformsBulk(const TSharedPtr<FJsonObject>& Params)
+{
+	// Optional filter using the same query language as find_actors_by_name
+	FEpicUnrealMCPActorFilter Filter;
+	FString FilterError;
+	if (!Filter.Compile(Params, FilterError))
+	{
+		return CreateErrorResponse(FilterError);
+	}
+
+	if (!ActorIndex->GetWorld())
+	{
+		return CreateErrorResponse(TEXT("No editor world available"));
+	}
+
+	const TArray<TWeakObjectPtr<AActor>>& Actors = ActorIndex->GetActors();
+	const bool bFiltered = !Filter.IsEmpty();
+	const int32 MaxResults = Filter.GetMaxResults();
+
+	// Column layout: one names table plus three packed float32 arrays of N*3 values
+	TArray<float> Locations;
+	TArray<float> Rotations;
+	TArray<float> Scales;
+	Locations.Reserve(Actors.Num() * 3);
+	Rotations.Reserve(Actors.Num() * 3);
+	Scales.Reserve(Actors.Num() * 3);
+
+	FString Names;
+	Names.Reserve(Actors.Num() * 24);
+
+	int32 Count = 0;
+	for (const TWeakObjectPtr<AActor>& ActorPtr : Actors)
+	{
+		AActor* Actor = ActorPtr.Get();
+		if (!IsValid(Actor) || (bFiltered && !Filter.Matches(Actor)))
+		{
+			continue;
+		}
+		if (MaxResults > 0 && Count >= MaxResults)
+		{
+			break;
+		}
+
+		const USceneComponent* Root = Actor->GetRootComponent();
+		const FTransform Transform = Root ? Root->GetComponentTransform() : FTransform::Identity;
+		const FVector Location = Transform.GetLocation();
+		const FRotator Rotation = Transform.Rotator();
+		const FVector Scale = Transform.GetScale3D();
+
+		Locations.Add(Location.X);
+		Locations.Add(Location.Y);
+		Locations.Add(Location.Z);
+		Rotations.Add(Rotation.Pitch);
+		Rotations.Add(Rotation.Yaw);
+		Rotations.Add(Rotation.Roll);
+		Scales.Add(Scale.X);
+		Scales.Add(Scale.Y);
+		Scales.Add(Scale.Z);
+
+		if (Count > 0)
+		{
+			Names.AppendChar(TEXT('\n'));
+		}
+		Names.Append(Actor->GetName());
+		++Count;
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("count"), Count);
+	Result->SetStringField(TEXT("encoding"), TEXT("base64_float32_le"));
+	Result->SetStringField(TEXT("names"), Names);
+	Result->SetStringField(TEXT("name_separator"), TEXT("\n"));
+	Result->SetStringField(TEXT("locations"), EncodeFloatsBase64(Locations));
+	Result->SetStringField(TEXT("rotations"), EncodeFloatsBase64(Rotations));
+	Result->SetStringField(TEXT("scales"), EncodeFloatsBase64(Scales));
+
+	return Result;
+}
+
+// Maps the spawn_actor type names onto their classes
+static UClass* ResolveBuiltinActorClass(const FString& ActorType)
+{
+	if (ActorType == TEXT("StaticMeshActor")) return AStaticMeshActor::StaticClass();
+	if (ActorType == TEXT("PointLight")) return APointLight::StaticClass();
+	if (ActorType == TEXT("SpotLight")) return ASpotLight::StaticClass();
+	if (ActorType == TEXT("DirectionalLight")) return ADirectionalLight::StaticClass();
+	if (ActorType == TEXT("CameraActor")) return ACameraActor::StaticClass();
+	return nullptr;
+}
+
+bool FEpicUnrealMCPEditorCommands::ParseSpawnSpec(const TSharedPtr<FJsonObject>& ItemJson, FEpicUnrealMCPSpawnSpec& OutSpec, FString& OutError)
+{
+	if (!ItemJson.IsValid())
+	{
+		OutError = TEXT("Spec is not an object");
+		return false;
+	}
+
+	ItemJson->TryGetStringField(TEXT("name"), OutSpec.Name);
+
+	// Each distinct path is only loaded once; repeats are asset cache hits
+	FString BlueprintPath;
+	FString ActorType;
+	FString ClassPath;
+	if (ItemJson->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	{
+		OutSpec.ActorClass = AssetCache->LoadBlueprintClass(BlueprintPath, AActor::StaticClass());
+		if (!OutSpec.ActorClass)
+		{
+			OutError = FString::Printf(TEXT("Failed to load Blueprint class: %s"), *BlueprintPath);
+			return false;
+		}
+	}
+	else if (ItemJson->TryGetStringField(TEXT("type"), ActorType))
+	{
+		OutSpec.ActorClass = ResolveBuiltinActorClass(ActorType);
+		if (!OutSpec.ActorClass)
+		{
+			OutError = FString::Printf(TEXT("Unknown actor type: %s"), *ActorType);
+			return false;
+		}
+	}
+	else if (ItemJson->TryGetStringField(TEXT("class"), ClassPath))
+	{
+		// Full class path as written by capture_prefab, e.g. /Script/Engine.StaticMeshActor
+		UClass* Class = AssetCache->Load<UClass>(ClassPath);
+		OutSpec.ActorClass = Class && Class->IsChildOf(AActor::StaticClass()) ? Class : nullptr;
+		if (!OutSpec.ActorClass)
+		{
+			OutError = FString::Printf(TEXT("Unknown actor class: %s"), *ClassPath);
+			return false;
+		}
+	}
+	else
+	{
+		OutError = TEXT("Missing 'type', 'blueprint_path' or 'class'");
+		return false;
+	}
+
+	FString MeshPath;
+	if (ItemJson->TryGetStringField(TEXT("static_mesh"), MeshPath) && !MeshPath.IsEmpty())
+	{
+		OutSpec.StaticMesh = AssetCache->Load<UStaticMesh>(MeshPath);
+		if (!OutSpec.StaticMesh)
+		{
+			OutError = FString::Printf(TEXT("Could not find static mesh at path: %s"), *MeshPath);
+			return false;
+		}
+	}
+
+	// 'material' is shorthand for slot 0; 'materials' lists every slot, null keeps the default
+	FString MaterialPath;
+	const TArray<TSharedPtr<FJsonValue>>* MaterialsJson;
+	if (ItemJson->TryGetArrayField(TEXT("materials"), MaterialsJson))
+	{
+		for (const TSharedPtr<FJsonValue>& MaterialValue : *MaterialsJson)
+		{
+			UMaterialInterface* Material = nullptr;
+			if (MaterialValue.IsValid() && MaterialValue->TryGetString(MaterialPath) && !MaterialPath.IsEmpty())
+			{
+				Material = AssetCache->Load<UMaterialInterface>(MaterialPath);
+				if (!Material)
+				{
+					OutError = FString::Printf(TEXT("Could not find material at path: %s"), *MaterialPath);
+					return false;
+				}
+			}
+			OutSpec.Materials.Add(Material);
+		}
+	}
+	else if (ItemJson->TryGetStringField(TEXT("material"), MaterialPath) && !MaterialPath.IsEmpty())
+	{
+		UMaterialInterface* Material = AssetCache->Load<UMaterialInterface>(MaterialPath);
+		if (!Material)
+		{
+			OutError = FString::Printf(TEXT("Could not find material at path: %s"), *MaterialPath);
+			return false;
+		}
+		OutSpec.Materials.Add(Material);
+	}
+
+	const TSharedPtr<FJsonObject>* PropertiesJson;
+	if (ItemJson->TryGetObjectField(TEXT("properties"), PropertiesJson))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*PropertiesJson)->Values)
+		{
+			OutSpec.PropertyValues.Add(FName(*Property.Key), Property.Value->AsString());
+		}
+	}
+
+	FVector Scale(1.0f, 1.0f, 1.0f);
+	if (ItemJson->HasField(TEXT("scale")))
+	{
+		Scale = GetVectorFromJson(ItemJson, TEXT("scale"));
+	}
+	OutSpec.Transform = FTransform(GetRotatorFromJson(ItemJson, TEXT("rotation")), GetVectorFromJson(ItemJson, TEXT("location")), Scale);
+
+	FString Folder;
+	if (ItemJson->TryGetStringField(TEXT("folder"), Folder))
+	{
+		OutSpec.FolderPath = FName(*Folder);
+	}
+
+	return true;
+}
+
+// Identifies an instance group by mesh plus material overrides (trailing empty slots ignored)
+static FString MakeInstanceGroupKey(const UStaticMesh* Mesh, const TArray<UMaterialInterface*>& Materials)
+{
+	int32 NumSlots = Materials.Num();
+	while (NumSlots > 0 && !Materials[NumSlots - 1])
+	{
+		--NumSlots;
+	}
+
+	FString GroupKey = Mesh->GetPathName();
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		GroupKey += TEXT("|");
+		GroupKey += Materials[Slot] ? Materials[Slot]->GetPathName() : TEXT("None");
+	}
+	return GroupKey;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FEpicUnrealMCPEditorCommands::FindOrCreateInstanceGroup(UWorld* World, UStaticMesh* Mesh,
+	const TArray<UMaterialInterface*>& Materials)
+{
+	// Deterministic name so later requests append to the same group instead of creating another
+	const FString GroupKey = MakeInstanceGroupKey(Mesh, Materials);
+	const FName GroupName(*FString::Printf(TEXT("MCP_Instances_%s_%08X"), *Mesh->GetName(), FCrc::StrCrc32(*GroupKey)));
+
+	if (AActor* ExistingActor = ActorIndex->FindByName(GroupName))
+	{
+		UHierarchicalInstancedStaticMeshComponent* Existing = ExistingActor->FindComponentByClass<UHierarchicalInstancedStaticMeshComponent>();
+		return Existing && Existing->GetStaticMesh() == Mesh ? Existing : nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = GroupName;
+	AActor* GroupActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!GroupActor)
+	{
+		return nullptr;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Instances = NewObject<UHierarchicalInstancedStaticMeshComponent>(GroupActor, TEXT("Instances"), RF_Transactional);
+	Instances->SetMobility(EComponentMobility::Static);
+	Instances->SetStaticMesh(Mesh);
+	for (int32 Slot = 0; Slot < Materials.Num(); ++Slot)
+	{
+		if (Materials[Slot])
+		{
+			Instances->SetMaterial(Slot, Materials[Slot]);
+		}
+	}
+
+	// New groups sit at the origin, but a reused one may have been moved; callers convert with ToInstanceSpace
+	GroupActor->SetRootComponent(Instances);
+	GroupActor->AddInstanceComponent(Instances);
+	Instances->RegisterComponent();
+	GroupActor->SetActorLabel(GroupName.ToString());
+	GroupActor->SetFolderPath(TEXT("MCP_Instances"));
+
+	return Instances;
+}
+
+// AddInstances takes component-space transforms, so world transforms are made relative to the group
+static void ToInstanceSpace(const UHierarchicalInstancedStaticMeshComponent* Group, TArray<FTransform>& Transforms)
+{
+	const FTransform GroupTransform = Group->GetComponentTransform();
+	if (GroupTransform.Equals(FTransform::Identity))
+	{
+		return;
+	}
+	for (FTransform& Transform : Transforms)
+	{
+		Transform = Transform.GetRelativeTransform(GroupTransform);
+	}
+}
+
+// Imports exported-text values (as produced by capture_prefab or a world snapshot) onto an actor.
+// Values equal to their entry in CurrentValues are skipped; OnImported sees every property written.
+static void ApplyPropertyValues(AActor* Actor, const TMap<FName, FString>& PropertyValues,
+	const TMap<FName, FString>* CurrentValues = nullptr, TFunction<void(FProperty*)> OnImported = nullptr)
+{
+	for (const TPair<FName, FString>& Entry : PropertyValues)
+	{
+		const FString* CurrentValue = CurrentValues ? CurrentValues->Find(Entry.Key) : nullptr;
+		if (CurrentValue && *CurrentValue == Entry.Value)
+		{
+			continue;
+		}
+
+		FProperty* Property = FindFProperty<FProperty>(Actor->GetClass(), Entry.Key);
+		if (!Property)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: %s has no property '%s'"), *Actor->GetClass()->GetName(), *Entry.Key.ToString());
+			continue;
+		}
+
+		if (!Property->ImportText(*Entry.Value, Property->ContainerPtrToValuePtr<void>(Actor), PPF_None, Actor))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Failed to import '%s' into %s.%s"), *Entry.Value, *Actor->GetName(), *Entry.Key.ToString());
+			continue;
+		}
+		if (OnImported)
+		{
+			OnImported(Property);
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::SpawnActorBatch(UWorld* World, const TArray<FEpicUnrealMCPSpawnSpec>& Specs,
+	const TArray<FString>& SpecErrors, bool bUniqueNames, bool bInstanced)
+{
+	TArray<TSharedPtr<FJsonValue>> Results;
+	TArray<TSharedPtr<FJsonValue>> InstanceIndices;
+	TArray<TSharedPtr<FJsonValue>> Errors;
+	TArray<TSharedPtr<FJsonValue>> Warnings;
+	Results.Init(MakeShared<FJsonValueNull>(), Specs.Num());
+	if (bInstanced)
+	{
+		InstanceIndices.Init(MakeShared<FJsonValueNull>(), Specs.Num());
+	}
+	int32 NumSpawned = 0;
+
+	auto AddError = [&Errors](int32 Index, const FString& Message)
+	{
+		TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+		ErrorObj->SetNumberField(TEXT("index"), Index);
+		ErrorObj->SetStringField(TEXT("error"), Message);
+		Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+	};
+
+	// Selection changes, package dirtying and the redraw are flushed once when the scope ends
+	FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+	// Pass 1: spawn everything with construction deferred; plain mesh specs are bucketed for instancing
+	TArray<TPair<AActor*, int32>> Deferred;
+	Deferred.Reserve(Specs.Num());
+	TSet<FName> BatchNames;
+	TMap<FString, TArray<int32>> InstanceBuckets;
+
+	for (int32 Index = 0; Index < Specs.Num(); ++Index)
+	{
+		if (!SpecErrors[Index].IsEmpty())
+		{
+			AddError(Index, SpecErrors[Index]);
+			continue;
+		}
+
+		const FEpicUnrealMCPSpawnSpec& Spec = Specs[Index];
+
+		// Property overrides need a real actor, so only plain mesh specs become instances
+		if (bInstanced && Spec.StaticMesh && Spec.ActorClass == AStaticMeshActor::StaticClass() && Spec.PropertyValues.Num() == 0)
+		{
+			InstanceBuckets.FindOrAdd(MakeInstanceGroupKey(Spec.StaticMesh, Spec.Materials)).Add(Index);
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bDeferConstruction = true;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		if (!Spec.Name.IsEmpty())
+		{
+			FName RequestedName(*Spec.Name);
+			if (BatchNames.Contains(RequestedName) || ActorIndex->FindByName(RequestedName))
+			{
+				if (!bUniqueNames)
+				{
+					AddError(Index, FString::Printf(TEXT("Actor with name '%s' already exists"), *Spec.Name));
+					continue;
+				}
+				RequestedName = MakeUniqueObjectName(World->GetCurrentLevel(), Spec.ActorClass, RequestedName);
+			}
+			SpawnParams.Name = RequestedName;
+			BatchNames.Add(RequestedName);
+		}
+
+		AActor* NewActor = World->SpawnActor(Spec.ActorClass, &Spec.Transform, SpawnParams);
+		if (!NewActor)
+		{
+			AddError(Index, TEXT("Failed to create actor"));
+			continue;
+		}
+
+		// Assign the mesh before construction runs so it only runs once with the final state
+		if (Spec.StaticMesh)
+		{
+			if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(NewActor))
+			{
+				MeshActor->GetStaticMeshComponent()->SetStaticMesh(Spec.StaticMesh);
+				for (int32 Slot = 0; Slot < Spec.Materials.Num(); ++Slot)
+				{
+					if (Spec.Materials[Slot])
+					{
+						MeshActor->GetStaticMeshComponent()->SetMaterial(Slot, Spec.Materials[Slot]);
+					}
+				}
+			}
+		}
+
+		if (Spec.PropertyValues.Num() > 0)
+		{
+			ApplyPropertyValues(NewActor, Spec.PropertyValues);
+		}
+
+		if (!Spec.FolderPath.IsNone())
+		{
+			NewActor->SetFolderPath(Spec.FolderPath);
+		}
+
+		Deferred.Emplace(NewActor, Index);
+		Results[Index] = MakeShared<FJsonValueString>(NewActor->GetName());
+	}
+
+	// Pass 2: run construction for the whole batch
+	for (const TPair<AActor*, int32>& Entry : Deferred)
+	{
+		Entry.Key->FinishSpawning(Specs[Entry.Value].Transform);
+	}
+	NumSpawned += Deferred.Num();
+
+	// Pass 3: one AddInstances call per mesh/material group
+	for (const TPair<FString, TArray<int32>>& Bucket : InstanceBuckets)
+	{
+		const FEpicUnrealMCPSpawnSpec& FirstSpec = Specs[Bucket.Value[0]];
+		UHierarchicalInstancedStaticMeshComponent* Group = FindOrCreateInstanceGroup(World, FirstSpec.StaticMesh, FirstSpec.Materials);
+		if (!Group)
+		{
+			for (int32 Index : Bucket.Value)
+			{
+				AddError(Index, TEXT("Failed to create instance group"));
+			}
+			continue;
+		}
+
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(Bucket.Value.Num());
+		for (int32 Index : Bucket.Value)
+		{
+			const FEpicUnrealMCPSpawnSpec& Spec = Specs[Index];
+			Transforms.Add(Spec.Transform);
+
+			// Instances have no name or outliner folder of their own, so say so instead of dropping them silently
+			TArray<TSharedPtr<FJsonValue>> Ignored;
+			if (!Spec.Name.IsEmpty())
+			{
+				Ignored.Add(MakeShared<FJsonValueString>(TEXT("name")));
+			}
+			if (!Spec.FolderPath.IsNone())
+			{
+				Ignored.Add(MakeShared<FJsonValueString>(TEXT("folder")));
+			}
+			if (Ignored.Num() > 0)
+			{
+				TSharedPtr<FJsonObject> WarningObj = MakeShared<FJsonObject>();
+				WarningObj->SetNumberField(TEXT("index"), Index);
+				WarningObj->SetArrayField(TEXT("ignored"), Ignored);
+				WarningObj->SetStringField(TEXT("warning"), TEXT("Spawned as an instance; per-actor name and folder do not apply"));
+				Warnings.Add(MakeShared<FJsonValueObject>(WarningObj));
+			}
+		}
+		ToInstanceSpace(Group, Transforms);
+
+		// Recorded so undoing the request also removes the new instances
+		Group->Modify(false);
+		const TArray<int32> NewIndices = Group->AddInstances(Transforms, true);
+		const FString GroupName = Group->GetOwner()->GetName();
+		for (int32 Slot = 0; Slot < Bucket.Value.Num() && Slot < NewIndices.Num(); ++Slot)
+		{
+			Results[Bucket.Value[Slot]] = MakeShared<FJsonValueString>(GroupName);
+			InstanceIndices[Bucket.Value[Slot]] = MakeShared<FJsonValueNumber>(NewIndices[Slot]);
+		}
+		NumSpawned += NewIndices.Num();
+	}
+
+	if (NumSpawned > 0)
+	{
+		BulkEdit->NotifyPackageDirty(World->GetCurrentLevel());
+		BulkEdit->RequestRedraw();
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("spawned"), NumSpawned);
+	Result->SetNumberField(TEXT("failed"), Errors.Num());
+	Result->SetArrayField(TEXT("names"), Results);
+	if (bInstanced)
+	{
+		Result->SetArrayField(TEXT("instance_indices"), InstanceIndices);
+		Result->SetArrayField(TEXT("warnings"), Warnings);
+	}
+	Result->SetArrayField(TEXT("errors"), Errors);
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::SpawnInstancedActor(const TSharedPtr<FJsonObject>& Params)
+{
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
+	}
+
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.SetNum(1);
+	SpecErrors.SetNum(1);
+
+	if (!ParseSpawnSpec(Params, Specs[0], SpecErrors[0]))
+	{
+		return CreateErrorResponse(SpecErrors[0]);
+	}
+	if (Specs[0].ActorClass != AStaticMeshActor::StaticClass() || !Specs[0].StaticMesh)
+	{
+		return CreateErrorResponse(TEXT("Instanced spawning requires type 'StaticMeshActor' and a 'static_mesh'"));
+	}
+
+	TSharedPtr<FJsonObject> BatchResult = SpawnActorBatch(World, Specs, SpecErrors, false, true);
+	const TArray<TSharedPtr<FJsonValue>>& Names = BatchResult->GetArrayField(TEXT("names"));
+	if (Names[0]->IsNull())
+	{
+		return CreateErrorResponse(TEXT("Failed to create instance group"));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("name"), Names[0]->AsString());
+	Result->SetNumberField(TEXT("instance_index"), BatchResult->GetArrayField(TEXT("instance_indices"))[0]->AsNumber());
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActors(const TSharedPtr<FJsonObject>& Params)
+{
+	const TArray<TSharedPtr<FJsonValue>>* ActorsJson;
+	if (!Params->TryGetArrayField(TEXT("actors"), ActorsJson))
+	{
+		return CreateErrorResponse(TEXT("Missing 'actors' parameter"));
+	}
+
+	bool bUniqueNames = false;
+	Params->TryGetBoolField(TEXT("unique_names"), bUniqueNames);
+
+	bool bInstanced = false;
+	Params->TryGetBoolField(TEXT("instanced"), bInstanced);
+
+	// Stream in every distinct unloaded class/mesh/material first instead of blocking per spec
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		for (const TSharedPtr<FJsonValue>& ItemValue : *ActorsJson)
+		{
+			if (ItemValue.IsValid() && ItemValue->Type == EJson::Object)
+			{
+				CollectSpawnAssetPaths(ItemValue->AsObject(), AssetPaths);
+			}
+		}
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("spawn_actors"), Params, AssetPaths))
+		{
+			return Pending;
+		}
+	}
+
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
+	}
+
+	// Resolve every class and mesh up front, before any actor is spawned
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.SetNum(ActorsJson->Num());
+	SpecErrors.SetNum(ActorsJson->Num());
+
+	for (int32 Index = 0; Index < ActorsJson->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonValue>& ItemValue = (*ActorsJson)[Index];
+		const TSharedPtr<FJsonObject> ItemJson = ItemValue.IsValid() && ItemValue->Type == EJson::Object ? ItemValue->AsObject() : nullptr;
+		ParseSpawnSpec(ItemJson, Specs[Index], SpecErrors[Index]);
+	}
+
+	return SpawnActorBatch(World, Specs, SpecErrors, bUniqueNames, bInstanced);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleConvertToInstances(const TSharedPtr<FJsonObject>& Params)
+{
+	FEpicUnrealMCPActorFilter Filter;
+	FString FilterError;
+	if (!Filter.Compile(Params, FilterError))
+	{
+		return CreateErrorResponse(FilterError);
+	}
+
+	// Refuse to silently collapse the whole level
+	if (Filter.IsEmpty())
+	{
+		return CreateErrorResponse(TEXT("convert_to_instances needs at least one filter field (pattern, class, tags, folder or bounds)"));
+	}
+
+	bool bKeepSource = false;
+	Params->TryGetBoolField(TEXT("keep_source"), bKeepSource);
+
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
+	}
+
+	// Collect first; destroying actors while walking the index would reshuffle it
+	struct FInstanceBucket
+	{
+		UStaticMesh* Mesh = nullptr;
+		TArray<UMaterialInterface*> Materials;
+		TArray<AStaticMeshActor*> Sources;
+	};
+	TMap<FString, FInstanceBucket> Buckets;
+	const int32 MaxResults = Filter.GetMaxResults();
+	int32 NumMatched = 0;
+
+	for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
+	{
+		AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(ActorPtr.Get());
+		if (!IsValid(MeshActor) || !Filter.Matches(MeshActor))
+		{
+			continue;
+		}
+
+		UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
+		UStaticMesh* Mesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+		if (!Mesh)
+		{
+			continue;
+		}
+
+		const FString GroupKey = MakeInstanceGroupKey(Mesh, MeshComponent->OverrideMaterials);
+		FInstanceBucket& Bucket = Buckets.FindOrAdd(GroupKey);
+		if (!Bucket.Mesh)
+		{
+			Bucket.Mesh = Mesh;
+			Bucket.Materials = MeshComponent->OverrideMaterials;
+		}
+		Bucket.Sources.Add(MeshActor);
+
+		if (MaxResults > 0 && ++NumMatched >= MaxResults)
+		{
+			break;
+		}
+	}
+
+	// Selection changes, package dirtying and the redraw are flushed once when the scope ends
+	FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+	TArray<TSharedPtr<FJsonValue>> GroupsJson;
+	TArray<TSharedPtr<FJsonValue>> ConvertedJson;
+	TArray<TSharedPtr<FJsonValue>> Errors;
+
+	for (const TPair<FString, FInstanceBucket>& Entry : Buckets)
+	{
+		const FInstanceBucket& Bucket = Entry.Value;
+
+		UHierarchicalInstancedStaticMeshComponent* Group = FindOrCreateInstanceGroup(World, Bucket.Mesh, Bucket.Materials);
+		if (!Group)
+		{
+			TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+			ErrorObj->SetStringField(TEXT("mesh"), Bucket.Mesh->GetPathName());
+			ErrorObj->SetStringField(TEXT("error"), TEXT("Failed to create instance group"));
+			Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+			continue;
+		}
+
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(Bucket.Sources.Num());
+		for (AStaticMeshActor* Source : Bucket.Sources)
+		{
+			Transforms.Add(Source->GetStaticMeshComponent()->GetComponentTransform());
+		}
+		ToInstanceSpace(Group, Transforms);
+
+		// Recorded so undoing the request also removes the new instances
+		Group->Modify(false);
+		const TArray<int32> NewIndices = Group->AddInstances(Transforms, true);
+		const FString GroupName = Group->GetOwner()->GetName();
+
+		for (int32 Slot = 0; Slot < Bucket.Sources.Num() && Slot < NewIndices.Num(); ++Slot)
+		{
+			AStaticMeshActor* Source = Bucket.Sources[Slot];
+
+			TSharedPtr<FJsonObject> ConvertedObj = MakeShared<FJsonObject>();
+			ConvertedObj->SetStringField(TEXT("source"), Source->GetName());
+			ConvertedObj->SetStringField(TEXT("group"), GroupName);
+			ConvertedObj->SetNumberField(TEXT("index"), NewIndices[Slot]);
+			ConvertedJson.Add(MakeShared<FJsonValueObject>(ConvertedObj));
+
+			if (!bKeepSource)
+			{
+				World->EditorDestroyActor(Source, true);
+			}
+		}
+
+		TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
+		GroupObj->SetStringField(TEXT("actor"), GroupName);
+		GroupObj->SetStringField(TEXT("mesh"), Bucket.Mesh->GetPathName());
+		GroupObj->SetNumberField(TEXT("added"), NewIndices.Num());
+		GroupObj->SetNumberField(TEXT("instance_count"), Group->GetInstanceCount());
+		GroupsJson.Add(MakeShared<FJsonValueObject>(GroupObj));
+	}
+
+	if (ConvertedJson.Num() > 0)
+	{
+		BulkEdit->NotifyPackageDirty(World->GetCurrentLevel());
+		BulkEdit->RequestRedraw();
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("converted_count"), ConvertedJson.Num());
+	Result->SetBoolField(TEXT("kept_source"), bKeepSource);
+	Result->SetArrayField(TEXT("groups"), GroupsJson);
+	Result->SetArrayField(TEXT("converted"), ConvertedJson);
+	Result->SetArrayField(TEXT("errors"), Errors);
+	return Result;
+}
+
+// Reads [X, Y, Z] or a single number (applied to all three axes)
+static bool TryGetScaleFromJson(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, FVector& OutScale)
+{
+	double Uniform = 0.0;
+	if (Json->TryGetNumberField(FieldName, Uniform))
+	{
+		OutScale = FVector(Uniform);
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
+	if (Json->TryGetArrayField(FieldName, ArrayValue) && ArrayValue->Num() >= 3)
+	{
+		OutScale = FVector((*ArrayValue)[0]->AsNumber(), (*ArrayValue)[1]->AsNumber(), (*ArrayValue)[2]->AsNumber());
+		return true;
+	}
+	return false;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransforms(const TSharedPtr<FJsonObject>& Params)
+{
+	if (!ActorIndex->GetWorld())
+	{
+		return CreateErrorResponse(TEXT("No editor world available"));
+	}
+
+	TArray<AActor*> Targets;
+	TArray<FTransform> Transforms;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+
+	const TArray<TSharedPtr<FJsonValue>>* ItemsJson;
+	const TSharedPtr<FJsonObject>* OperationJson;
+	if (Params->TryGetArrayField(TEXT("actors"), ItemsJson))
+	{
+		// Per-actor mode: absolute values, or offsets when 'delta' is set
+		bool bDelta = false;
+		Params->TryGetBoolField(TEXT("delta"), bDelta);
+
+		Targets.Reserve(ItemsJson->Num());
+		Transforms.Reserve(ItemsJson->Num());
+		for (const TSharedPtr<FJsonValue>& ItemValue : *ItemsJson)
+		{
+			const TSharedPtr<FJsonObject>* ItemJson;
+			FString ActorName;
+			if (!ItemValue.IsValid() || !ItemValue->TryGetObject(ItemJson) || !(*ItemJson)->TryGetStringField(TEXT("name"), ActorName))
+			{
+				return CreateErrorResponse(TEXT("Each 'actors' entry must be an object with a 'name'"));
+			}
+
+			AActor* Actor = ActorIndex->FindByName(ActorName);
+			if (!IsValid(Actor))
+			{
+				Missing.Add(MakeShared<FJsonValueString>(ActorName));
+				continue;
+			}
+
+			FTransform Transform = Actor->GetActorTransform();
+			if ((*ItemJson)->HasField(TEXT("location")))
+			{
+				const FVector Location = GetVectorFromJson(*ItemJson, TEXT("location"));
+				Transform.SetLocation(bDelta ? Transform.GetLocation() + Location : Location);
+			}
+			if ((*ItemJson)->HasField(TEXT("rotation")))
+			{
+				const FQuat Rotation(GetRotatorFromJson(*ItemJson, TEXT("rotation")));
+				Transform.SetRotation(bDelta ? Rotation * Transform.GetRotation() : Rotation);
+			}
+			FVector Scale;
+			if (TryGetScaleFromJson(*ItemJson, TEXT("scale"), Scale))
+			{
+				Transform.SetScale3D(bDelta ? Transform.GetScale3D() * Scale : Scale);
+			}
+
+			Targets.Add(Actor);
+			Transforms.Add(Transform);
+		}
+	}
+	else if (Params->TryGetObjectField(TEXT("operation"), OperationJson))
+	{
+		// Group mode: explicit 'names', or the same filter as find_actors_by_name
+		FString QueryError;
+		if (!CollectActorsByQuery(Params, Targets, Missing, QueryError))
+		{
+			return CreateErrorResponse(QueryError);
+		}
+
+		// Gather into one contiguous array so the pass below is a straight loop over SIMD transforms
+		Transforms.Reserve(Targets.Num());
+		FBox Bounds(ForceInit);
+		FVector Centroid = FVector::ZeroVector;
+		for (AActor* Actor : Targets)
+		{
+			Transforms.Add(Actor->GetActorTransform());
+			Bounds += Transforms.Last().GetLocation();
+			Centroid += Transforms.Last().GetLocation();
+		}
+		if (Targets.Num() > 0)
+		{
+			Centroid /= Targets.Num();
+		}
+
+		FString Operation;
+		if (!(*OperationJson)->TryGetStringField(TEXT("type"), Operation))
+		{
+			return CreateErrorResponse(TEXT("Operation is missing 'type' (translate, rotate, scale or mirror)"));
+		}
+
+		// Pivot defaults to the center of the group's location bounds
+		FVector Pivot = Bounds.IsValid ? Bounds.GetCenter() : FVector::ZeroVector;
+		FString PivotMode;
+		if ((*OperationJson)->TryGetStringField(TEXT("pivot"), PivotMode))
+		{
+			if (PivotMode == TEXT("centroid"))
+			{
+				Pivot = Centroid;
+			}
+			else if (PivotMode != TEXT("center"))
+			{
+				return CreateErrorResponse(FString::Printf(TEXT("Unknown pivot: %s (use center, centroid or [X, Y, Z])"), *PivotMode));
+			}
+		}
+		else if ((*OperationJson)->HasField(TEXT("pivot")))
+		{
+			Pivot = GetVectorFromJson(*OperationJson, TEXT("pivot"));
+		}
+
+		if (Operation == TEXT("translate"))
+		{
+			const FVector Offset = GetVectorFromJson(*OperationJson, TEXT("offset"));
+			for (FTransform& Transform : Transforms)
+			{
+				Transform.AddToTranslation(Offset);
+			}
+		}
+		else if (Operation == TEXT("rotate"))
+		{
+			// One composed pivot transform, applied to every actor with a single multiply
+			const FTransform Delta = FTransform(-Pivot) * FTransform(GetRotatorFromJson(*OperationJson, TEXT("rotation"))) * FTransform(Pivot);
+			for (FTransform& Transform : Transforms)
+			{
+				Transform = Transform * Delta;
+			}
+		}
+		else if (Operation == TEXT("scale"))
+		{
+			// Like the editor's group scale: spread locations from the pivot and scale each actor in place
+			FVector Scale;
+			if (!TryGetScaleFromJson(*OperationJson, TEXT("scale"), Scale))
+			{
+				return CreateErrorResponse(TEXT("Scale operation needs 'scale' as a number or [X, Y, Z]"));
+			}
+			for (FTransform& Transform : Transforms)
+			{
+				Transform.SetLocation(Pivot + (Transform.GetLocation() - Pivot) * Scale);
+				Transform.SetScale3D(Transform.GetScale3D() * Scale);
+			}
+		}
+		else if (Operation == TEXT("mirror"))
+		{
+			// Reflect through the plane at the pivot; FTransform absorbs the negative determinant into scale
+			FVector Normal = FVector(1.0f, 0.0f, 0.0f);
+			if ((*OperationJson)->HasField(TEXT("plane_normal")))
+			{
+				Normal = GetVectorFromJson(*OperationJson, TEXT("plane_normal"));
+			}
+			if (!Normal.Normalize())
+			{
+				return CreateErrorResponse(TEXT("Mirror plane_normal must not be zero"));
+			}
+
+			FMatrix Reflection = FMatrix::Identity;
+			for (int32 Row = 0; Row < 3; ++Row)
+			{
+				for (int32 Column = 0; Column < 3; ++Column)
+				{
+					Reflection.M[Row][Column] -= 2.0f * Normal[Row] * Normal[Column];
+				}
+			}
+			const FMatrix Delta = FTranslationMatrix(-Pivot) * Reflection * FTranslationMatrix(Pivot);
+			for (FTransform& Transform : Transforms)
+			{
+				Transform.SetFromMatrix(Transform.ToMatrixWithScale() * Delta);
+			}
+		}
+		else
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Unknown operation: %s"), *Operation));
+		}
+	}
+	else
+	{
+		return CreateErrorResponse(TEXT("Provide 'actors' (per-actor transforms) or 'operation' (group operation)"));
+	}
+
+	// Apply everything inside one scope so PostEditMove, dirtying and the redraw are flushed once
+	{
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+		for (int32 Index = 0; Index < Targets.Num(); ++Index)
+		{
+			AActor* Actor = Targets[Index];
+			// Modify(false) records undo without dirtying; the package is dirtied once by the flush
+			Actor->Modify(false);
+			Actor->SetActorTransform(Transforms[Index]);
+			BulkEdit->NotifyActorMoved(Actor);
+			BulkEdit->NotifyPackageDirty(Actor);
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("moved"), Targets.Num());
+	Result->SetArrayField(TEXT("missing"), Missing);
+	return Result;
+}
+
+bool FEpicUnrealMCPEditorCommands::CollectActorsByQuery(const TSharedPtr<FJsonObject>& Params, TArray<AActor*>& OutActors,
+	TArray<TSharedPtr<FJsonValue>>& OutMissing, FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* NamesJson;
+	if (Params->TryGetArrayField(TEXT("names"), NamesJson))
+	{
+		OutActors.Reserve(NamesJson->Num());
+		for (const TSharedPtr<FJsonValue>& NameValue : *NamesJson)
+		{
+			const FString ActorName = NameValue->AsString();
+			AActor* Actor = ActorIndex->FindByName(ActorName);
+			if (IsValid(Actor))
+			{
+				OutActors.AddUnique(Actor);
+			}
+			else
+			{
+				OutMissing.Add(MakeShared<FJsonValueString>(ActorName));
+			}
+		}
+		return true;
+	}
+
+	FEpicUnrealMCPActorFilter Filter;
+	if (!Filter.Compile(Params, OutError))
+	{
+		return false;
+	}
+
+	// Refuse to silently act on the whole level
+	if (Filter.IsEmpty())
+	{
+		OutError = TEXT("Provide 'names' or at least one filter field (pattern, class, tags, folder or bounds)");
+		return false;
+	}
+
+	const int32 MaxResults = Filter.GetMaxResults();
+	for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
+	{
+		AActor* Actor = ActorPtr.Get();
+		if (IsValid(Actor) && Filter.Matches(Actor))
+		{
+			OutActors.Add(Actor);
+			if (MaxResults > 0 && OutActors.Num() >= MaxResults)
+			{
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+// Counts per class name, for dry-run summaries
+static TSharedPtr<FJsonObject> CountActorsByClass(const TArray<AActor*>& Actors)
+{
+	TMap<FString, int32> Counts;
+	for (const AActor* Actor : Actors)
+	{
+		++Counts.FindOrAdd(Actor->GetClass()->GetName());
+	}
+
+	TSharedPtr<FJsonObject> CountsJson = MakeShared<FJsonObject>();
+	for (const TPair<FString, int32>& Entry : Counts)
+	{
+		CountsJson->SetNumberField(Entry.Key, Entry.Value);
+	}
+	return CountsJson;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActors(const TSharedPtr<FJsonObject>& Params)
+{
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("No editor world available"));
+	}
+
+	TArray<AActor*> Matches;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	FString QueryError;
+	if (!CollectActorsByQuery(Params, Matches, Missing, QueryError))
+	{
+		return CreateErrorResponse(QueryError);
+	}
+
+	// World settings and the builder brush belong to the level and cannot be deleted
+	TArray<AActor*> Targets;
+	TArray<TSharedPtr<FJsonValue>> Skipped;
+	Targets.Reserve(Matches.Num());
+	for (AActor* Actor : Matches)
+	{
+		if (Actor->IsA<AWorldSettings>() || FActorEditorUtils::IsABuilderBrush(Actor))
+		{
+			Skipped.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+			continue;
+		}
+		Targets.Add(Actor);
+	}
+
+	bool bDryRun = false;
+	Params->TryGetBoolField(TEXT("dry_run"), bDryRun);
+
+	bool bReturnNames = false;
+	Params->TryGetBoolField(TEXT("return_names"), bReturnNames);
+
+	TArray<TSharedPtr<FJsonValue>> NamesJson;
+	if (bReturnNames)
+	{
+		NamesJson.Reserve(Targets.Num());
+		for (AActor* Actor : Targets)
+		{
+			NamesJson.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("dry_run"), bDryRun);
+	Result->SetObjectField(TEXT("classes"), CountActorsByClass(Targets));
+
+	if (!bDryRun && Targets.Num() > 0)
+	{
+		// HandleCommand's transaction makes this one undo step; notifications are flushed once at the end
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+		int32 NumDeleted = 0;
+		for (AActor* Actor : Targets)
+		{
+			if (GEditor && Actor->IsSelected())
+			{
+				GEditor->SelectActor(Actor, false, false);
+			}
+			if (World->EditorDestroyActor(Actor, true))
+			{
+				++NumDeleted;
+			}
+		}
+
+		BulkEdit->NotifyPackageDirty(World->GetCurrentLevel());
+		BulkEdit->RequestRedraw();
+		Result->SetNumberField(TEXT("deleted"), NumDeleted);
+	}
+
+	Result->SetNumberField(TEXT("count"), Targets.Num());
+	if (bReturnNames)
+	{
+		Result->SetArrayField(TEXT("names"), NamesJson);
+	}
+	Result->SetArrayField(TEXT("skipped"), Skipped);
+	Result->SetArrayField(TEXT("missing"), Missing);
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorsFolder(const TSharedPtr<FJsonObject>& Params)
+{
+	// 'folder' is already a filter field, so the destination has its own name; empty moves to the root
+	FString NewFolder;
+	if (!Params->TryGetStringField(TEXT("new_folder"), NewFolder))
+	{
+		return CreateErrorResponse(TEXT("Missing 'new_folder' parameter"));
+	}
+
+	TArray<AActor*> Matches;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	FString QueryError;
+	if (!CollectActorsByQuery(Params, Matches, Missing, QueryError))
+	{
+		return CreateErrorResponse(QueryError);
+	}
+
+	// Actors already in the destination are left untouched so they do not enter the transaction
+	const FName FolderPath(*NewFolder);
+	TArray<AActor*> Targets;
+	Targets.Reserve(Matches.Num());
+	for (AActor* Actor : Matches)
+	{
+		if (Actor->GetFolderPath() != FolderPath)
+		{
+			Targets.Add(Actor);
+		}
+	}
+
+	bool bDryRun = false;
+	Params->TryGetBoolField(TEXT("dry_run"), bDryRun);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("dry_run"), bDryRun);
+	Result->SetStringField(TEXT("new_folder"), NewFolder);
+	Result->SetNumberField(TEXT("count"), Targets.Num());
+	Result->SetNumberField(TEXT("already_in_folder"), Matches.Num() - Targets.Num());
+	Result->SetObjectField(TEXT("classes"), CountActorsByClass(Targets));
+
+	if (!bDryRun && Targets.Num() > 0)
+	{
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+		for (AActor* Actor : Targets)
+		{
+			Actor->Modify(false);
+			Actor->SetFolderPath(FolderPath);
+			BulkEdit->NotifyPackageDirty(Actor);
+		}
+		Result->SetNumberField(TEXT("moved"), Targets.Num());
+	}
+
+	Result->SetArrayField(TEXT("missing"), Missing);
+	return Result;
+}
+
+// ============================================================================
+// Async Asset Loading Commands
+// ============================================================================
+
+void FEpicUnrealMCPEditorCommands::CollectSpawnAssetPaths(const TSharedPtr<FJsonObject>& SpecJson, TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (!SpecJson.IsValid())
+	{
+		return;
+	}
+
+	FString Path;
+	if (SpecJson->TryGetStringField(TEXT("blueprint_path"), Path) && !Path.IsEmpty())
+	{
+		// Same "_C" convention as FEpicUnrealMCPAssetCache::LoadBlueprintClass
+		if (!Path.EndsWith(TEXT("_C")))
+		{
+			Path += TEXT("_C");
+		}
+		OutPaths.AddUnique(FSoftObjectPath(Path));
+	}
+	if (SpecJson->TryGetStringField(TEXT("class"), Path) && !Path.IsEmpty())
+	{
+		OutPaths.AddUnique(FSoftObjectPath(Path));
+	}
+	if (SpecJson->TryGetStringField(TEXT("static_mesh"), Path) && !Path.IsEmpty())
+	{
+		OutPaths.AddUnique(FSoftObjectPath(Path));
+	}
+	if (SpecJson->TryGetStringField(TEXT("material"), Path) && !Path.IsEmpty())
+	{
+		OutPaths.AddUnique(FSoftObjectPath(Path));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* MaterialsJson;
+	if (SpecJson->TryGetArrayField(TEXT("materials"), MaterialsJson))
+	{
+		for (const TSharedPtr<FJsonValue>& MaterialValue : *MaterialsJson)
+		{
+			if (MaterialValue.IsValid() && MaterialValue->TryGetString(Path) && !Path.IsEmpty())
+			{
+				OutPaths.AddUnique(FSoftObjectPath(Path));
+			}
+		}
+	}
+}
+
+// Finished jobs nobody released are dropped after this long, or oldest first beyond the cap
+static const double AsyncJobTimeToLiveSeconds = 600.0;
+static const int32 MaxFinishedAsyncJobs = 64;
+
+void FEpicUnrealMCPEditorCommands::EvictFinishedAsyncJobs()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<TPair<double, int32>> Finished;
+	for (const TPair<int32, FEpicUnrealMCPAsyncJob>& Entry : AsyncJobs)
+	{
+		if (Entry.Value.bComplete)
+		{
+			Finished.Emplace(Entry.Value.EndTime, Entry.Key);
+		}
+	}
+	Finished.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int32 Index = 0; Index < Finished.Num(); ++Index)
+	{
+		const bool bExpired = Now - Finished[Index].Key > AsyncJobTimeToLiveSeconds;
+		const bool bOverCap = Finished.Num() - Index > MaxFinishedAsyncJobs;
+		if (!bExpired && !bOverCap)
+		{
+			break;
+		}
+
+		FEpicUnrealMCPAsyncJob& Job = AsyncJobs.FindChecked(Finished[Index].Value);
+		if (Job.Handle.IsValid())
+		{
+			Job.Handle->ReleaseHandle();
+		}
+		AsyncJobs.Remove(Finished[Index].Value);
+	}
+}
+
+int32 FEpicUnrealMCPEditorCommands::StartAsyncJob(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TArray<FSoftObjectPath>& Paths)
+{
+	EvictFinishedAsyncJobs();
+
+	const int32 JobId = NextAsyncJobId++;
+
+	// Register the job before requesting the load; the delegate can fire immediately
+	FEpicUnrealMCPAsyncJob& Job = AsyncJobs.Add(JobId);
+	Job.CommandType = CommandType;
+	Job.Params = Params;
+	Job.Paths = Paths;
+	Job.StartTime = FPlatformTime::Seconds();
+
+	TSharedPtr<FStreamableHandle> Handle = AssetCache->RequestAsyncLoad(Paths,
+		FStreamableDelegate::CreateRaw(this, &FEpicUnrealMCPEditorCommands::OnAsyncJobLoaded, JobId));
+
+	if (FEpicUnrealMCPAsyncJob* Started = AsyncJobs.Find(JobId))
+	{
+		Started->Handle = Handle;
+	}
+	return JobId;
+}
+
+void FEpicUnrealMCPEditorCommands::OnAsyncJobLoaded(int32 JobId)
+{
+	FEpicUnrealMCPAsyncJob* Job = AsyncJobs.Find(JobId);
+	if (!Job || Job->bComplete)
+	{
+		return;
+	}
+
+	Job->bComplete = true;
+	Job->EndTime = FPlatformTime::Seconds();
+
+	if (!Job->CommandType.IsEmpty())
+	{
+		// Re-run the original command synchronously; the assets are resident now.
+		// Failed loads resolve to nullptr again and surface as the command's normal error.
+		TSharedPtr<FJsonObject> RerunParams = MakeShared<FJsonObject>();
+		RerunParams->Values = Job->Params->Values;
+		RerunParams->SetBoolField(TEXT("async"), false);
+
+		const FString CommandType = Job->CommandType;
+		TSharedPtr<FJsonObject> Result = HandleCommand(CommandType, RerunParams);
+
+		// HandleCommand may have started other jobs and reallocated the map
+		if (FEpicUnrealMCPAsyncJob* Finished = AsyncJobs.Find(JobId))
+		{
+			Finished->Result = Result;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("UnrealMCP: Async job %d finished %s"), JobId, *CommandType);
+	}
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::DeferUntilLoaded(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+	const TArray<FSoftObjectPath>& Paths)
+{
+	TArray<FSoftObjectPath> Unloaded;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!Path.ResolveObject())
+		{
+			Unloaded.Add(Path);
+		}
+	}
+
+	// Everything resident: the caller proceeds synchronously
+	if (Unloaded.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const int32 JobId = StartAsyncJob(CommandType, Params, Unloaded);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("pending"), true);
+	Result->SetNumberField(TEXT("job_id"), JobId);
+	Result->SetNumberField(TEXT("loading"), Unloaded.Num());
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandlePreloadAssets(const TSharedPtr<FJsonObject>& Params)
+{
+	const TArray<TSharedPtr<FJsonValue>>* PathsJson;
+	if (!Params->TryGetArrayField(TEXT("paths"), PathsJson))
+	{
+		return CreateErrorResponse(TEXT("Missing 'paths' parameter"));
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	for (const TSharedPtr<FJsonValue>& PathValue : *PathsJson)
+	{
+		const FString Path = PathValue->AsString();
+		if (!Path.IsEmpty())
+		{
+			Paths.AddUnique(FSoftObjectPath(Path));
+		}
+	}
+
+	if (Paths.Num() == 0)
+	{
+		return CreateErrorResponse(TEXT("'paths' is empty"));
+	}
+
+	// Loaded assets are pinned by the job handle until the job is released
+	const int32 JobId = StartAsyncJob(FString(), nullptr, Paths);
+	const FEpicUnrealMCPAsyncJob& Job = AsyncJobs.FindChecked(JobId);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("job_id"), JobId);
+	Result->SetNumberField(TEXT("requested"), Paths.Num());
+	Result->SetStringField(TEXT("status"), Job.bComplete ? TEXT("complete") : TEXT("loading"));
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetAsyncJob(const TSharedPtr<FJsonObject>& Params)
+{
+	int32 JobId = 0;
+	if (!Params->TryGetNumberField(TEXT("job_id"), JobId))
+	{
+		return CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+	}
+
+	FEpicUnrealMCPAsyncJob* Job = AsyncJobs.Find(JobId);
+	if (!Job)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Unknown or released job: %d"), JobId));
+	}
+
+	bool bRelease = false;
+	Params->TryGetBoolField(TEXT("release"), bRelease);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("job_id"), JobId);
+	Result->SetStringField(TEXT("command"), Job->CommandType.IsEmpty() ? TEXT("preload_assets") : *Job->CommandType);
+	Result->SetStringField(TEXT("status"), Job->bComplete ? TEXT("complete") : TEXT("loading"));
+	Result->SetNumberField(TEXT("progress"), Job->bComplete ? 1.0f : (Job->Handle.IsValid() ? Job->Handle->GetProgress() : 0.0f));
+
+	const double EndTime = Job->bComplete ? Job->EndTime : FPlatformTime::Seconds();
+	Result->SetNumberField(TEXT("elapsed_ms"), (EndTime - Job->StartTime) * 1000.0);
+
+	if (Job->bComplete)
+	{
+		TArray<TSharedPtr<FJsonValue>> Loaded;
+		TArray<TSharedPtr<FJsonValue>> Failed;
+		for (const FSoftObjectPath& Path : Job->Paths)
+		{
+			(Path.ResolveObject() ? Loaded : Failed).Add(MakeShared<FJsonValueString>(Path.ToString()));
+		}
+		Result->SetArrayField(TEXT("loaded"), Loaded);
+		Result->SetArrayField(TEXT("failed"), Failed);
+
+		if (Job->Result.IsValid())
+		{
+			Result->SetObjectField(TEXT("result"), Job->Result);
+		}
+
+		// A spawn job is done once its result has been delivered
+		if (!Job->CommandType.IsEmpty())
+		{
+			bRelease = true;
+		}
+	}
+
+	if (bRelease)
+	{
+		if (Job->Handle.IsValid())
+		{
+			Job->Handle->ReleaseHandle();
+		}
+		AsyncJobs.Remove(JobId);
+	}
+	Result->SetBoolField(TEXT("released"), bRelease);
+
+	return Result;
+}
+
+// ============================================================================
+// Structure Builder Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleBuildStructure(const TSharedPtr<FJsonObject>& Params)
+{
+	// Expand the whole spec before touching the world so a bad element spawns nothing
+	FEpicUnrealMCPStructureBuilder Builder;
+	FString BuildError;
+	if (!Builder.Build(Params, BuildError))
+	{
+		return CreateErrorResponse(BuildError);
+	}
+
+	if (Builder.GetNumPieces() == 0)
+	{
+		return CreateErrorResponse(TEXT("Structure expands to no pieces"));
+	}
+
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
+	{
+		TArray<FSoftObjectPath> AssetPaths;
+		for (const FEpicUnrealMCPStructurePrimitive& Primitive : Builder.GetPrimitives())
+		{
+			CollectSpawnAssetPaths(Primitive.Spec, AssetPaths);
+		}
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("build_structure"), Params, AssetPaths))
+		{
+			return Pending;
+		}
+	}
+
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
+	}
+
+	FString StructureName = TEXT("Structure");
+	Params->TryGetStringField(TEXT("name"), StructureName);
+
+	bool bInstanced = true;
+	Params->TryGetBoolField(TEXT("instanced"), bInstanced);
+
+	bool bReturnNames = false;
+	Params->TryGetBoolField(TEXT("return_names"), bReturnNames);
+
+	// Each primitive is resolved once and then stamped at all of its transforms
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.Reserve(Builder.GetNumPieces());
+	SpecErrors.SetNum(Builder.GetNumPieces());
+
+	const TArray<FEpicUnrealMCPStructurePrimitive>& Primitives = Builder.GetPrimitives();
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
+	{
+		const FEpicUnrealMCPStructurePrimitive& Primitive = Primitives[PrimitiveIndex];
+
+		FEpicUnrealMCPSpawnSpec Template;
+		FString SpecError;
+		if (!ParseSpawnSpec(Primitive.Spec, Template, SpecError))
 		{
-			return MakeShared<FJsonValueString>(Obj->GetPathName());
+			return CreateErrorResponse(FString::Printf(TEXT("Structure primitive %d: %s"), PrimitiveIndex, *SpecError));
 		}
-		return MakeShared<FJsonValueNull>();
-	}
 
-	// Class reference
-	if (UClassProperty* ClassProp = Cast<UClassProperty>(Property))
-	{
-		UClass* Class = Cast<UClass>(ClassProp->GetObjectPropertyValue(ValuePtr));
-		if (Class)
+		const FString BaseName = Template.Name.IsEmpty() ? StructureName : StructureName + TEXT("_") + Template.Name;
+		if (Template.FolderPath.IsNone())
+		{
+			Template.FolderPath = FName(*StructureName);
+		}
+
+		for (int32 PieceIndex = 0; PieceIndex < Primitive.Transforms.Num(); ++PieceIndex)
 		{
-			return MakeShared<FJsonValueString>(Class->GetPathName());
+			FEpicUnrealMCPSpawnSpec& Spec = Specs.Add_GetRef(Template);
+			Spec.Transform = Primitive.Transforms[PieceIndex];
+			Spec.Name = Primitive.Transforms.Num() > 1 ? FString::Printf(TEXT("%s_%d"), *BaseName, PieceIndex) : BaseName;
 		}
-		return MakeShared<FJsonValueNull>();
 	}
 
-	// Array property
-	if (UArrayProperty* ArrayProp = Cast<UArrayProperty>(Property))
+	TSharedPtr<FJsonObject> Result = SpawnActorBatch(World, Specs, SpecErrors, true, bInstanced);
+	Result->SetStringField(TEXT("structure"), StructureName);
+	Result->SetNumberField(TEXT("pieces"), Builder.GetNumPieces());
+	Result->SetNumberField(TEXT("primitives"), Primitives.Num());
+	if (!bReturnNames)
 	{
-		FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
-		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		// Per-piece arrays are large for big builds and rarely needed
+		Result->RemoveField(TEXT("names"));
+		Result->RemoveField(TEXT("instance_indices"));
+	}
+	return Result;
+}
 
-		for (int32 i = 0; i < ArrayHelper.Num(); ++i)
-		{
-			void* ElementPtr = ArrayHelper.GetRawPtr(i);
-			TSharedPtr<FJsonValue> ElementJson = PropertyToJsonValue(ArrayProp->Inner, ElementPtr);
-			JsonArray.Add(ElementJson);
-		}
+// ============================================================================
+// Prefab Commands
+// ============================================================================
+
+static FString GetPrefabFilePath(const FString& PrefabName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("MCPPrefabs") / FPaths::MakeValidFileName(PrefabName) + TEXT(".json");
+}
+
+// Exports every editable actor property that differs from the class defaults.
+// Component state is not walked; meshes and materials are captured separately.
+static TSharedPtr<FJsonObject> ExportNonDefaultProperties(AActor* Actor)
+{
+	TArray<FName> Names;
+	TArray<FString> Values;
+	FEpicUnrealMCPActorRecord::ExportNonDefaultProperties(Actor, Names, Values);
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+	for (int32 Index = 0; Index < Names.Num(); ++Index)
+	{
+		Properties->SetStringField(Names[Index].ToString(), Values[Index]);
+	}
+	return Properties;
+}
+
+static TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(const FVector& Vector)
+{
+	TArray<TSharedPtr<FJsonValue>> Array;
+	Array.Add(MakeShared<FJsonValueNumber>(Vector.X));
+	Array.Add(MakeShared<FJsonValueNumber>(Vector.Y));
+	Array.Add(MakeShared<FJsonValueNumber>(Vector.Z));
+	return Array;
+}
+
+static TSharedPtr<FJsonObject> TransformToJsonObject(const FTransform& Transform)
+{
+	const FRotator Rotation = Transform.Rotator();
+	TSharedPtr<FJsonObject> TransformJson = MakeShared<FJsonObject>();
+	TransformJson->SetArrayField(TEXT("location"), VectorToJsonArray(Transform.GetLocation()));
+	TransformJson->SetArrayField(TEXT("rotation"), VectorToJsonArray(FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll)));
+	TransformJson->SetArrayField(TEXT("scale"), VectorToJsonArray(Transform.GetScale3D()));
+	return TransformJson;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::FindPrefab(const FString& PrefabName)
+{
+	if (TSharedPtr<FJsonObject>* Cached = Prefabs.Find(PrefabName))
+	{
+		return *Cached;
+	}
+
+	FString PrefabText;
+	if (!FFileHelper::LoadFileToString(PrefabText, *GetPrefabFilePath(PrefabName)))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> Prefab;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PrefabText);
+	if (!FJsonSerializer::Deserialize(Reader, Prefab) || !Prefab.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Could not parse prefab file for '%s'"), *PrefabName);
+		return nullptr;
+	}
+
+	Prefabs.Add(PrefabName, Prefab);
+	return Prefab;
+}
 
-		return MakeShared<FJsonValueArray>(JsonArray);
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCapturePrefab(const TSharedPtr<FJsonObject>& Params)
+{
+	FString PrefabName;
+	if (!Params->TryGetStringField(TEXT("name"), PrefabName) || PrefabName.IsEmpty())
+	{
+		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	// Map property
-	if (UMapProperty* MapProp = Cast<UMapProperty>(Property))
+	if (!ActorIndex->GetWorld())
 	{
-		FScriptMapHelper MapHelper(MapProp, ValuePtr);
-		TSharedPtr<FJsonObject> JsonMap = MakeShared<FJsonObject>();
+		return CreateErrorResponse(TEXT("No editor world available"));
+	}
 
-		for (int32 i = 0; i < MapHelper.Num(); ++i)
+	// Members come from an explicit name list or from the usual actor filter
+	TArray<AActor*> Members;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	const TArray<TSharedPtr<FJsonValue>>* ActorNames;
+	if (Params->TryGetArrayField(TEXT("actors"), ActorNames))
+	{
+		for (const TSharedPtr<FJsonValue>& NameValue : *ActorNames)
 		{
-			if (MapHelper.IsValidIndex(i))
+			if (AActor* Actor = ActorIndex->FindByName(NameValue->AsString()))
 			{
-				// Get key as string (for JSON object key)
-				void* KeyPtr = MapHelper.GetKeyPtr(i);
-				FString KeyStr;
-				MapProp->KeyProp->ExportTextItem(KeyStr, KeyPtr, nullptr, nullptr, PPF_None);
-
-				// Get value as JSON
-				void* ValuePtrInner = MapHelper.GetValuePtr(i);
-				TSharedPtr<FJsonValue> ValueJson = PropertyToJsonValue(MapProp->ValueProp, ValuePtrInner);
+				Members.AddUnique(Actor);
+			}
+			else
+			{
+				Missing.Add(MakeShared<FJsonValueString>(NameValue->AsString()));
+			}
+		}
+	}
+	else
+	{
+		FEpicUnrealMCPActorFilter Filter;
+		FString FilterError;
+		if (!Filter.Compile(Params, FilterError))
+		{
+			return CreateErrorResponse(FilterError);
+		}
+		if (Filter.IsEmpty())
+		{
+			return CreateErrorResponse(TEXT("capture_prefab needs 'actors' or at least one filter field (pattern, class, tags, folder or bounds)"));
+		}
 
-				JsonMap->SetField(KeyStr, ValueJson);
+		const int32 MaxResults = Filter.GetMaxResults();
+		for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
+		{
+			AActor* Actor = ActorPtr.Get();
+			if (IsValid(Actor) && Filter.Matches(Actor))
+			{
+				Members.Add(Actor);
+				if (MaxResults > 0 && Members.Num() >= MaxResults)
+				{
+					break;
+				}
 			}
 		}
+	}
+
+	if (Members.Num() == 0)
+	{
+		return CreateErrorResponse(TEXT("No actors to capture"));
+	}
 
-		return MakeShared<FJsonValueObject>(JsonMap);
+	// Default pivot: XY centroid at the lowest member, so stamps sit on the given location
+	FVector Pivot;
+	if (Params->HasField(TEXT("pivot")))
+	{
+		Pivot = GetVectorFromJson(Params, TEXT("pivot"));
+	}
+	else
+	{
+		FVector Sum = FVector::ZeroVector;
+		float MinZ = TNumericLimits<float>::Max();
+		for (AActor* Actor : Members)
+		{
+			const FVector Location = Actor->GetActorLocation();
+			Sum += Location;
+			MinZ = FMath::Min(MinZ, Location.Z);
+		}
+		Pivot = Sum / Members.Num();
+		Pivot.Z = MinZ;
 	}
+	const FTransform PivotTransform(Pivot);
 
-	// Set property
-	if (USetProperty* SetProp = Cast<USetProperty>(Property))
+	TArray<TSharedPtr<FJsonValue>> MembersJson;
+	int32 NumProperties = 0;
+	for (AActor* Actor : Members)
 	{
-		FScriptSetHelper SetHelper(SetProp, ValuePtr);
-		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		TSharedPtr<FJsonObject> MemberJson = MakeShared<FJsonObject>();
+		MemberJson->SetStringField(TEXT("name"), Actor->GetName());
+		MemberJson->SetStringField(TEXT("class"), Actor->GetClass()->GetPathName());
 
-		for (int32 i = 0; i < SetHelper.Num(); ++i)
+		if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
 		{
-			if (SetHelper.IsValidIndex(i))
+			UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
+			if (MeshComponent && MeshComponent->GetStaticMesh())
 			{
-				void* ElementPtr = SetHelper.GetElementPtr(i);
-				TSharedPtr<FJsonValue> ElementJson = PropertyToJsonValue(SetProp->ElementProp, ElementPtr);
-				JsonArray.Add(ElementJson);
+				MemberJson->SetStringField(TEXT("static_mesh"), MeshComponent->GetStaticMesh()->GetPathName());
+
+				TArray<TSharedPtr<FJsonValue>> MaterialsJson;
+				for (UMaterialInterface* Material : MeshComponent->OverrideMaterials)
+				{
+					if (Material)
+					{
+						MaterialsJson.Add(MakeShared<FJsonValueString>(Material->GetPathName()));
+					}
+					else
+					{
+						MaterialsJson.Add(MakeShared<FJsonValueNull>());
+					}
+				}
+				while (MaterialsJson.Num() > 0 && MaterialsJson.Last()->IsNull())
+				{
+					MaterialsJson.Pop();
+				}
+				if (MaterialsJson.Num() > 0)
+				{
+					MemberJson->SetArrayField(TEXT("materials"), MaterialsJson);
+				}
 			}
 		}
 
-		return MakeShared<FJsonValueArray>(JsonArray);
+		const FTransform Relative = Actor->GetActorTransform().GetRelativeTransform(PivotTransform);
+		MemberJson->SetArrayField(TEXT("location"), VectorToJsonArray(Relative.GetLocation()));
+		const FRotator Rotation = Relative.Rotator();
+		MemberJson->SetArrayField(TEXT("rotation"), VectorToJsonArray(FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll)));
+		MemberJson->SetArrayField(TEXT("scale"), VectorToJsonArray(Relative.GetScale3D()));
+
+		TSharedPtr<FJsonObject> Properties = ExportNonDefaultProperties(Actor);
+		if (Properties->Values.Num() > 0)
+		{
+			NumProperties += Properties->Values.Num();
+			MemberJson->SetObjectField(TEXT("properties"), Properties);
+		}
+
+		MembersJson.Add(MakeShared<FJsonValueObject>(MemberJson));
+	}
+
+	TSharedPtr<FJsonObject> Prefab = MakeShared<FJsonObject>();
+	Prefab->SetStringField(TEXT("name"), PrefabName);
+	Prefab->SetArrayField(TEXT("pivot"), VectorToJsonArray(Pivot));
+	Prefab->SetArrayField(TEXT("members"), MembersJson);
+	Prefabs.Add(PrefabName, Prefab);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+	bool bSave = false;
+	Params->TryGetBoolField(TEXT("save"), bSave);
+	if (bSave)
+	{
+		FString PrefabText;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&PrefabText);
+		FJsonSerializer::Serialize(Prefab.ToSharedRef(), Writer);
+
+		const FString FilePath = GetPrefabFilePath(PrefabName);
+		if (!FFileHelper::SaveStringToFile(PrefabText, *FilePath))
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Captured prefab but failed to write %s"), *FilePath));
+		}
+		Result->SetStringField(TEXT("file"), FilePath);
 	}
 
-	// Fallback: export as text
-	FString ExportedText;
-	Property->ExportTextItem(ExportedText, ValuePtr, nullptr, nullptr, PPF_None);
-	return MakeShared<FJsonValueString>(ExportedText);
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("name"), PrefabName);
+	Result->SetNumberField(TEXT("members"), MembersJson.Num());
+	Result->SetNumberField(TEXT("properties"), NumProperties);
+	Result->SetArrayField(TEXT("pivot"), VectorToJsonArray(Pivot));
+	Result->SetArrayField(TEXT("missing"), Missing);
+	return Result;
 }
 
-bool FEpicUnrealMCPEditorCommands::JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, UProperty* Property, void* ValuePtr)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleStampPrefab(const TSharedPtr<FJsonObject>& Params)
 {
-	if (!JsonValue.IsValid() || !Property || !ValuePtr)
+	FString PrefabName;
+	if (!Params->TryGetStringField(TEXT("name"), PrefabName))
 	{
-		return false;
+		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
+	}
+
+	TSharedPtr<FJsonObject> Prefab = FindPrefab(PrefabName);
+	if (!Prefab.IsValid())
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Prefab not found in memory or on disk: %s"), *PrefabName));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* MembersJson;
+	if (!Prefab->TryGetArrayField(TEXT("members"), MembersJson) || MembersJson->Num() == 0)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Prefab '%s' has no members"), *PrefabName));
 	}
 
-	// Boolean
-	if (UBoolProperty* BoolProp = Cast<UBoolProperty>(Property))
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
 	{
-		bool BoolVal;
-		if (JsonValue->TryGetBool(BoolVal))
+		TArray<FSoftObjectPath> AssetPaths;
+		for (const TSharedPtr<FJsonValue>& MemberValue : *MembersJson)
 		{
-			BoolProp->SetPropertyValue(ValuePtr, BoolVal);
-			return true;
+			CollectSpawnAssetPaths(MemberValue->AsObject(), AssetPaths);
+		}
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("stamp_prefab"), Params, AssetPaths))
+		{
+			return Pending;
 		}
-		return false;
 	}
 
-	// Numeric types
-	if (UByteProperty* ByteProp = Cast<UByteProperty>(Property))
+	// One placement per entry of 'transforms', or a single one from location/rotation/scale
+	TArray<FTransform> Stamps;
+	const TArray<TSharedPtr<FJsonValue>>* TransformsJson;
+	if (Params->TryGetArrayField(TEXT("transforms"), TransformsJson))
 	{
-		if (!ByteProp->Enum)  // Regular byte, not enum
+		for (const TSharedPtr<FJsonValue>& TransformValue : *TransformsJson)
 		{
-			double NumVal;
-			if (JsonValue->TryGetNumber(NumVal))
+			if (!TransformValue.IsValid() || TransformValue->Type != EJson::Object)
 			{
-				ByteProp->SetPropertyValue(ValuePtr, static_cast<uint8>(NumVal));
-				return true;
+				return CreateErrorResponse(TEXT("'transforms' entries must be objects"));
 			}
-		}
-		else  // Byte enum
-		{
-			FString EnumStr;
-			if (JsonValue->TryGetString(EnumStr))
+			const TSharedPtr<FJsonObject> TransformJson = TransformValue->AsObject();
+			FVector Scale(1.0f, 1.0f, 1.0f);
+			if (TransformJson->HasField(TEXT("scale")))
 			{
-				int32 EnumValue = ByteProp->Enum->GetIndexByNameString(EnumStr);
-				if (EnumValue != INDEX_NONE)
-				{
-					ByteProp->SetPropertyValue(ValuePtr, static_cast<uint8>(EnumValue));
-					return true;
-				}
+				Scale = GetVectorFromJson(TransformJson, TEXT("scale"));
 			}
+			Stamps.Add(FTransform(GetRotatorFromJson(TransformJson, TEXT("rotation")), GetVectorFromJson(TransformJson, TEXT("location")), Scale));
 		}
-		return false;
 	}
-	if (UIntProperty* IntProp = Cast<UIntProperty>(Property))
+	else
 	{
-		double NumVal;
-		if (JsonValue->TryGetNumber(NumVal))
+		FVector Scale(1.0f, 1.0f, 1.0f);
+		if (Params->HasField(TEXT("scale")))
 		{
-			IntProp->SetPropertyValue(ValuePtr, static_cast<int32>(NumVal));
-			return true;
+			Scale = GetVectorFromJson(Params, TEXT("scale"));
 		}
-		return false;
+		Stamps.Add(FTransform(GetRotatorFromJson(Params, TEXT("rotation")), GetVectorFromJson(Params, TEXT("location")), Scale));
 	}
-	if (UInt64Property* Int64Prop = Cast<UInt64Property>(Property))
+
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
 	{
-		double NumVal;
-		if (JsonValue->TryGetNumber(NumVal))
-		{
-			Int64Prop->SetPropertyValue(ValuePtr, static_cast<int64>(NumVal));
-			return true;
-		}
-		return false;
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
 	}
-	if (UFloatProperty* FloatProp = Cast<UFloatProperty>(Property))
+
+	FString NamePrefix = PrefabName;
+	Params->TryGetStringField(TEXT("name_prefix"), NamePrefix);
+
+	FString Folder = PrefabName;
+	Params->TryGetStringField(TEXT("folder"), Folder);
+
+	bool bInstanced = false;
+	Params->TryGetBoolField(TEXT("instanced"), bInstanced);
+
+	// Resolve each member once; stamping only composes transforms
+	TArray<FEpicUnrealMCPSpawnSpec> Templates;
+	Templates.SetNum(MembersJson->Num());
+	for (int32 MemberIndex = 0; MemberIndex < MembersJson->Num(); ++MemberIndex)
 	{
-		double NumVal;
-		if (JsonValue->TryGetNumber(NumVal))
+		FString SpecError;
+		if (!ParseSpawnSpec((*MembersJson)[MemberIndex]->AsObject(), Templates[MemberIndex], SpecError))
 		{
-			FloatProp->SetPropertyValue(ValuePtr, static_cast<float>(NumVal));
-			return true;
+			return CreateErrorResponse(FString::Printf(TEXT("Prefab member %d: %s"), MemberIndex, *SpecError));
 		}
-		return false;
 	}
-	if (UDoubleProperty* DoubleProp = Cast<UDoubleProperty>(Property))
+
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.Reserve(Stamps.Num() * Templates.Num());
+	SpecErrors.SetNum(Stamps.Num() * Templates.Num());
+
+	for (int32 StampIndex = 0; StampIndex < Stamps.Num(); ++StampIndex)
 	{
-		double NumVal;
-		if (JsonValue->TryGetNumber(NumVal))
+		const FString StampName = FString::Printf(TEXT("%s_%d"), *NamePrefix, StampIndex);
+		const FName StampFolder(*(Folder / StampName));
+
+		for (const FEpicUnrealMCPSpawnSpec& Template : Templates)
 		{
-			DoubleProp->SetPropertyValue(ValuePtr, NumVal);
-			return true;
+			FEpicUnrealMCPSpawnSpec& Spec = Specs.Add_GetRef(Template);
+			Spec.Transform = Template.Transform * Stamps[StampIndex];
+			Spec.Name = StampName + TEXT("_") + Template.Name;
+			Spec.FolderPath = StampFolder;
 		}
-		return false;
 	}
 
-	// String types
-	if (UStrProperty* StrProp = Cast<UStrProperty>(Property))
+	TSharedPtr<FJsonObject> Result = SpawnActorBatch(World, Specs, SpecErrors, true, bInstanced);
+	Result->SetStringField(TEXT("prefab"), PrefabName);
+	Result->SetNumberField(TEXT("stamps"), Stamps.Num());
+	Result->SetNumberField(TEXT("members"), Templates.Num());
+	return Result;
+}
+
+// ============================================================================
+// Pattern Spawn Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnPattern(const TSharedPtr<FJsonObject>& Params)
+{
+	const TSharedPtr<FJsonObject>* ActorJson;
+	if (!Params->TryGetObjectField(TEXT("actor"), ActorJson))
 	{
-		FString StrVal;
-		if (JsonValue->TryGetString(StrVal))
-		{
-			StrProp->SetPropertyValue(ValuePtr, StrVal);
-			return true;
-		}
-		return false;
+		return CreateErrorResponse(TEXT("Missing 'actor' spawn spec"));
 	}
-	if (UNameProperty* NameProp = Cast<UNameProperty>(Property))
+
+	bool bAsync = false;
+	if (Params->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
 	{
-		FString StrVal;
-		if (JsonValue->TryGetString(StrVal))
+		TArray<FSoftObjectPath> AssetPaths;
+		CollectSpawnAssetPaths(*ActorJson, AssetPaths);
+		if (TSharedPtr<FJsonObject> Pending = DeferUntilLoaded(TEXT("spawn_pattern"), Params, AssetPaths))
 		{
-			NameProp->SetPropertyValue(ValuePtr, FName(*StrVal));
-			return true;
+			return Pending;
 		}
-		return false;
 	}
-	if (UTextProperty* TextProp = Cast<UTextProperty>(Property))
+
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
+	{
+		return CreateErrorResponse(TEXT("Failed to get editor world"));
+	}
+
+	FEpicUnrealMCPPatternGenerator Generator;
+
+	// An existing spline actor replaces the 'points' of a spline pattern
+	FString SplineActorName;
+	if (Params->TryGetStringField(TEXT("spline_actor"), SplineActorName))
 	{
-		FString StrVal;
-		if (JsonValue->TryGetString(StrVal))
+		AActor* SplineActor = ActorIndex->FindByName(SplineActorName);
+		USplineComponent* Spline = SplineActor ? SplineActor->FindComponentByClass<USplineComponent>() : nullptr;
+		if (!Spline)
 		{
-			TextProp->SetPropertyValue(ValuePtr, FText::FromString(StrVal));
-			return true;
+			return CreateErrorResponse(FString::Printf(TEXT("Actor '%s' not found or has no spline component"), *SplineActorName));
 		}
-		return false;
+
+		// Sampled every 25 units so the generator can walk it like any other polyline
+		const float SplineLength = Spline->GetSplineLength();
+		const bool bClosed = Spline->IsClosedLoop();
+		const int32 NumSamples = FMath::Clamp(FMath::CeilToInt(SplineLength / 25.0f), 2, 20000);
+		TArray<FVector> PathPoints;
+		PathPoints.Reserve(NumSamples);
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			const float Distance = SplineLength * Sample / (bClosed ? NumSamples : NumSamples - 1);
+			PathPoints.Add(Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+		}
+		Generator.SetPath(MoveTemp(PathPoints), bClosed);
 	}
 
-	// Struct types
-	if (UStructProperty* StructProp = Cast<UStructProperty>(Property))
+	// Bounds of the actors picked by the 'avoid' filter reject points that land inside them
+	const TSharedPtr<FJsonObject>* AvoidJson;
+	if (Params->TryGetObjectField(TEXT("avoid"), AvoidJson))
 	{
-		UScriptStruct* Struct = StructProp->Struct;
-
-		if (Struct == TBaseStructure<FVector>::Get())
+		FEpicUnrealMCPActorFilter Filter;
+		FString FilterError;
+		if (!Filter.Compile(*AvoidJson, FilterError))
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Arr;
-			if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
-			{
-				FVector* Vec = static_cast<FVector*>(ValuePtr);
-				Vec->X = (*Arr)[0]->AsNumber();
-				Vec->Y = (*Arr)[1]->AsNumber();
-				Vec->Z = (*Arr)[2]->AsNumber();
-				return true;
-			}
-			return false;
+			return CreateErrorResponse(FilterError);
 		}
-		if (Struct == TBaseStructure<FRotator>::Get())
+		if (Filter.IsEmpty())
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Arr;
-			if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
-			{
-				FRotator* Rot = static_cast<FRotator*>(ValuePtr);
-				Rot->Pitch = (*Arr)[0]->AsNumber();
-				Rot->Yaw = (*Arr)[1]->AsNumber();
-				Rot->Roll = (*Arr)[2]->AsNumber();
-				return true;
-			}
-			return false;
+			return CreateErrorResponse(TEXT("'avoid' needs at least one filter field (pattern, class, tags, folder or bounds)"));
 		}
-		if (Struct == TBaseStructure<FTransform>::Get())
+
+		for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
 		{
-			const TSharedPtr<FJsonObject>* TransObj;
-			if (JsonValue->TryGetObject(TransObj))
+			AActor* Actor = ActorPtr.Get();
+			if (!IsValid(Actor) || !Filter.Matches(Actor))
 			{
-				FTransform* Trans = static_cast<FTransform*>(ValuePtr);
+				continue;
+			}
 
-				const TArray<TSharedPtr<FJsonValue>>* LocArr;
-				if ((*TransObj)->TryGetArrayField(TEXT("location"), LocArr) && LocArr->Num() >= 3)
+			// Instance groups block per instance, not with the bounds of the whole group
+			TInlineComponentArray<UInstancedStaticMeshComponent*> InstanceComponents(Actor);
+			if (InstanceComponents.Num() > 0)
+			{
+				for (UInstancedStaticMeshComponent* InstanceComponent : InstanceComponents)
 				{
-					Trans->SetLocation(FVector(
-						(*LocArr)[0]->AsNumber(),
-						(*LocArr)[1]->AsNumber(),
-						(*LocArr)[2]->AsNumber()
-					));
+					UStaticMesh* Mesh = InstanceComponent->GetStaticMesh();
+					if (!Mesh)
+					{
+						continue;
+					}
+					const FBox MeshBox = Mesh->GetBoundingBox();
+					for (int32 Instance = 0; Instance < InstanceComponent->GetInstanceCount(); ++Instance)
+					{
+						FTransform InstanceTransform;
+						InstanceComponent->GetInstanceTransform(Instance, InstanceTransform, true);
+						Generator.AddBlocker(MeshBox.TransformBy(InstanceTransform));
+					}
 				}
+				continue;
+			}
 
-				const TArray<TSharedPtr<FJsonValue>>* RotArr;
-				if ((*TransObj)->TryGetArrayField(TEXT("rotation"), RotArr) && RotArr->Num() >= 3)
-				{
-					Trans->SetRotation(FQuat(FRotator(
-						(*RotArr)[0]->AsNumber(),
-						(*RotArr)[1]->AsNumber(),
-						(*RotArr)[2]->AsNumber()
-					)));
-				}
+			Generator.AddBlocker(Actor->GetComponentsBoundingBox(true));
+		}
+	}
 
-				const TArray<TSharedPtr<FJsonValue>>* ScaleArr;
-				if ((*TransObj)->TryGetArrayField(TEXT("scale"), ScaleArr) && ScaleArr->Num() >= 3)
-				{
-					Trans->SetScale3D(FVector(
-						(*ScaleArr)[0]->AsNumber(),
-						(*ScaleArr)[1]->AsNumber(),
-						(*ScaleArr)[2]->AsNumber()
-					));
-				}
-				return true;
-			}
-			return false;
+	FString PatternError;
+	if (!Generator.Generate(Params, PatternError))
+	{
+		return CreateErrorResponse(PatternError);
+	}
+
+	FEpicUnrealMCPSpawnSpec Template;
+	FString SpecError;
+	if (!ParseSpawnSpec(*ActorJson, Template, SpecError))
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Pattern actor: %s"), *SpecError));
+	}
+
+	FString PatternName = Template.Name.IsEmpty() ? TEXT("Pattern") : Template.Name;
+	Params->TryGetStringField(TEXT("name"), PatternName);
+	if (Template.FolderPath.IsNone())
+	{
+		Template.FolderPath = FName(*PatternName);
+	}
+
+	bool bInstanced = true;
+	Params->TryGetBoolField(TEXT("instanced"), bInstanced);
+
+	bool bReturnNames = false;
+	Params->TryGetBoolField(TEXT("return_names"), bReturnNames);
+
+	// The actor's own location/rotation/scale are an offset from each generated point
+	const TArray<FTransform>& Points = Generator.GetTransforms();
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.Reserve(Points.Num());
+	SpecErrors.SetNum(Points.Num());
+	for (int32 Index = 0; Index < Points.Num(); ++Index)
+	{
+		FEpicUnrealMCPSpawnSpec& Spec = Specs.Add_GetRef(Template);
+		Spec.Transform = Template.Transform * Points[Index];
+		Spec.Name = FString::Printf(TEXT("%s_%d"), *PatternName, Index);
+	}
+
+	TSharedPtr<FJsonObject> Result = SpawnActorBatch(World, Specs, SpecErrors, true, bInstanced);
+	Result->SetStringField(TEXT("name"), PatternName);
+	Result->SetNumberField(TEXT("generated"), Generator.GetNumCandidates());
+	Result->SetNumberField(TEXT("rejected"), Generator.GetNumRejected());
+	if (!bReturnNames)
+	{
+		// Per-point arrays are large for dense patterns and rarely needed
+		Result->RemoveField(TEXT("names"));
+		Result->RemoveField(TEXT("instance_indices"));
+	}
+	return Result;
+}
+
+// ============================================================================
+// Bulk Edit Commands
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleBeginBulkEdit(const TSharedPtr<FJsonObject>& Params)
+{
+	double TimeoutSeconds = 60.0;
+	Params->TryGetNumberField(TEXT("timeout"), TimeoutSeconds);
+
+	// By default the whole scope becomes a single undo step
+	bool bNoUndo = false;
+	Params->TryGetBoolField(TEXT("no_undo"), bNoUndo);
+
+	const bool bWasOpen = BulkEdit->IsExplicit();
+	BulkEdit->BeginExplicit(TimeoutSeconds, !bNoUndo);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("already_active"), bWasOpen);
+	Result->SetNumberField(TEXT("timeout"), TimeoutSeconds);
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleEndBulkEdit(const TSharedPtr<FJsonObject>& Params)
+{
+	TSharedPtr<FJsonObject> Result = BulkEdit->EndExplicit();
+	if (!Result.IsValid())
+	{
+		return CreateErrorResponse(TEXT("No bulk edit is active"));
+	}
+
+	Result->SetBoolField(TEXT("success"), true);
+	return Result;
+}
+
+// ============================================================================
+// World Snapshot Commands
+// ============================================================================
+
+TSharedPtr<FEpicUnrealMCPWorldSnapshot> FEpicUnrealMCPEditorCommands::FindSnapshot(const FString& SnapshotName)
+{
+	if (TSharedPtr<FEpicUnrealMCPWorldSnapshot>* Cached = Snapshots.Find(SnapshotName))
+	{
+		return *Cached;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FEpicUnrealMCPWorldSnapshot::GetFilePath(SnapshotName), FILEREAD_Silent))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FEpicUnrealMCPWorldSnapshot> Snapshot = MakeShared<FEpicUnrealMCPWorldSnapshot>();
+	if (!Snapshot->LoadFromBytes(Bytes))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Could not read snapshot file for '%s'"), *SnapshotName);
+		return nullptr;
+	}
+
+	Snapshots.Add(SnapshotName, Snapshot);
+	return Snapshot;
+}
+
+// Replaces a mesh component's material overrides if they differ from the recorded paths
+static void ApplyOverrideMaterials(FEpicUnrealMCPAssetCache& Cache, UMeshComponent* Component, const TArray<FString>& MaterialPaths)
+{
+	TArray<UMaterialInterface*> Materials;
+	Materials.Reserve(MaterialPaths.Num());
+	for (const FString& MaterialPath : MaterialPaths)
+	{
+		Materials.Add(MaterialPath.IsEmpty() ? nullptr : Cache.Load<UMaterialInterface>(MaterialPath));
+	}
+
+	if (Component->OverrideMaterials == Materials)
+	{
+		return;
+	}
+
+	Component->Modify(false);
+	Component->EmptyOverrideMaterials();
+	for (int32 Slot = 0; Slot < Materials.Num(); ++Slot)
+	{
+		if (Materials[Slot])
+		{
+			Component->SetMaterial(Slot, Materials[Slot]);
 		}
-		if (Struct == TBaseStructure<FLinearColor>::Get())
+	}
+}
+
+// Brings an actor of the recorded class back to the recorded state, touching only what differs
+void FEpicUnrealMCPEditorCommands::ApplyActorRecord(AActor* Actor, const FEpicUnrealMCPActorRecord& Record)
+{
+	Actor->Modify(false);
+
+	// Instance components first, since a respawned instance group actor gets its root component here
+	TInlineComponentArray<UInstancedStaticMeshComponent*> InstanceComponents(Actor);
+	for (const FEpicUnrealMCPInstanceRecord& Group : Record.InstanceGroups)
+	{
+		UInstancedStaticMeshComponent* Component = nullptr;
+		for (UInstancedStaticMeshComponent* Candidate : InstanceComponents)
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Arr;
-			if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+			if (Candidate->GetFName() == Group.Component)
 			{
-				FLinearColor* Color = static_cast<FLinearColor*>(ValuePtr);
-				Color->R = (*Arr)[0]->AsNumber();
-				Color->G = (*Arr)[1]->AsNumber();
-				Color->B = (*Arr)[2]->AsNumber();
-				Color->A = Arr->Num() >= 4 ? (*Arr)[3]->AsNumber() : 1.0f;
-				return true;
+				Component = Candidate;
+				break;
 			}
-			return false;
 		}
-		if (Struct == TBaseStructure<FColor>::Get())
+
+		if (!Component)
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Arr;
-			if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+			UHierarchicalInstancedStaticMeshComponent* NewComponent = NewObject<UHierarchicalInstancedStaticMeshComponent>(Actor, Group.Component, RF_Transactional);
+			NewComponent->SetMobility(EComponentMobility::Static);
+			if (USceneComponent* Root = Actor->GetRootComponent())
+			{
+				NewComponent->SetupAttachment(Root);
+			}
+			else
 			{
-				FColor* Color = static_cast<FColor*>(ValuePtr);
-				Color->R = static_cast<uint8>((*Arr)[0]->AsNumber());
-				Color->G = static_cast<uint8>((*Arr)[1]->AsNumber());
-				Color->B = static_cast<uint8>((*Arr)[2]->AsNumber());
-				Color->A = Arr->Num() >= 4 ? static_cast<uint8>((*Arr)[3]->AsNumber()) : 255;
-				return true;
+				Actor->SetRootComponent(NewComponent);
 			}
-			return false;
+			Actor->AddInstanceComponent(NewComponent);
+			NewComponent->RegisterComponent();
+			Component = NewComponent;
 		}
-		if (Struct == TBaseStructure<FVector2D>::Get())
+
+		UStaticMesh* Mesh = Group.StaticMesh.IsEmpty() ? nullptr : AssetCache->Load<UStaticMesh>(Group.StaticMesh);
+		if (Component->GetStaticMesh() != Mesh)
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Arr;
-			if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 2)
-			{
-				FVector2D* Vec = static_cast<FVector2D*>(ValuePtr);
-				Vec->X = (*Arr)[0]->AsNumber();
-				Vec->Y = (*Arr)[1]->AsNumber();
-				return true;
-			}
-			return false;
+			Component->Modify(false);
+			Component->SetStaticMesh(Mesh);
 		}
+		ApplyOverrideMaterials(*AssetCache, Component, Group.Materials);
 
-		// Generic struct - try JSON object first, then string fallback
-		const TSharedPtr<FJsonObject>* JsonObj;
-		if (JsonValue->TryGetObject(JsonObj))
+		bool bSameInstances = Component->GetInstanceCount() == Group.Instances.Num();
+		for (int32 InstanceIndex = 0; bSameInstances && InstanceIndex < Group.Instances.Num(); ++InstanceIndex)
 		{
-			for (TFieldIterator<UProperty> PropIt(Struct); PropIt; ++PropIt)
-			{
-				UProperty* FieldProp = *PropIt;
-				TSharedPtr<FJsonValue> FieldJson = (*JsonObj)->TryGetField(FieldProp->GetName());
-				if (FieldJson.IsValid())
-				{
-					void* FieldPtr = FieldProp->ContainerPtrToValuePtr<void>(ValuePtr);
-					JsonValueToProperty(FieldJson, FieldProp, FieldPtr);
-				}
-			}
-			return true;
+			FTransform InstanceTransform;
+			Component->GetInstanceTransform(InstanceIndex, InstanceTransform, false);
+			bSameInstances = InstanceTransform.Equals(Group.Instances[InstanceIndex], 1.e-3f);
 		}
-		// String fallback for backwards compatibility
-		FString StrVal;
-		if (JsonValue->TryGetString(StrVal))
+		if (!bSameInstances)
 		{
-			const TCHAR* Buffer = *StrVal;
-			Property->ImportText(Buffer, ValuePtr, PPF_None, nullptr);
-			return true;
+			Component->Modify(false);
+			Component->ClearInstances();
+			Component->AddInstances(Group.Instances, false);
 		}
-		return false;
 	}
 
-	// Enum property
-	if (UEnumProperty* EnumProp = Cast<UEnumProperty>(Property))
+	// Instance components the snapshot does not know about are emptied rather than removed
+	for (UInstancedStaticMeshComponent* Candidate : InstanceComponents)
 	{
-		FString EnumStr;
-		if (JsonValue->TryGetString(EnumStr))
+		const bool bRecorded = Record.InstanceGroups.ContainsByPredicate([Candidate](const FEpicUnrealMCPInstanceRecord& Group)
 		{
-			UEnum* Enum = EnumProp->GetEnum();
-			int64 EnumValue = Enum->GetValueByNameString(EnumStr);
-			if (EnumValue != INDEX_NONE)
-			{
-				EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, EnumValue);
-				return true;
-			}
+			return Group.Component == Candidate->GetFName();
+		});
+		if (!bRecorded && Candidate->GetInstanceCount() > 0)
+		{
+			Candidate->Modify(false);
+			Candidate->ClearInstances();
 		}
-		return false;
 	}
 
-	// Object reference (by path)
-	if (UObjectProperty* ObjProp = Cast<UObjectProperty>(Property))
+	if (UStaticMeshComponent* MeshComponent = FEpicUnrealMCPActorRecord::GetMeshComponent(Actor))
 	{
-		FString PathStr;
-		if (JsonValue->TryGetString(PathStr))
+		UStaticMesh* Mesh = Record.StaticMesh.IsEmpty() ? nullptr : AssetCache->Load<UStaticMesh>(Record.StaticMesh);
+		if (MeshComponent->GetStaticMesh() != Mesh)
 		{
-			UObject* LoadedObj = StaticLoadObject(ObjProp->PropertyClass, nullptr, *PathStr);
-			ObjProp->SetObjectPropertyValue(ValuePtr, LoadedObj);
-			return true;
+			MeshComponent->Modify(false);
+			MeshComponent->SetStaticMesh(Mesh);
 		}
-		return false;
+		ApplyOverrideMaterials(*AssetCache, MeshComponent, Record.Materials);
 	}
 
-	// Array property
-	if (UArrayProperty* ArrayProp = Cast<UArrayProperty>(Property))
-	{
-		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
-		if (JsonValue->TryGetArray(JsonArray))
-		{
-			FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
-			ArrayHelper.Resize(JsonArray->Num());
+	// Properties changed since the snapshot but not recorded in it go back to the class defaults
+	TArray<FName> CurrentNames;
+	TArray<FString> CurrentValues;
+	FEpicUnrealMCPActorRecord::ExportNonDefaultProperties(Actor, CurrentNames, CurrentValues);
 
-			for (int32 i = 0; i < JsonArray->Num(); ++i)
-			{
-				void* ElementPtr = ArrayHelper.GetRawPtr(i);
-				if (!JsonValueToProperty((*JsonArray)[i], ArrayProp->Inner, ElementPtr))
-				{
-					return false;
-				}
-			}
-			return true;
-		}
-		return false;
+	TMap<FName, FString> Current;
+	for (int32 Index = 0; Index < CurrentNames.Num(); ++Index)
+	{
+		Current.Add(CurrentNames[Index], CurrentValues[Index]);
+	}
+	TMap<FName, FString> Recorded;
+	for (int32 Index = 0; Index < Record.PropertyNames.Num(); ++Index)
+	{
+		Recorded.Add(Record.PropertyNames[Index], Record.PropertyValues[Index]);
 	}
 
-	// Map property
-	if (UMapProperty* MapProp = Cast<UMapProperty>(Property))
+	const UObject* Defaults = Actor->GetClass()->GetDefaultObject();
+	for (const FName& PropertyName : CurrentNames)
 	{
-		const TSharedPtr<FJsonObject>* JsonObj;
-		if (JsonValue->TryGetObject(JsonObj))
+		if (Recorded.Contains(PropertyName))
 		{
-			FScriptMapHelper MapHelper(MapProp, ValuePtr);
-			MapHelper.EmptyValues();
-
-			for (const auto& Pair : (*JsonObj)->Values)
-			{
-				// Add new entry
-				int32 Index = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
-
-				// Set key from string
-				void* KeyPtr = MapHelper.GetKeyPtr(Index);
-				const TCHAR* KeyBuffer = *Pair.Key;
-				MapProp->KeyProp->ImportText(KeyBuffer, KeyPtr, PPF_None, nullptr);
-
-				// Set value
-				void* ValuePtrInner = MapHelper.GetValuePtr(Index);
-				if (!JsonValueToProperty(Pair.Value, MapProp->ValueProp, ValuePtrInner))
-				{
-					return false;
-				}
-			}
-
-			MapHelper.Rehash();
-			return true;
+			continue;
+		}
+		if (FProperty* Property = FindFProperty<FProperty>(Actor->GetClass(), PropertyName))
+		{
+			Property->CopyCompleteValue_InContainer(Actor, Defaults);
+			BulkEdit->NotifyPropertyChanged(Actor, Property);
 		}
-		return false;
 	}
 
-	// Set property
-	if (USetProperty* SetProp = Cast<USetProperty>(Property))
+	ApplyPropertyValues(Actor, Recorded, &Current, [this, Actor](FProperty* Property)
 	{
-		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
-		if (JsonValue->TryGetArray(JsonArray))
+		BulkEdit->NotifyPropertyChanged(Actor, Property);
+	});
+
+	if (Actor->GetActorLabel() != Record.Label)
+	{
+		// SetActorLabel also renames the object when it can, but the snapshot matches actors by name
+		const FName ActorName = Actor->GetFName();
+		Actor->SetActorLabel(Record.Label);
+		if (Actor->GetFName() != ActorName)
 		{
-			FScriptSetHelper SetHelper(SetProp, ValuePtr);
-			SetHelper.EmptyElements();
+			Actor->Rename(*ActorName.ToString(), nullptr, REN_DontCreateRedirectors);
+		}
+	}
 
-			for (const TSharedPtr<FJsonValue>& ElementJson : *JsonArray)
-			{
-				int32 Index = SetHelper.AddDefaultValue_Invalid_NeedsRehash();
-				void* ElementPtr = SetHelper.GetElementPtr(Index);
-				if (!JsonValueToProperty(ElementJson, SetProp->ElementProp, ElementPtr))
-				{
-					return false;
-				}
-			}
+	if (Actor->GetFolderPath() != Record.FolderPath)
+	{
+		Actor->SetFolderPath(Record.FolderPath);
+	}
 
-			SetHelper.Rehash();
-			return true;
-		}
-		return false;
+	if (!Actor->GetActorTransform().Equals(Record.Transform, 1.e-3f))
+	{
+		Actor->SetActorTransform(Record.Transform);
+		BulkEdit->NotifyActorMoved(Actor);
 	}
 
-	return false;
+	BulkEdit->NotifyPackageDirty(Actor);
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorProperty(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSnapshotWorld(const TSharedPtr<FJsonObject>& Params)
 {
-	FString ActorName;
-	if (!Params->TryGetStringField(TEXT("name"), ActorName))
+	FString SnapshotName;
+	if (!Params->TryGetStringField(TEXT("name"), SnapshotName) || SnapshotName.IsEmpty())
 	{
 		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	FEpicUnrealMCPActorFilter Filter;
+	FString FilterError;
+	if (!Filter.Compile(Params, FilterError))
 	{
-		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+		return CreateErrorResponse(FilterError);
 	}
 
-	AActor* Actor = FindActorByName(ActorName);
-	if (!Actor)
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+		return CreateErrorResponse(TEXT("No editor world available"));
 	}
 
-	// Find the property on the actor's class
-	UProperty* Property = Actor->GetClass()->FindPropertyByName(*PropertyName);
-	if (!Property)
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedPtr<FEpicUnrealMCPWorldSnapshot> Snapshot = MakeShared<FEpicUnrealMCPWorldSnapshot>();
+	Snapshot->Name = SnapshotName;
+	Snapshot->MapName = World->GetMapName();
+	Snapshot->Created = FDateTime::UtcNow();
+
+	// Only the fields that define the scope are kept; max_results would make restore_world
+	// treat every actor past the cap as extra
+	static const TCHAR* ScopeFields[] = {
+		TEXT("pattern"), TEXT("match_mode"), TEXT("case_sensitive"), TEXT("match_field"),
+		TEXT("class"), TEXT("tags"), TEXT("folder"), TEXT("bounds_min"), TEXT("bounds_max")
+	};
+	TSharedPtr<FJsonObject> ScopeJson = MakeShared<FJsonObject>();
+	for (const TCHAR* Field : ScopeFields)
+	{
+		if (TSharedPtr<FJsonValue> Value = Params->TryGetField(Field))
+		{
+			ScopeJson->SetField(Field, Value);
+		}
+	}
+	if (ScopeJson->Values.Num() > 0)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Snapshot->FilterJson);
+		FJsonSerializer::Serialize(ScopeJson.ToSharedRef(), Writer);
 	}
 
-	// Get the value pointer
-	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Actor);
-	if (!ValuePtr)
+	TArray<AActor*> Actors;
+	for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
 	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
+		AActor* Actor = ActorPtr.Get();
+		if (IsValid(Actor) && FEpicUnrealMCPWorldSnapshot::CanCapture(Actor) && (Filter.IsEmpty() || Filter.Matches(Actor)))
+		{
+			Actors.Add(Actor);
+		}
 	}
+	Snapshot->CaptureActors(Actors);
+
+	TArray<uint8> Bytes;
+	Snapshot->SaveToBytes(Bytes);
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("actor"), ActorName);
-	Result->SetStringField(TEXT("property"), PropertyName);
-	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
-	Result->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
 
+	bool bSave = false;
+	Params->TryGetBoolField(TEXT("save"), bSave);
+	if (bSave)
+	{
+		const FString FilePath = FEpicUnrealMCPWorldSnapshot::GetFilePath(SnapshotName);
+		if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Failed to write snapshot file '%s'"), *FilePath));
+		}
+		Result->SetStringField(TEXT("file"), FilePath);
+	}
+
+	Snapshots.Add(SnapshotName, Snapshot);
+
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("name"), SnapshotName);
+	Result->SetNumberField(TEXT("actors"), Snapshot->Actors.Num());
+	Result->SetNumberField(TEXT("bytes"), Bytes.Num());
+	Result->SetNumberField(TEXT("capture_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleRestoreWorld(const TSharedPtr<FJsonObject>& Params)
 {
-	FString ActorName;
-	if (!Params->TryGetStringField(TEXT("name"), ActorName))
+	FString SnapshotName;
+	if (!Params->TryGetStringField(TEXT("name"), SnapshotName) || SnapshotName.IsEmpty())
 	{
 		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	TSharedPtr<FEpicUnrealMCPWorldSnapshot> Snapshot = FindSnapshot(SnapshotName);
+	if (!Snapshot.IsValid())
 	{
-		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+		return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' not found"), *SnapshotName));
 	}
 
-	if (!Params->HasField(TEXT("value")))
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
 	{
-		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+		return CreateErrorResponse(TEXT("No editor world available"));
 	}
 
-	AActor* Actor = FindActorByName(ActorName);
-	if (!Actor)
+	// Restoring into another map would delete its actors as extra and spawn the snapshot's in their place.
+	// Checked before dry_run so the preview refuses exactly what a real restore refuses.
+	bool bForce = false;
+	Params->TryGetBoolField(TEXT("force"), bForce);
+	if (!bForce && !Snapshot->MapName.IsEmpty() && Snapshot->MapName != World->GetMapName())
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+		return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' was taken in map '%s', but the current map is '%s'; pass force to restore it anyway"),
+			*SnapshotName, *Snapshot->MapName, *World->GetMapName()));
 	}
 
-	// Special handling for FolderPath - use SetFolderPath() to properly register with World Outliner
-	if (PropertyName == TEXT("FolderPath"))
+	// The snapshot's own scope decides which current actors count as extra
+	FEpicUnrealMCPActorFilter Filter;
+	if (!Snapshot->CompileFilter(Filter))
 	{
-		FString FolderPath;
-		TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
-		if (JsonValue.IsValid() && JsonValue->Type == EJson::String)
-		{
-			FolderPath = JsonValue->AsString();
-		}
-
-		Actor->SetFolderPath(*FolderPath);
-		Actor->Modify();
-		Actor->MarkPackageDirty();
-
-		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-		Result->SetBoolField(TEXT("success"), true);
-		Result->SetStringField(TEXT("actor"), ActorName);
-		Result->SetStringField(TEXT("property"), PropertyName);
-		Result->SetStringField(TEXT("type"), TEXT("Name"));
-		Result->SetStringField(TEXT("value"), Actor->GetFolderPath().ToString());
-		return Result;
+		return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' has an invalid filter"), *SnapshotName));
 	}
 
-	// Find the property on the actor's class
-	UProperty* Property = Actor->GetClass()->FindPropertyByName(*PropertyName);
-	if (!Property)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
-	}
+	bool bDryRun = false;
+	Params->TryGetBoolField(TEXT("dry_run"), bDryRun);
 
-	// Check if property is editable
-	if (Property->HasAnyPropertyFlags(CPF_EditConst))
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property is read-only: %s"), *PropertyName));
-	}
+	bool bDeleteExtra = true;
+	Params->TryGetBoolField(TEXT("delete_extra"), bDeleteExtra);
 
-	// Get the value pointer
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Actor);
-	if (!ValuePtr)
-	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
-	}
+	const double StartTime = FPlatformTime::Seconds();
 
-	// Get the JSON value
-	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+	// Classify everything first so a dry run reports exactly what a real run would do
+	TArray<const FEpicUnrealMCPActorRecord*> ToSpawn;
+	TArray<TPair<AActor*, const FEpicUnrealMCPActorRecord*>> ToPatch;
+	TArray<AActor*> ToDelete;
+	int32 NumUnchanged = 0;
 
-	// Convert and set the value
-	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	TArray<AActor*> Existing;
+	TArray<const FEpicUnrealMCPActorRecord*> ExistingRecords;
+	for (const FEpicUnrealMCPActorRecord& Record : Snapshot->Actors)
 	{
-		return CreateErrorResponse(FString::Printf(
-			TEXT("Failed to set property value. Property type: %s"),
-			*GetPropertyTypeName(Property)
-		));
-	}
+		AActor* Actor = ActorIndex->Find(Record.Level, Record.Name);
+		if (!IsValid(Actor))
+		{
+			ToSpawn.Add(&Record);
+			continue;
+		}
 
-	// Mark actor as modified for editor undo/save
-	Actor->Modify();
-	Actor->MarkPackageDirty();
+		// A different class cannot be patched into place
+		if (Actor->GetClass()->GetPathName() != Record.ClassPath)
+		{
+			ToDelete.Add(Actor);
+			ToSpawn.Add(&Record);
+			continue;
+		}
 
-	// Notify about property change with proper property info
-	// This allows actors like SVGLegionSpawn to detect which property changed
-	// and update their editor visualization accordingly
-	FPropertyChangedEvent PropertyChangedEvent(Property);
-	Actor->PostEditChangeProperty(PropertyChangedEvent);
+		Existing.Add(Actor);
+		ExistingRecords.Add(&Record);
+	}
 
-	// Special handling for struct properties that contain sub-properties affecting visualization
-	// When setting a struct like SpawnContext, also trigger events for key sub-properties
-	// so that actors can properly update their editor visualization
-	UStructProperty* StructProp = Cast<UStructProperty>(Property);
-	if (StructProp)
+	TArray<FEpicUnrealMCPActorRecord> Current;
+	FEpicUnrealMCPActorRecord::CaptureAll(Existing, Current, false);
+	for (int32 Index = 0; Index < Existing.Num(); ++Index)
 	{
-		UScriptStruct* Struct = StructProp->Struct;
-		if (Struct)
+		if (Current[Index].Hash == ExistingRecords[Index]->Hash)
+		{
+			++NumUnchanged;
+		}
+		else
 		{
-			// List of sub-property names that commonly affect editor visualization
-			static const FName VisualizationProperties[] = {
-				FName("SoldierType"),
-				FName("SpawnType"),
-				FName("TeamID"),
-				FName("MissionSpawnWave"),
-				FName("bDisabled")
-			};
+			ToPatch.Emplace(Existing[Index], ExistingRecords[Index]);
+		}
+	}
 
-			for (const FName& SubPropName : VisualizationProperties)
+	if (bDeleteExtra)
+	{
+		for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
+		{
+			AActor* Actor = ActorPtr.Get();
+			if (IsValid(Actor) && FEpicUnrealMCPWorldSnapshot::CanCapture(Actor) && !Snapshot->FindRecord(FEpicUnrealMCPActorIndex::GetLevelName(Actor), Actor->GetFName()) &&
+				(Filter.IsEmpty() || Filter.Matches(Actor)))
 			{
-				if (UProperty* SubProp = Struct->FindPropertyByName(SubPropName))
-				{
-					FPropertyChangedEvent SubPropEvent(SubProp);
-					Actor->PostEditChangeProperty(SubPropEvent);
-				}
+				ToDelete.Add(Actor);
 			}
 		}
 	}
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("actor"), ActorName);
-	Result->SetStringField(TEXT("property"), PropertyName);
-	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
-	Result->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
-
-	return Result;
-}
-
-// ============================================================================
-// Blueprint Actor Commands
-// ============================================================================
+	Result->SetStringField(TEXT("name"), SnapshotName);
+	Result->SetBoolField(TEXT("dry_run"), bDryRun);
+	Result->SetNumberField(TEXT("unchanged"), NumUnchanged);
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
-{
-	FString BlueprintPath;
-	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	if (bDryRun)
 	{
-		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
-	}
+		TArray<TSharedPtr<FJsonValue>> SpawnNames;
+		for (const FEpicUnrealMCPActorRecord* Record : ToSpawn)
+		{
+			SpawnNames.Add(MakeShared<FJsonValueString>(Record->Name.ToString()));
+		}
+		TArray<TSharedPtr<FJsonValue>> PatchNames;
+		for (const TPair<AActor*, const FEpicUnrealMCPActorRecord*>& Entry : ToPatch)
+		{
+			PatchNames.Add(MakeShared<FJsonValueString>(Entry.Key->GetName()));
+		}
+		TArray<TSharedPtr<FJsonValue>> DeleteNames;
+		for (AActor* Actor : ToDelete)
+		{
+			DeleteNames.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+		}
 
-	FString ActorName;
-	if (!Params->TryGetStringField(TEXT("actor_name"), ActorName))
-	{
-		return CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+		Result->SetNumberField(TEXT("spawned"), ToSpawn.Num());
+		Result->SetNumberField(TEXT("patched"), ToPatch.Num());
+		Result->SetNumberField(TEXT("deleted"), ToDelete.Num());
+		Result->SetArrayField(TEXT("to_spawn"), SpawnNames);
+		Result->SetArrayField(TEXT("to_patch"), PatchNames);
+		Result->SetArrayField(TEXT("to_delete"), DeleteNames);
+		return Result;
 	}
 
-	FVector Location = GetVectorFromJson(Params, TEXT("location"));
-	FRotator Rotation = GetRotatorFromJson(Params, TEXT("rotation"));
-	FVector Scale(1, 1, 1);
-	if (Params->HasField(TEXT("scale")))
+	// HandleCommand's transaction makes the whole restore one undo step
+	FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+	int32 NumDeleted = 0;
+	for (AActor* Actor : ToDelete)
 	{
-		Scale = GetVectorFromJson(Params, TEXT("scale"));
+		if (GEditor && Actor->IsSelected())
+		{
+			GEditor->SelectActor(Actor, false, false);
+		}
+		if (World->EditorDestroyActor(Actor, true))
+		{
+			++NumDeleted;
+		}
 	}
 
-	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-	if (!World)
+	for (const TPair<AActor*, const FEpicUnrealMCPActorRecord*>& Entry : ToPatch)
 	{
-		return CreateErrorResponse(TEXT("No editor world available"));
+		ApplyActorRecord(Entry.Key, *Entry.Value);
 	}
 
-	// Load the Blueprint class (append _C if not present)
-	FString ClassPath = BlueprintPath;
-	if (!ClassPath.EndsWith(TEXT("_C")))
+	TArray<FEpicUnrealMCPSpawnSpec> Specs;
+	TArray<FString> SpecErrors;
+	Specs.SetNum(ToSpawn.Num());
+	SpecErrors.SetNum(ToSpawn.Num());
+	for (int32 Index = 0; Index < ToSpawn.Num(); ++Index)
 	{
-		ClassPath += TEXT("_C");
+		const FEpicUnrealMCPActorRecord& Record = *ToSpawn[Index];
+		FEpicUnrealMCPSpawnSpec& Spec = Specs[Index];
+
+		Spec.ActorClass = AssetCache->Load<UClass>(Record.ClassPath);
+		if (!Spec.ActorClass || !Spec.ActorClass->IsChildOf(AActor::StaticClass()))
+		{
+			SpecErrors[Index] = FString::Printf(TEXT("Failed to load actor class '%s'"), *Record.ClassPath);
+			continue;
+		}
+
+		Spec.Name = Record.Name.ToString();
+		Spec.Transform = Record.Transform;
+		Spec.FolderPath = Record.FolderPath;
+		if (!Record.StaticMesh.IsEmpty())
+		{
+			Spec.StaticMesh = AssetCache->Load<UStaticMesh>(Record.StaticMesh);
+		}
+		for (const FString& MaterialPath : Record.Materials)
+		{
+			Spec.Materials.Add(MaterialPath.IsEmpty() ? nullptr : AssetCache->Load<UMaterialInterface>(MaterialPath));
+		}
+		for (int32 PropertyIndex = 0; PropertyIndex < Record.PropertyNames.Num(); ++PropertyIndex)
+		{
+			Spec.PropertyValues.Add(Record.PropertyNames[PropertyIndex], Record.PropertyValues[PropertyIndex]);
+		}
+
+		// An actor destroyed above still holds its name until garbage collection, and
+		// SpawnActor treats a taken name as fatal
+		UObject* Stale = StaticFindObjectFast(nullptr, World->GetCurrentLevel(), Record.Name);
+		if (Stale && Stale->IsPendingKill())
+		{
+			Stale->Rename(nullptr, nullptr, REN_DontCreateRedirectors | REN_ForceNoResetLoaders);
+		}
 	}
 
-	UClass* ActorClass = LoadClass<AActor>(nullptr, *ClassPath);
-	if (!ActorClass)
+	TSharedPtr<FJsonObject> SpawnResult = SpawnActorBatch(World, Specs, SpecErrors, false, false);
+
+	// The spawn path only sets meshes on static mesh actors and knows nothing of labels or instance components.
+	// Everything is spawned into the current level, whichever level the record came from.
+	const FName SpawnLevelName = FEpicUnrealMCPActorIndex::GetLevelName(World->GetCurrentLevel());
+	for (const FEpicUnrealMCPActorRecord* Record : ToSpawn)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint class: %s"), *ClassPath));
+		if (AActor* Actor = ActorIndex->Find(SpawnLevelName, Record->Name))
+		{
+			ApplyActorRecord(Actor, *Record);
+		}
 	}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Name = FName(*ActorName);
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AActor* NewActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
-	if (!NewActor)
+	TArray<TSharedPtr<FJsonValue>> Errors;
+	for (const TSharedPtr<FJsonValue>& ErrorValue : SpawnResult->GetArrayField(TEXT("errors")))
 	{
-		return CreateErrorResponse(TEXT("Failed to spawn Blueprint actor"));
+		TSharedPtr<FJsonObject> ErrorObj = ErrorValue->AsObject();
+		ErrorObj->SetStringField(TEXT("name"), ToSpawn[ErrorObj->GetIntegerField(TEXT("index"))]->Name.ToString());
+		ErrorObj->RemoveField(TEXT("index"));
+		Errors.Add(ErrorValue);
 	}
 
-	NewActor->SetActorScale3D(Scale);
-	NewActor->MarkPackageDirty();
+	BulkEdit->NotifyPackageDirty(World->GetCurrentLevel());
+	BulkEdit->RequestRedraw();
 
-	return ActorToJsonObject(NewActor, true);
+	Result->SetNumberField(TEXT("spawned"), SpawnResult->GetNumberField(TEXT("spawned")));
+	Result->SetNumberField(TEXT("patched"), ToPatch.Num());
+	Result->SetNumberField(TEXT("deleted"), NumDeleted);
+	Result->SetArrayField(TEXT("errors"), Errors);
+	Result->SetNumberField(TEXT("restore_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCopyActor(const TSharedPtr<FJsonObject>& Params)
+// Loads the saved version of World's map under a temporary package name, leaving the open map alone.
+// Only the persistent level is loaded and nothing is registered or initialized.
+static UWorld* LoadSavedMapCopy(UWorld* World, FString& OutError)
 {
-	FString SourceName;
-	if (!Params->TryGetStringField(TEXT("source_name"), SourceName))
+	const FString PackageName = World->GetOutermost()->GetName();
+	FString MapFilename;
+	if (!FPackageName::DoesPackageExist(PackageName, nullptr, &MapFilename))
 	{
-		return CreateErrorResponse(TEXT("Missing 'source_name' parameter"));
+		OutError = FString::Printf(TEXT("Map '%s' has not been saved"), *PackageName);
+		return nullptr;
 	}
 
-	FString NewName;
-	if (!Params->TryGetStringField(TEXT("new_name"), NewName))
+	const FName DiffPackageName = MakeUniqueObjectName(nullptr, UPackage::StaticClass(),
+		FName(*(TEXT("/Temp/MCPDiff/") + FPackageName::GetShortName(PackageName))));
+	UPackage* DiffPackage = LoadPackage(CreatePackage(*DiffPackageName.ToString()), *MapFilename,
+		LOAD_ForDiff | LOAD_DisableCompileOnLoad | LOAD_NoWarn);
+	UWorld* DiffWorld = DiffPackage ? UWorld::FindWorldInPackage(DiffPackage) : nullptr;
+	if (!DiffWorld || !DiffWorld->PersistentLevel)
 	{
-		return CreateErrorResponse(TEXT("Missing 'new_name' parameter"));
+		OutError = FString::Printf(TEXT("Failed to load saved map '%s'"), *MapFilename);
+		return nullptr;
 	}
+	return DiffWorld;
+}
 
-	AActor* SourceActor = FindActorByName(SourceName);
-	if (!SourceActor)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Source actor not found: %s"), *SourceName));
-	}
+// Frees the copy loaded by LoadSavedMapCopy right away; a large map would otherwise stay resident until the next
+// periodic collection. DiffWorld and every object loaded with it are invalid afterwards.
+static void ReleaseSavedMapCopy(UWorld* DiffWorld)
+{
+	UPackage* DiffPackage = DiffWorld->GetOutermost();
+	ResetLoaders(DiffPackage);
+	ForEachObjectWithOuter(DiffPackage, [](UObject* Object)
+	{
+		Object->ClearFlags(RF_Standalone | RF_Public);
+	}, true);
+	DiffPackage->ClearFlags(RF_Standalone);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
 
-	UWorld* World = SourceActor->GetWorld();
-	if (!World)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDiffWorld(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BaseName;
+	Params->TryGetStringField(TEXT("snapshot"), BaseName);
+
+	bool bSavedMap = false;
+	Params->TryGetBoolField(TEXT("saved_map"), bSavedMap);
+
+	if (BaseName.IsEmpty() == !bSavedMap)
 	{
-		return CreateErrorResponse(TEXT("No world available"));
+		return CreateErrorResponse(TEXT("Provide either 'snapshot' or 'saved_map'"));
 	}
 
-	// Determine spawn location
-	FVector SpawnLocation = SourceActor->GetActorLocation();
-	FRotator SpawnRotation = SourceActor->GetActorRotation();
+	FString TargetName;
+	Params->TryGetStringField(TEXT("target"), TargetName);
+
+	int32 MaxEntries = 1000;
+	Params->TryGetNumberField(TEXT("max_entries"), MaxEntries);
 
-	if (Params->HasField(TEXT("location")))
+	UWorld* World = ActorIndex->GetWorld();
+	if (!World)
 	{
-		SpawnLocation = GetVectorFromJson(Params, TEXT("location"));
+		return CreateErrorResponse(TEXT("No editor world available"));
 	}
-	else if (Params->HasField(TEXT("offset")))
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Base side: a snapshot, or the map as last saved
+	TArray<FEpicUnrealMCPActorRecord> SavedRecords;
+	const TArray<FEpicUnrealMCPActorRecord>* BaseRecords = &SavedRecords;
+	FEpicUnrealMCPActorFilter Scope;
+	FString BaseLabel;
+	if (bSavedMap)
 	{
-		SpawnLocation += GetVectorFromJson(Params, TEXT("offset"));
+		FString LoadError;
+		UWorld* DiffWorld = LoadSavedMapCopy(World, LoadError);
+		if (!DiffWorld)
+		{
+			return CreateErrorResponse(LoadError);
+		}
+
+		TArray<AActor*> SavedActors;
+		for (AActor* Actor : DiffWorld->PersistentLevel->Actors)
+		{
+			if (Actor && FEpicUnrealMCPWorldSnapshot::CanCapture(Actor))
+			{
+				SavedActors.Add(Actor);
+			}
+		}
+		FEpicUnrealMCPActorRecord::CaptureAll(SavedActors, SavedRecords, false);
+		ReleaseSavedMapCopy(DiffWorld);
+		BaseLabel = TEXT("saved_map");
 	}
 	else
 	{
-		SpawnLocation += FVector(500, 0, 0); // Default offset
+		TSharedPtr<FEpicUnrealMCPWorldSnapshot> Base = FindSnapshot(BaseName);
+		if (!Base.IsValid())
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' not found"), *BaseName));
+		}
+		if (!Base->CompileFilter(Scope))
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' has an invalid filter"), *BaseName));
+		}
+		BaseRecords = &Base->Actors;
+		BaseLabel = BaseName;
 	}
 
-	if (Params->HasField(TEXT("rotation")))
+	// Target side: another snapshot, or the level as it is now
+	TArray<FEpicUnrealMCPActorRecord> CurrentRecords;
+	const TArray<FEpicUnrealMCPActorRecord>* TargetRecords = &CurrentRecords;
+	TSharedPtr<FEpicUnrealMCPWorldSnapshot> Target;
+	if (!TargetName.IsEmpty())
 	{
-		SpawnRotation = GetRotatorFromJson(Params, TEXT("rotation"));
+		Target = FindSnapshot(TargetName);
+		if (!Target.IsValid())
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Snapshot '%s' not found"), *TargetName));
+		}
+		TargetRecords = &Target->Actors;
 	}
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Name = FName(*NewName);
-	SpawnParams.Template = SourceActor; // Copy all properties from source
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AActor* NewActor = World->SpawnActor<AActor>(
-		SourceActor->GetClass(),
-		SpawnLocation,
-		SpawnRotation,
-		SpawnParams
-	);
-
-	if (!NewActor)
+	else
 	{
-		return CreateErrorResponse(TEXT("Failed to copy actor"));
-	}
+		TSet<TPair<FName, FName>> BaseKeys;
+		BaseKeys.Reserve(BaseRecords->Num());
+		for (const FEpicUnrealMCPActorRecord& Record : *BaseRecords)
+		{
+			BaseKeys.Add(Record.GetKey());
+		}
 
-	NewActor->SetActorScale3D(SourceActor->GetActorScale3D());
-	NewActor->MarkPackageDirty();
+		// Actors the base knows about count even after leaving its scope, so they show as changed rather than removed
+		TArray<AActor*> Actors;
+		for (const TWeakObjectPtr<AActor>& ActorPtr : ActorIndex->GetActors())
+		{
+			AActor* Actor = ActorPtr.Get();
+			if (!IsValid(Actor) || !FEpicUnrealMCPWorldSnapshot::CanCapture(Actor))
+			{
+				continue;
+			}
+			if (bSavedMap && Actor->GetLevel() != World->PersistentLevel)
+			{
+				continue;
+			}
+			if (Scope.IsEmpty() || Scope.Matches(Actor) || BaseKeys.Contains(TPair<FName, FName>(FEpicUnrealMCPActorIndex::GetLevelName(Actor), Actor->GetFName())))
+			{
+				Actors.Add(Actor);
+			}
+		}
+		FEpicUnrealMCPActorRecord::CaptureAll(Actors, CurrentRecords, false);
+	}
 
-	return ActorToJsonObject(NewActor, true);
-}
+	const double CaptureSeconds = FPlatformTime::Seconds() - StartTime;
 
-// ============================================================================
-// Asset Property Commands
-// ============================================================================
+	FEpicUnrealMCPWorldDiff Diff;
+	Diff.Compute(*BaseRecords, *TargetRecords);
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetAssetProperty(const TSharedPtr<FJsonObject>& Params)
-{
-	FString AssetPath;
-	if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	// Counts are always complete; the lists stop at max_entries each
+	bool bTruncated = false;
+	auto LimitReached = [MaxEntries, &bTruncated](int32 Num)
 	{
-		return CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
-	}
+		if (MaxEntries > 0 && Num >= MaxEntries)
+		{
+			bTruncated = true;
+			return true;
+		}
+		return false;
+	};
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	TArray<TSharedPtr<FJsonValue>> AddedJson;
+	for (int32 Index : Diff.Added)
 	{
-		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+		if (LimitReached(AddedJson.Num()))
+		{
+			break;
+		}
+		AddedJson.Add(MakeShared<FJsonValueString>((*TargetRecords)[Index].Name.ToString()));
 	}
 
-	// Load the asset
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset)
+	TArray<TSharedPtr<FJsonValue>> RemovedJson;
+	for (int32 Index : Diff.Removed)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath));
+		if (LimitReached(RemovedJson.Num()))
+		{
+			break;
+		}
+		RemovedJson.Add(MakeShared<FJsonValueString>((*BaseRecords)[Index].Name.ToString()));
 	}
 
-	// Find the property
-	UProperty* Property = Asset->GetClass()->FindPropertyByName(*PropertyName);
-	if (!Property)
+	TArray<TSharedPtr<FJsonValue>> MovedJson;
+	for (const TPair<int32, int32>& Entry : Diff.Moved)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
+		if (LimitReached(MovedJson.Num()))
+		{
+			break;
+		}
+		const FEpicUnrealMCPActorRecord& Before = (*BaseRecords)[Entry.Key];
+		const FEpicUnrealMCPActorRecord& After = (*TargetRecords)[Entry.Value];
+		TSharedPtr<FJsonObject> MoveJson = MakeShared<FJsonObject>();
+		MoveJson->SetStringField(TEXT("name"), After.Name.ToString());
+		MoveJson->SetObjectField(TEXT("from"), TransformToJsonObject(Before.Transform));
+		MoveJson->SetObjectField(TEXT("to"), TransformToJsonObject(After.Transform));
+		MovedJson.Add(MakeShared<FJsonValueObject>(MoveJson));
 	}
 
-	// Get value pointer
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Asset);
-	if (!ValuePtr)
+	TArray<TSharedPtr<FJsonValue>> ChangedJson;
+	for (int32 ChangeIndex = 0; ChangeIndex < Diff.Changed.Num(); ++ChangeIndex)
 	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
+		if (LimitReached(ChangedJson.Num()))
+		{
+			break;
+		}
+		TArray<TSharedPtr<FJsonValue>> FieldsJson;
+		for (const FString& Field : Diff.ChangedFields[ChangeIndex])
+		{
+			FieldsJson.Add(MakeShared<FJsonValueString>(Field));
+		}
+		TSharedPtr<FJsonObject> ChangeJson = MakeShared<FJsonObject>();
+		ChangeJson->SetStringField(TEXT("name"), (*TargetRecords)[Diff.Changed[ChangeIndex].Value].Name.ToString());
+		ChangeJson->SetArrayField(TEXT("fields"), FieldsJson);
+		ChangedJson.Add(MakeShared<FJsonValueObject>(ChangeJson));
 	}
 
-	// Build response
-	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
-	Response->SetBoolField(TEXT("success"), true);
-	Response->SetStringField(TEXT("asset"), AssetPath);
-	Response->SetStringField(TEXT("property"), PropertyName);
-	Response->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
-	Response->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
+	TSharedPtr<FJsonObject> CountsJson = MakeShared<FJsonObject>();
+	CountsJson->SetNumberField(TEXT("added"), Diff.Added.Num());
+	CountsJson->SetNumberField(TEXT("removed"), Diff.Removed.Num());
+	CountsJson->SetNumberField(TEXT("moved"), Diff.Moved.Num());
+	CountsJson->SetNumberField(TEXT("changed"), Diff.Changed.Num());
+	CountsJson->SetNumberField(TEXT("unchanged"), Diff.NumUnchanged);
 
-	return Response;
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("base"), BaseLabel);
+	Result->SetStringField(TEXT("target"), TargetName.IsEmpty() ? TEXT("level") : TargetName);
+	Result->SetObjectField(TEXT("counts"), CountsJson);
+	Result->SetArrayField(TEXT("added"), AddedJson);
+	Result->SetArrayField(TEXT("removed"), RemovedJson);
+	Result->SetArrayField(TEXT("moved"), MovedJson);
+	Result->SetArrayField(TEXT("changed"), ChangedJson);
+	Result->SetBoolField(TEXT("truncated"), bTruncated);
+	Result->SetNumberField(TEXT("capture_ms"), CaptureSeconds * 1000.0);
+	Result->SetNumberField(TEXT("diff_ms"), (FPlatformTime::Seconds() - StartTime - CaptureSeconds) * 1000.0);
+	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetAssetProperty(const TSharedPtr<FJsonObject>& Params)
+// ============================================================================
+// Component Commands
+// ============================================================================
+
+// Resolves a component class by name ("StaticMeshComponent") or by path for Blueprint components
+static UClass* ResolveComponentClass(const FString& ClassName, FString& OutError)
 {
-	FString AssetPath;
-	if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	UClass* Class = ClassName.Contains(TEXT("/"))
+		? LoadObject<UClass>(nullptr, *ClassName)
+		: FindObject<UClass>(ANY_PACKAGE, *ClassName);
+	if (!Class || !Class->IsChildOf(UActorComponent::StaticClass()))
 	{
-		return CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
+		OutError = FString::Printf(TEXT("Unknown component class: %s"), *ClassName);
+		return nullptr;
 	}
+	return Class;
+}
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
-	{
-		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
-	}
+static TArray<TSharedPtr<FJsonValue>> RotatorToJsonArray(const FRotator& Rotator)
+{
+	TArray<TSharedPtr<FJsonValue>> Array;
+	Array.Add(MakeShared<FJsonValueNumber>(Rotator.Pitch));
+	Array.Add(MakeShared<FJsonValueNumber>(Rotator.Yaw));
+	Array.Add(MakeShared<FJsonValueNumber>(Rotator.Roll));
+	return Array;
+}
 
-	if (!Params->HasField(TEXT("value")))
+static TSharedPtr<FJsonObject> ComponentToJsonObject(UActorComponent* Component, FName PropertyName)
+{
+	TSharedPtr<FJsonObject> ComponentObj = MakeShared<FJsonObject>();
+	ComponentObj->SetStringField(TEXT("name"), Component->GetName());
+	ComponentObj->SetStringField(TEXT("class"), Component->GetClass()->GetName());
+	if (!PropertyName.IsNone())
 	{
-		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
+		ComponentObj->SetStringField(TEXT("property"), PropertyName.ToString());
 	}
 
-	// Load the asset
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset)
+	USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+	ComponentObj->SetBoolField(TEXT("scene"), SceneComponent != nullptr);
+	if (SceneComponent)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath));
+		if (USceneComponent* Parent = SceneComponent->GetAttachParent())
+		{
+			ComponentObj->SetStringField(TEXT("parent"), Parent->GetName());
+		}
+		ComponentObj->SetArrayField(TEXT("location"), VectorToJsonArray(SceneComponent->GetRelativeLocation()));
+		ComponentObj->SetArrayField(TEXT("rotation"), RotatorToJsonArray(SceneComponent->GetRelativeRotation()));
+		ComponentObj->SetArrayField(TEXT("scale"), VectorToJsonArray(SceneComponent->GetRelativeScale3D()));
+		ComponentObj->SetArrayField(TEXT("world_location"), VectorToJsonArray(SceneComponent->GetComponentLocation()));
 	}
+	return ComponentObj;
+}
 
-	// Find the property
-	UProperty* Property = Asset->GetClass()->FindPropertyByName(*PropertyName);
-	if (!Property)
+bool FEpicUnrealMCPEditorCommands::FindComponentTarget(const TSharedPtr<FJsonObject>& Params, AActor*& OutActor, UActorComponent*& OutComponent,
+	FString& OutPropertyPath, FString& OutError)
+{
+	FString ActorName;
+	FString ComponentName;
+	FString Path;
+	if (Params->TryGetStringField(TEXT("path"), Path))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
+		// "Actor.Component.Property.Sub"; the property part is optional for commands that do not need one
+		FString Rest;
+		if (!Path.Split(TEXT("."), &ActorName, &Rest) || ActorName.IsEmpty() || Rest.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("Invalid path, expected Actor.Component.Property: %s"), *Path);
+			return false;
+		}
+		if (!Rest.Split(TEXT("."), &ComponentName, &OutPropertyPath))
+		{
+			ComponentName = Rest;
+		}
 	}
-
-	// Check if editable
-	if (Property->HasAnyPropertyFlags(CPF_EditConst))
+	else if (!Params->TryGetStringField(TEXT("name"), ActorName) || !Params->TryGetStringField(TEXT("component"), ComponentName))
 	{
-		return CreateErrorResponse(TEXT("Property is read-only"));
+		OutError = TEXT("Missing 'name' and 'component' parameters (or 'path' as Actor.Component.Property)");
+		return false;
 	}
 
-	// Get value pointer
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Asset);
-	if (!ValuePtr)
+	OutActor = ActorIndex->FindByName(ActorName);
+	if (!OutActor)
 	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
+		OutError = FString::Printf(TEXT("Actor not found: %s"), *ActorName);
+		return false;
 	}
 
-	// Set the value using existing helper
-	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
-	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	OutComponent = ComponentIndex->Find(OutActor, ComponentName);
+	if (!OutComponent)
 	{
-		return CreateErrorResponse(TEXT("Failed to set property value"));
+		OutError = FString::Printf(TEXT("Component not found on %s: %s"), *ActorName, *ComponentName);
+		return false;
 	}
-
-	// Mark dirty (no compilation needed for Data Assets)
-	Asset->Modify();
-	Asset->MarkPackageDirty();
-
-	// Build response
-	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
-	Response->SetBoolField(TEXT("success"), true);
-	Response->SetStringField(TEXT("asset"), AssetPath);
-	Response->SetStringField(TEXT("property"), PropertyName);
-	Response->SetField(TEXT("new_value"), PropertyToJsonValue(Property, ValuePtr));
-
-	return Response;
+	return true;
 }
 
-// ============================================================================
-// Blueprint Default Property Commands
-// ============================================================================
-
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetBlueprintDefaultProperty(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleListComponents(const TSharedPtr<FJsonObject>& Params)
 {
-	FString BlueprintPath;
-	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	FString ActorName;
+	if (!Params->TryGetStringField(TEXT("name"), ActorName))
 	{
-		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+		return CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	AActor* Actor = FindActorByName(ActorName);
+	if (!Actor)
 	{
-		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
+		return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
 	}
 
-	// Load the Blueprint class (append _C if not present)
-	FString ClassPath = BlueprintPath;
-	if (!ClassPath.EndsWith(TEXT("_C")))
+	UClass* ComponentClass = nullptr;
+	FString ComponentClassName;
+	if (Params->TryGetStringField(TEXT("component_class"), ComponentClassName) && !ComponentClassName.IsEmpty())
 	{
-		ClassPath += TEXT("_C");
+		FString ClassError;
+		ComponentClass = ResolveComponentClass(ComponentClassName, ClassError);
+		if (!ComponentClass)
+		{
+			return CreateErrorResponse(ClassError);
+		}
 	}
 
-	UClass* BPClass = LoadClass<UObject>(nullptr, *ClassPath);
-	if (!BPClass)
+	TArray<TSharedPtr<FJsonValue>> ComponentsJson;
+	for (const FEpicUnrealMCPComponentEntry& Entry : ComponentIndex->GetComponents(Actor))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint class: %s"), *ClassPath));
+		UActorComponent* Component = Entry.Component.Get();
+		if (Component && (!ComponentClass || Component->IsA(ComponentClass)))
+		{
+			ComponentsJson.Add(MakeShared<FJsonValueObject>(ComponentToJsonObject(Component, Entry.PropertyName)));
+		}
 	}
 
-	// Get the Class Default Object (CDO)
-	UObject* CDO = BPClass->GetDefaultObject();
-	if (!CDO)
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), ActorName);
+	if (USceneComponent* Root = Actor->GetRootComponent())
 	{
-		return CreateErrorResponse(TEXT("Failed to get Class Default Object"));
+		Result->SetStringField(TEXT("root"), Root->GetName());
 	}
+	Result->SetArrayField(TEXT("components"), ComponentsJson);
+	Result->SetNumberField(TEXT("count"), ComponentsJson.Num());
+	return Result;
+}
 
-	// Find the property
-	UProperty* Property = BPClass->FindPropertyByName(*PropertyName);
-	if (!Property)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetComponentProperty(const TSharedPtr<FJsonObject>& Params)
+{
+	AActor* Actor = nullptr;
+	UActorComponent* Component = nullptr;
+	FString PropertyName;
+	FString TargetError;
+	if (!FindComponentTarget(Params, Actor, Component, PropertyName, TargetError))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
+		return CreateErrorResponse(TargetError);
 	}
 
-	// Get value pointer from CDO
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(CDO);
-	if (!ValuePtr)
+	// A property given inside 'path' takes the place of 'property'/'continuation'
+	FEpicUnrealMCPConvertLimits Limits;
+	if (PropertyName.IsEmpty())
+	{
+		FString RequestError;
+		if (!ReadPropertyRequest(Params, PropertyName, Limits, RequestError))
+		{
+			return CreateErrorResponse(RequestError);
+		}
+	}
+	else
 	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
+		ReadConvertLimits(Params, Limits);
 	}
 
-	// Build response
-	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
-	Response->SetBoolField(TEXT("success"), true);
-	Response->SetStringField(TEXT("blueprint"), BlueprintPath);
-	Response->SetStringField(TEXT("property"), PropertyName);
-	Response->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
-	Response->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Component, PropertyName, Resolved, PathError))
+	{
+		return CreateErrorResponse(PathError);
+	}
 
-	return Response;
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), Actor->GetName());
+	Result->SetStringField(TEXT("component"), Component->GetName());
+	Result->SetStringField(TEXT("property"), PropertyName);
+	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Resolved.Property));
+	Result->SetField(TEXT("value"), PropertyToJsonValue(Resolved.Property, Resolved.ValuePtr, Limits, PropertyName));
+	SetPropertyCount(*Result, Resolved.Property, Resolved.ValuePtr);
+	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetBlueprintDefaultProperty(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetComponentProperty(const TSharedPtr<FJsonObject>& Params)
 {
-	FString BlueprintPath;
-	if (!Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	AActor* Actor = nullptr;
+	UActorComponent* Component = nullptr;
+	FString PropertyName;
+	FString TargetError;
+	if (!FindComponentTarget(Params, Actor, Component, PropertyName, TargetError))
 	{
-		return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+		return CreateErrorResponse(TargetError);
 	}
 
-	FString PropertyName;
-	if (!Params->TryGetStringField(TEXT("property"), PropertyName))
+	if (PropertyName.IsEmpty() && !Params->TryGetStringField(TEXT("property"), PropertyName))
 	{
 		return CreateErrorResponse(TEXT("Missing 'property' parameter"));
 	}
 
-	if (!Params->HasField(TEXT("value")))
+	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+	if (!JsonValue.IsValid())
 	{
 		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
 	}
 
-	// Load the Blueprint asset (not just the class)
-	FString BPAssetPath = BlueprintPath;
-	if (BPAssetPath.EndsWith(TEXT("_C")))
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!PropertyResolver->Resolve(Component, PropertyName, Resolved, PathError, true))
 	{
-		BPAssetPath = BPAssetPath.LeftChop(2);
+		return CreateErrorResponse(PathError);
 	}
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BPAssetPath);
-	if (!Blueprint)
+	if (Resolved.Property->HasAnyPropertyFlags(CPF_EditConst) || Resolved.MemberProperty->HasAnyPropertyFlags(CPF_EditConst))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint: %s"), *BPAssetPath));
+		return CreateErrorResponse(FString::Printf(TEXT("Property is read-only: %s"), *PropertyName));
 	}
 
-	// Get the generated class
-	UClass* BPClass = Blueprint->GeneratedClass;
-	if (!BPClass)
+	// Record the old state for undo before writing
+	Resolved.Object->Modify(false);
+
+	if (!JsonValueToProperty(JsonValue, Resolved.Property, Resolved.ValuePtr))
 	{
-		return CreateErrorResponse(TEXT("Blueprint has no GeneratedClass - needs compilation"));
+		return CreateErrorResponse(FString::Printf(
+			TEXT("Failed to set property value. Property type: %s"),
+			*GetPropertyTypeName(Resolved.Property)
+		));
 	}
 
-	// Get the CDO
-	UObject* CDO = BPClass->GetDefaultObject();
-	if (!CDO)
 	{
-		return CreateErrorResponse(TEXT("Failed to get Class Default Object"));
+		// Components re-register and update their render state from the change event, sent once when the scope ends
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+		BulkEdit->NotifyPackageDirty(Resolved.Object);
+		NotifyPolicy->NotifyWrite(*BulkEdit, Resolved.Object, Resolved.MemberProperty, Resolved.Property);
 	}
 
-	// Find the property
-	UProperty* Property = BPClass->FindPropertyByName(*PropertyName);
-	if (!Property)
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), Actor->GetName());
+	Result->SetStringField(TEXT("component"), Component->GetName());
+	Result->SetStringField(TEXT("property"), PropertyName);
+	Result->SetStringField(TEXT("type"), GetPropertyTypeName(Resolved.Property));
+	Result->SetField(TEXT("value"), PropertyToJsonValue(Resolved.Property, Resolved.ValuePtr));
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetComponentTransform(const TSharedPtr<FJsonObject>& Params)
+{
+	AActor* Actor = nullptr;
+	UActorComponent* Component = nullptr;
+	FString IgnoredPath;
+	FString TargetError;
+	if (!FindComponentTarget(Params, Actor, Component, IgnoredPath, TargetError))
+	{
+		return CreateErrorResponse(TargetError);
+	}
+
+	USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+	if (!SceneComponent)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Component has no transform: %s"), *Component->GetName()));
+	}
+
+	// Relative to the attach parent unless world=true
+	bool bWorld = false;
+	Params->TryGetBoolField(TEXT("world"), bWorld);
+
+	SceneComponent->Modify(false);
+	if (Params->HasField(TEXT("location")))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Property not found: %s"), *PropertyName));
+		const FVector Location = GetVectorFromJson(Params, TEXT("location"));
+		bWorld ? SceneComponent->SetWorldLocation(Location) : SceneComponent->SetRelativeLocation(Location);
 	}
-
-	// Check if editable
-	if (Property->HasAnyPropertyFlags(CPF_EditConst))
+	if (Params->HasField(TEXT("rotation")))
 	{
-		return CreateErrorResponse(TEXT("Property is read-only"));
+		const FRotator Rotation = GetRotatorFromJson(Params, TEXT("rotation"));
+		bWorld ? SceneComponent->SetWorldRotation(Rotation) : SceneComponent->SetRelativeRotation(Rotation);
 	}
-
-	// Get value pointer from CDO
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(CDO);
-	if (!ValuePtr)
+	if (Params->HasField(TEXT("scale")))
 	{
-		return CreateErrorResponse(TEXT("Failed to get property value pointer"));
+		const FVector Scale = GetVectorFromJson(Params, TEXT("scale"));
+		bWorld ? SceneComponent->SetWorldScale3D(Scale) : SceneComponent->SetRelativeScale3D(Scale);
 	}
 
-	// Set the value
-	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
-	if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+	// Moving the root moves the actor, which has its own move notification
+	if (SceneComponent == Actor->GetRootComponent())
 	{
-		return CreateErrorResponse(TEXT("Failed to set property value"));
+		BulkEdit->NotifyActorMoved(Actor);
 	}
+	BulkEdit->NotifyPackageDirty(SceneComponent);
+	BulkEdit->RequestRedraw();
 
-	// Mark Blueprint dirty and recompile
-	Blueprint->Modify();
-	Blueprint->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
-
-	// Build response
-	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
-	Response->SetBoolField(TEXT("success"), true);
-	Response->SetStringField(TEXT("blueprint"), BlueprintPath);
-	Response->SetStringField(TEXT("property"), PropertyName);
-	Response->SetField(TEXT("new_value"), PropertyToJsonValue(Property, ValuePtr));
-
-	return Response;
+	TSharedPtr<FJsonObject> Result = ComponentToJsonObject(SceneComponent, NAME_None);
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("actor"), Actor->GetName());
+	return Result;
 }
 
 // ============================================================================
-// Data Table Commands
+// Property Watch Commands
 // ============================================================================
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::RowStructToJson(UScriptStruct* RowStruct, const void* RowData)
+void FEpicUnrealMCPEditorCommands::WaitForPropertyChanges(uint32 TimeoutMs)
 {
-	TSharedPtr<FJsonObject> JsonObj = MakeShared<FJsonObject>();
+	PropertyWatch->WaitForChanges(TimeoutMs);
+}
 
-	if (!RowStruct || !RowData)
+// The object a PIE session made from an editor world actor or component, or nullptr if there is none
+static UObject* FindPlayWorldCounterpart(UObject* Object, FEpicUnrealMCPComponentIndex& ComponentIndex)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
 	{
-		return JsonObj;
+		return EditorUtilities::GetSimWorldCounterpartActor(Actor);
 	}
-
-	// Iterate all properties in the struct
-	for (TFieldIterator<UProperty> PropIt(RowStruct); PropIt; ++PropIt)
+	if (UActorComponent* Component = Cast<UActorComponent>(Object))
 	{
-		UProperty* Property = *PropIt;
-		FString PropName = Property->GetName();
-
-		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
-
-		// Create field object with type and value
-		TSharedPtr<FJsonObject> FieldObj = MakeShared<FJsonObject>();
-		FieldObj->SetStringField(TEXT("type"), GetPropertyTypeName(Property));
-		FieldObj->SetField(TEXT("value"), PropertyToJsonValue(Property, ValuePtr));
-
-		JsonObj->SetObjectField(PropName, FieldObj);
+		AActor* PlayActor = Component->GetOwner() ? EditorUtilities::GetSimWorldCounterpartActor(Component->GetOwner()) : nullptr;
+		return PlayActor ? ComponentIndex.Find(PlayActor, Component->GetName()) : nullptr;
 	}
-
-	return JsonObj;
+	// Assets are shared between the editor and PIE
+	return Object;
 }
 
-bool FEpicUnrealMCPEditorCommands::JsonToRowStruct(const TSharedPtr<FJsonObject>& JsonObj, UScriptStruct* RowStruct, void* RowData)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleWatchProperties(const TSharedPtr<FJsonObject>& Params)
 {
-	if (!JsonObj.IsValid() || !RowStruct || !RowData)
+	const TArray<TSharedPtr<FJsonValue>>* PropertiesJson;
+	if (!Params->TryGetArrayField(TEXT("properties"), PropertiesJson) || PropertiesJson->Num() == 0)
 	{
-		return false;
+		return CreateErrorResponse(TEXT("Missing 'properties' parameter (array of property paths)"));
 	}
 
-	for (TFieldIterator<UProperty> PropIt(RowStruct); PropIt; ++PropIt)
+	bool bPlayWorld = false;
+	Params->TryGetBoolField(TEXT("pie"), bPlayWorld);
+	if (bPlayWorld && (!GEditor || !GEditor->PlayWorld))
 	{
-		UProperty* Property = *PropIt;
-		FString PropName = Property->GetName();
+		return CreateErrorResponse(TEXT("No Play in Editor session is running"));
+	}
 
-		if (JsonObj->HasField(PropName))
-		{
-			TSharedPtr<FJsonValue> JsonValue;
+	double BudgetMs = 0.0;
+	if (Params->TryGetNumberField(TEXT("budget_ms"), BudgetMs))
+	{
+		PropertyWatch->SetBudget(BudgetMs / 1000.0);
+	}
 
-			// Support both {type, value} format and direct value
-			const TSharedPtr<FJsonObject>* FieldObj;
-			if (JsonObj->TryGetObjectField(PropName, FieldObj) && (*FieldObj)->HasField(TEXT("value")))
-			{
-				JsonValue = (*FieldObj)->TryGetField(TEXT("value"));
-			}
-			else
-			{
-				JsonValue = JsonObj->TryGetField(PropName);
-			}
+	TArray<FEpicUnrealMCPPropertyTarget> Targets;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	FString QueryError;
+	if (!CollectPropertyTargets(Params, Targets, Missing, QueryError))
+	{
+		return CreateErrorResponse(QueryError);
+	}
 
-			void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+	TArray<TSharedPtr<FJsonValue>> WatchesJson;
+	TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+	for (const FEpicUnrealMCPPropertyTarget& Target : Targets)
+	{
+		// Targets are found in the editor world; with pie=true the watch follows their PIE copies instead
+		UObject* Object = bPlayWorld ? FindPlayWorldCounterpart(Target.Object, *ComponentIndex) : Target.Object;
+		if (!Object)
+		{
+			Missing.Add(MakeShared<FJsonValueString>(Target.Name));
+			continue;
+		}
 
-			if (!JsonValueToProperty(JsonValue, Property, ValuePtr))
+		for (const TSharedPtr<FJsonValue>& PathValue : *PropertiesJson)
+		{
+			const FString Path = PathValue->AsString();
+			FString WatchError;
+			const int32 Id = PropertyWatch->Watch(Object, Target.Name, Path, WatchError);
+			if (Id == 0)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Failed to set DataTable row property: %s"), *PropName);
-				// Continue with other properties
+				TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+				ErrorJson->SetStringField(TEXT("target"), Target.Name);
+				ErrorJson->SetStringField(TEXT("property"), Path);
+				ErrorJson->SetStringField(TEXT("error"), WatchError);
+				ErrorsJson.Add(MakeShared<FJsonValueObject>(ErrorJson));
+				continue;
 			}
+
+			TSharedPtr<FJsonObject> WatchJson = MakeShared<FJsonObject>();
+			WatchJson->SetNumberField(TEXT("id"), Id);
+			WatchJson->SetStringField(TEXT("target"), Target.Name);
+			WatchJson->SetStringField(TEXT("property"), Path);
+			WatchesJson.Add(MakeShared<FJsonValueObject>(WatchJson));
 		}
 	}
-	return true;
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetArrayField(TEXT("watches"), WatchesJson);
+	Result->SetArrayField(TEXT("errors"), ErrorsJson);
+	Result->SetArrayField(TEXT("missing"), Missing);
+	Result->SetNumberField(TEXT("count"), WatchesJson.Num());
+	Result->SetNumberField(TEXT("total"), PropertyWatch->Num());
+	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleListDataTableRows(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandlePollPropertyChanges(const TSharedPtr<FJsonObject>& Params)
 {
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	// 'wait_ms' was already spent on the server thread before this request reached the game thread
+	FEpicUnrealMCPConvertLimits Limits;
+	ReadConvertLimits(Params, Limits);
+
+	const double Now = FPlatformTime::Seconds();
+	TArray<TSharedPtr<FJsonValue>> ChangesJson;
+	PropertyWatch->ConsumeChanges([&](const FEpicUnrealMCPPropertyWatchEntry& Entry)
+	{
+		TSharedPtr<FJsonObject> ChangeJson = MakeShared<FJsonObject>();
+		ChangeJson->SetNumberField(TEXT("id"), Entry.Id);
+		ChangeJson->SetStringField(TEXT("target"), Entry.Target);
+		ChangeJson->SetStringField(TEXT("property"), Entry.Path);
+		ChangeJson->SetNumberField(TEXT("changes"), Entry.Changes);
+		ChangeJson->SetNumberField(TEXT("age_ms"), (Now - Entry.LastChangeTime) * 1000.0);
+
+		// Values are read now, so several changes between polls report the latest one
+		FEpicUnrealMCPResolvedProperty Resolved;
+		FString PathError;
+		if (Entry.bRemoved)
+		{
+			ChangeJson->SetBoolField(TEXT("removed"), true);
+		}
+		else if (PropertyResolver->Resolve(Entry.Object.Get(), Entry.Path, Resolved, PathError))
+		{
+			ChangeJson->SetField(TEXT("value"), PropertyToJsonValue(Resolved.Property, Resolved.ValuePtr, Limits, Entry.Path));
+		}
+		else
+		{
+			ChangeJson->SetField(TEXT("value"), MakeShared<FJsonValueNull>());
+			ChangeJson->SetStringField(TEXT("error"), PathError);
+		}
+		ChangesJson.Add(MakeShared<FJsonValueObject>(ChangeJson));
+	});
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetArrayField(TEXT("changes"), ChangesJson);
+	Result->SetNumberField(TEXT("count"), ChangesJson.Num());
+	Result->SetNumberField(TEXT("watches"), PropertyWatch->Num());
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleUnwatchProperties(const TSharedPtr<FJsonObject>& Params)
+{
+	bool bAll = false;
+	Params->TryGetBoolField(TEXT("all"), bAll);
+
+	const TArray<TSharedPtr<FJsonValue>>* IdsJson = nullptr;
+	if (!bAll && !Params->TryGetArrayField(TEXT("ids"), IdsJson))
 	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+		return CreateErrorResponse(TEXT("Missing 'ids' parameter (or all=true)"));
 	}
 
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
+	int32 Removed = 0;
+	TArray<TSharedPtr<FJsonValue>> UnknownJson;
+	if (bAll)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+		Removed = PropertyWatch->UnwatchAll();
 	}
-
-	TArray<FName> RowNames = DataTable->GetRowNames();
-	TArray<TSharedPtr<FJsonValue>> RowNamesJson;
-
-	for (const FName& RowName : RowNames)
+	else
 	{
-		RowNamesJson.Add(MakeShared<FJsonValueString>(RowName.ToString()));
+		for (const TSharedPtr<FJsonValue>& IdValue : *IdsJson)
+		{
+			if (PropertyWatch->Unwatch(static_cast<int32>(IdValue->AsNumber())))
+			{
+				++Removed;
+			}
+			else
+			{
+				UnknownJson.Add(IdValue);
+			}
+		}
 	}
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_struct"), DataTable->GetRowStruct() ? DataTable->GetRowStruct()->GetName() : TEXT("Unknown"));
-	Result->SetArrayField(TEXT("row_names"), RowNamesJson);
-	Result->SetNumberField(TEXT("count"), RowNames.Num());
-
+	Result->SetNumberField(TEXT("removed"), Removed);
+	Result->SetArrayField(TEXT("unknown"), UnknownJson);
+	Result->SetNumberField(TEXT("watches"), PropertyWatch->Num());
 	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetDataTableRow(const TSharedPtr<FJsonObject>& Params)
+// ============================================================================
+// Multi-Object Property Commands
+// ============================================================================
+
+bool FEpicUnrealMCPEditorCommands::CollectPropertyTargets(const TSharedPtr<FJsonObject>& Params, TArray<FEpicUnrealMCPPropertyTarget>& OutTargets,
+	TArray<TSharedPtr<FJsonValue>>& OutMissing, FString& OutError)
 {
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
-	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
-	}
+	const TArray<TSharedPtr<FJsonValue>>* AssetsJson = nullptr;
+	const bool bHasAssets = Params->TryGetArrayField(TEXT("assets"), AssetsJson);
 
-	FString RowName;
-	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	// Actors are picked by names or a filter; with only 'assets' given no actors are wanted
+	bool bWantsActors = !bHasAssets || Params->HasField(TEXT("names"));
+	if (!bWantsActors)
 	{
-		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+		FEpicUnrealMCPActorFilter Probe;
+		if (!Probe.Compile(Params, OutError))
+		{
+			return false;
+		}
+		bWantsActors = !Probe.IsEmpty();
 	}
 
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
+	if (bWantsActors)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
-	}
+		TArray<AActor*> Actors;
+		if (!CollectActorsByQuery(Params, Actors, OutMissing, OutError))
+		{
+			return false;
+		}
 
-	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-	if (!RowStruct)
-	{
-		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+		// With 'component' or 'component_class' the targets are those components of each actor instead
+		FString ComponentName;
+		FString ComponentClassName;
+		Params->TryGetStringField(TEXT("component"), ComponentName);
+		Params->TryGetStringField(TEXT("component_class"), ComponentClassName);
+
+		UClass* ComponentClass = nullptr;
+		if (!ComponentClassName.IsEmpty())
+		{
+			ComponentClass = ResolveComponentClass(ComponentClassName, OutError);
+			if (!ComponentClass)
+			{
+				return false;
+			}
+		}
+
+		OutTargets.Reserve(Actors.Num());
+		for (AActor* Actor : Actors)
+		{
+			if (!ComponentName.IsEmpty())
+			{
+				UActorComponent* Component = ComponentIndex->Find(Actor, ComponentName);
+				if (!Component || (ComponentClass && !Component->IsA(ComponentClass)))
+				{
+					OutMissing.Add(MakeShared<FJsonValueString>(Actor->GetName() + TEXT(".") + ComponentName));
+					continue;
+				}
+
+				FEpicUnrealMCPPropertyTarget& Target = OutTargets.AddDefaulted_GetRef();
+				Target.Name = Actor->GetName() + TEXT(".") + ComponentName;
+				Target.Object = Component;
+			}
+			else if (ComponentClass)
+			{
+				for (const FEpicUnrealMCPComponentEntry& Entry : ComponentIndex->GetComponents(Actor))
+				{
+					UActorComponent* Component = Entry.Component.Get();
+					if (Component && Component->IsA(ComponentClass))
+					{
+						FEpicUnrealMCPPropertyTarget& Target = OutTargets.AddDefaulted_GetRef();
+						Target.Name = Actor->GetName() + TEXT(".") + Entry.Name.ToString();
+						Target.Object = Component;
+					}
+				}
+			}
+			else
+			{
+				FEpicUnrealMCPPropertyTarget& Target = OutTargets.AddDefaulted_GetRef();
+				Target.Name = Actor->GetName();
+				Target.Object = Actor;
+			}
+		}
 	}
 
-	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
-	if (!RowData)
+	if (bHasAssets)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
-	}
+		for (const TSharedPtr<FJsonValue>& PathValue : *AssetsJson)
+		{
+			const FString AssetPath = PathValue->AsString();
+			UObject* Asset = AssetCache->Load<UObject>(AssetPath);
 
-	TSharedPtr<FJsonObject> RowJson = RowStructToJson(const_cast<UScriptStruct*>(RowStruct), RowData);
+			// Blueprints are read and written through their class defaults, like the blueprint_default commands
+			if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				Asset = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+			}
 
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_name"), RowName);
-	Result->SetStringField(TEXT("row_struct"), RowStruct->GetName());
-	Result->SetObjectField(TEXT("row_data"), RowJson);
+			if (!Asset)
+			{
+				OutMissing.Add(MakeShared<FJsonValueString>(AssetPath));
+				continue;
+			}
 
-	return Result;
+			FEpicUnrealMCPPropertyTarget& Target = OutTargets.AddDefaulted_GetRef();
+			Target.Name = AssetPath;
+			Target.Object = Asset;
+		}
+	}
+	return true;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetDataTableRowField(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetProperties(const TSharedPtr<FJsonObject>& Params)
 {
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
-	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
-	}
+	const double StartTime = FPlatformTime::Seconds();
 
-	FString RowName;
-	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	const TArray<TSharedPtr<FJsonValue>>* PropertiesJson;
+	if (!Params->TryGetArrayField(TEXT("properties"), PropertiesJson) || PropertiesJson->Num() == 0)
 	{
-		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+		return CreateErrorResponse(TEXT("Missing 'properties' parameter (array of property paths)"));
 	}
 
-	FString FieldName;
-	if (!Params->TryGetStringField(TEXT("field_name"), FieldName))
+	TArray<FString> Paths;
+	Paths.Reserve(PropertiesJson->Num());
+	for (const TSharedPtr<FJsonValue>& PathValue : *PropertiesJson)
 	{
-		return CreateErrorResponse(TEXT("Missing 'field_name' parameter"));
+		Paths.Add(PathValue->AsString());
 	}
 
-	if (!Params->HasField(TEXT("value")))
-	{
-		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
-	}
+	// Containers and nesting are cut per cell; a cell's continuation token pages it through the single-value get commands
+	FEpicUnrealMCPConvertLimits Limits;
+	ReadConvertLimits(Params, Limits);
 
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
+	TArray<FEpicUnrealMCPPropertyTarget> Targets;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	FString QueryError;
+	if (!CollectPropertyTargets(Params, Targets, Missing, QueryError))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+		return CreateErrorResponse(QueryError);
 	}
 
-	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-	if (!RowStruct)
-	{
-		return CreateErrorResponse(TEXT("DataTable has no row struct"));
-	}
+	// One row per target, one column per path; cells that fail are null and listed in 'errors'
+	TArray<TSharedPtr<FJsonValue>> TargetsJson;
+	TArray<TSharedPtr<FJsonValue>> RowsJson;
+	TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+	// Property each cell resolved to, row-major; a column can resolve differently per target (mixed classes, component_class)
+	TArray<FProperty*> CellProperties;
+	CellProperties.SetNumZeroed(Targets.Num() * Paths.Num());
+	TargetsJson.Reserve(Targets.Num());
+	RowsJson.Reserve(Targets.Num());
 
-	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
-	if (!RowData)
+	for (int32 Row = 0; Row < Targets.Num(); ++Row)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
-	}
+		const FEpicUnrealMCPPropertyTarget& Target = Targets[Row];
+		TargetsJson.Add(MakeShared<FJsonValueString>(Target.Name));
 
-	// Find the property in the row struct
-	FProperty* Property = const_cast<UScriptStruct*>(RowStruct)->FindPropertyByName(FName(*FieldName));
-	if (!Property)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Field not found: %s"), *FieldName));
-	}
+		TArray<TSharedPtr<FJsonValue>> CellsJson;
+		CellsJson.Reserve(Paths.Num());
+		for (int32 Column = 0; Column < Paths.Num(); ++Column)
+		{
+			FEpicUnrealMCPResolvedProperty Resolved;
+			FString PathError;
+			if (!PropertyResolver->Resolve(Target.Object, Paths[Column], Resolved, PathError))
+			{
+				CellsJson.Add(MakeShared<FJsonValueNull>());
 
-	void* FieldPtr = Property->ContainerPtrToValuePtr<void>(RowData);
-	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+				TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+				ErrorJson->SetStringField(TEXT("target"), Target.Name);
+				ErrorJson->SetStringField(TEXT("property"), Paths[Column]);
+				ErrorJson->SetStringField(TEXT("error"), PathError);
+				ErrorsJson.Add(MakeShared<FJsonValueObject>(ErrorJson));
+				continue;
+			}
 
-	if (!JsonValueToProperty(JsonValue, Property, FieldPtr))
-	{
-		return CreateErrorResponse(FString::Printf(
-			TEXT("Failed to set field value. Field type: %s"),
-			*GetPropertyTypeName(Property)
-		));
+			CellProperties[Row * Paths.Num() + Column] = Resolved.Property;
+			CellsJson.Add(PropertyToJsonValue(Resolved.Property, Resolved.ValuePtr, Limits, Paths[Column]));
+		}
+		RowsJson.Add(MakeShared<FJsonValueArray>(CellsJson));
 	}
 
-	// Mark dirty and notify
-	DataTable->Modify();
-	DataTable->MarkPackageDirty();
-	DataTable->HandleDataTableChanged(FName(*RowName));
+	// One type name per column; a column whose type differs between targets lists one per row instead
+	TArray<TSharedPtr<FJsonValue>> TypesJson;
+	TypesJson.Reserve(Paths.Num());
+	for (int32 Column = 0; Column < Paths.Num(); ++Column)
+	{
+		TMap<FProperty*, FString> TypeNames;
+		FString ColumnType;
+		bool bMixed = false;
+		for (int32 Row = 0; Row < Targets.Num(); ++Row)
+		{
+			FProperty* Property = CellProperties[Row * Paths.Num() + Column];
+			if (!Property || TypeNames.Contains(Property))
+			{
+				continue;
+			}
+			const FString& TypeName = TypeNames.Add(Property, GetPropertyTypeName(Property));
+			if (ColumnType.IsEmpty())
+			{
+				ColumnType = TypeName;
+			}
+			bMixed |= TypeName != ColumnType;
+		}
+
+		if (bMixed)
+		{
+			TArray<TSharedPtr<FJsonValue>> RowTypesJson;
+			RowTypesJson.Reserve(Targets.Num());
+			for (int32 Row = 0; Row < Targets.Num(); ++Row)
+			{
+				FProperty* Property = CellProperties[Row * Paths.Num() + Column];
+				if (Property)
+				{
+					RowTypesJson.Add(MakeShared<FJsonValueString>(TypeNames.FindChecked(Property)));
+				}
+				else
+				{
+					RowTypesJson.Add(MakeShared<FJsonValueNull>());
+				}
+			}
+			TypesJson.Add(MakeShared<FJsonValueArray>(RowTypesJson));
+		}
+		else if (ColumnType.IsEmpty())
+		{
+			// Columns that failed on every target have no type
+			TypesJson.Add(MakeShared<FJsonValueNull>());
+		}
+		else
+		{
+			TypesJson.Add(MakeShared<FJsonValueString>(ColumnType));
+		}
+	}
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_name"), RowName);
-	Result->SetStringField(TEXT("field_name"), FieldName);
-	Result->SetStringField(TEXT("field_type"), GetPropertyTypeName(Property));
-	Result->SetField(TEXT("new_value"), PropertyToJsonValue(Property, FieldPtr));
-
+	Result->SetArrayField(TEXT("properties"), *PropertiesJson);
+	Result->SetArrayField(TEXT("types"), TypesJson);
+	Result->SetArrayField(TEXT("targets"), TargetsJson);
+	Result->SetArrayField(TEXT("values"), RowsJson);
+	Result->SetArrayField(TEXT("errors"), ErrorsJson);
+	Result->SetArrayField(TEXT("missing"), Missing);
+	Result->SetNumberField(TEXT("count"), Targets.Num());
+	Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleAddDataTableRow(const TSharedPtr<FJsonObject>& Params)
+/**
+ * Whether converting JsonValue overwrites every part of a Property value.
+ * Struct objects only write the fields they name and arrays keep the elements
+ * they are resized over, so a partial value has to be merged into each target
+ * rather than copied from a default-initialized buffer.
+ */
+static bool IsCompleteJsonValue(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property)
 {
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
 	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!JsonValue->TryGetArray(JsonArray))
+		{
+			// Packed blocks replace the whole array
+			return true;
+		}
+		for (const TSharedPtr<FJsonValue>& Element : *JsonArray)
+		{
+			if (!IsCompleteJsonValue(Element, ArrayProp->Inner))
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 
-	FString RowName;
-	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	const TSharedPtr<FJsonObject>* JsonObj;
+	if (!JsonValue->TryGetObject(JsonObj))
 	{
-		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+		return true;
 	}
 
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
+	FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	if (!StructProp)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+		// Maps and sets: leave merging to the converter
+		return false;
 	}
 
-	const UScriptStruct* RowStructConst = DataTable->GetRowStruct();
-	if (!RowStructConst)
+	if (StructProp->Struct == TBaseStructure<FTransform>::Get())
 	{
-		return CreateErrorResponse(TEXT("DataTable has no row struct"));
+		return (*JsonObj)->HasField(TEXT("location")) && (*JsonObj)->HasField(TEXT("rotation")) && (*JsonObj)->HasField(TEXT("scale"));
 	}
-	UScriptStruct* RowStruct = const_cast<UScriptStruct*>(RowStructConst);
 
-	// Check if row already exists
-	if (DataTable->FindRowUnchecked(FName(*RowName)))
+	for (TFieldIterator<FProperty> PropIt(StructProp->Struct); PropIt; ++PropIt)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Row already exists: %s"), *RowName));
+		TSharedPtr<FJsonValue> FieldJson = (*JsonObj)->TryGetField(PropIt->GetName());
+		if (!FieldJson.IsValid() || !IsCompleteJsonValue(FieldJson, *PropIt))
+		{
+			return false;
+		}
 	}
+	return true;
+}
 
-	// Allocate and initialize new row data
-	void* NewRowData = FMemory::Malloc(RowStruct->GetStructureSize());
-	RowStruct->InitializeStruct(NewRowData);
+// A JSON value converted once into the native form of one leaf property.
+// Partial values are not converted up front (bMerge) but merged into each target.
+struct FEpicUnrealMCPParsedValue
+{
+	FProperty* Property = nullptr;
+	void* Buffer = nullptr;
+	bool bMerge = false;
+	FString Error;
 
-	// If row_data provided, populate the fields
-	const TSharedPtr<FJsonObject>* RowDataJson;
-	if (Params->TryGetObjectField(TEXT("row_data"), RowDataJson))
+	~FEpicUnrealMCPParsedValue()
 	{
-		if (!JsonToRowStruct(*RowDataJson, RowStruct, NewRowData))
+		if (Buffer)
 		{
-			RowStruct->DestroyStruct(NewRowData);
-			FMemory::Free(NewRowData);
-			return CreateErrorResponse(TEXT("Failed to parse row_data"));
+			Property->DestroyValue(Buffer);
+			FMemory::Free(Buffer);
 		}
 	}
+};
 
-	// Add the row to the DataTable
-	DataTable->AddRow(FName(*RowName), *(FTableRowBase*)NewRowData);
-
-	// Clean up our temporary allocation (AddRow copies the data)
-	RowStruct->DestroyStruct(NewRowData);
-	FMemory::Free(NewRowData);
-
-	DataTable->Modify();
-	DataTable->MarkPackageDirty();
-
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_name"), RowName);
-	Result->SetStringField(TEXT("message"), TEXT("Row added successfully"));
-
-	return Result;
-}
-
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteDataTableRow(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetProperties(const TSharedPtr<FJsonObject>& Params)
 {
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	const double StartTime = FPlatformTime::Seconds();
+
+	const TSharedPtr<FJsonObject>* ValuesJson;
+	if (!Params->TryGetObjectField(TEXT("values"), ValuesJson) || (*ValuesJson)->Values.Num() == 0)
 	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+		return CreateErrorResponse(TEXT("Missing 'values' parameter (object of property path to value)"));
 	}
 
-	FString RowName;
-	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	TArray<FString> Paths;
+	TArray<TSharedPtr<FJsonValue>> Values;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*ValuesJson)->Values)
 	{
-		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+		Paths.Add(Entry.Key);
+		Values.Add(Entry.Value);
 	}
 
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
+	TArray<FEpicUnrealMCPPropertyTarget> Targets;
+	TArray<TSharedPtr<FJsonValue>> Missing;
+	FString QueryError;
+	if (!CollectPropertyTargets(Params, Targets, Missing, QueryError))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
+		return CreateErrorResponse(QueryError);
 	}
 
-	// Check if row exists
-	if (!DataTable->FindRowUnchecked(FName(*RowName)))
+	// Complete values are parsed once per (path, leaf property) and copied into every target.
+	// Targets of different classes can resolve one path to different properties, hence the property in the key.
+	TMap<TPair<int32, FProperty*>, TUniquePtr<FEpicUnrealMCPParsedValue>> ParsedValues;
+	auto FindOrParse = [this, &ParsedValues, &Values](int32 Column, FProperty* Property) -> const FEpicUnrealMCPParsedValue&
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
-	}
+		TUniquePtr<FEpicUnrealMCPParsedValue>& Parsed = ParsedValues.FindOrAdd(TPair<int32, FProperty*>(Column, Property));
+		if (!Parsed.IsValid())
+		{
+			Parsed = MakeUnique<FEpicUnrealMCPParsedValue>();
+			Parsed->Property = Property;
+			Parsed->bMerge = !IsCompleteJsonValue(Values[Column], Property);
+			if (Parsed->bMerge)
+			{
+				return *Parsed;
+			}
+			Parsed->Buffer = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+			Property->InitializeValue(Parsed->Buffer);
+			if (!JsonValueToProperty(Values[Column], Property, Parsed->Buffer))
+			{
+				Parsed->Error = FString::Printf(TEXT("Failed to convert value. Property type: %s"), *GetPropertyTypeName(Property));
+			}
+		}
+		return *Parsed;
+	};
 
-	// Remove the row
-	DataTable->RemoveRow(FName(*RowName));
+	TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+	auto AddError = [&ErrorsJson](const FString& TargetName, const FString& Path, const FString& Error)
+	{
+		TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+		ErrorJson->SetStringField(TEXT("target"), TargetName);
+		ErrorJson->SetStringField(TEXT("property"), Path);
+		ErrorJson->SetStringField(TEXT("error"), Error);
+		ErrorsJson.Add(MakeShared<FJsonValueObject>(ErrorJson));
+	};
 
-	DataTable->Modify();
-	DataTable->MarkPackageDirty();
+	int32 NumWritten = 0;
+	TSet<UObject*> ModifiedObjects;
+	{
+		// Change events and package dirtying are deduplicated and flushed once when the scope ends
+		FEpicUnrealMCPBulkEdit::FScope BulkScope(*BulkEdit);
+
+		for (const FEpicUnrealMCPPropertyTarget& Target : Targets)
+		{
+			for (int32 Column = 0; Column < Paths.Num(); ++Column)
+			{
+				AActor* Actor = Cast<AActor>(Target.Object);
+
+				// Same special case as set_actor_property: the outliner has to learn about folder changes
+				if (Actor && Paths[Column] == TEXT("FolderPath"))
+				{
+					FString FolderPath;
+					if (!Values[Column]->TryGetString(FolderPath))
+					{
+						AddError(Target.Name, Paths[Column], TEXT("FolderPath expects a string"));
+						continue;
+					}
+					if (!ModifiedObjects.Contains(Actor))
+					{
+						Actor->Modify(false);
+						ModifiedObjects.Add(Actor);
+					}
+					Actor->SetFolderPath(*FolderPath);
+					BulkEdit->NotifyPackageDirty(Actor);
+					++NumWritten;
+					continue;
+				}
+
+				FEpicUnrealMCPResolvedProperty Resolved;
+				FString PathError;
+				if (!PropertyResolver->Resolve(Target.Object, Paths[Column], Resolved, PathError, true))
+				{
+					AddError(Target.Name, Paths[Column], PathError);
+					continue;
+				}
+
+				if (Resolved.Property->HasAnyPropertyFlags(CPF_EditConst) || Resolved.MemberProperty->HasAnyPropertyFlags(CPF_EditConst))
+				{
+					AddError(Target.Name, Paths[Column], TEXT("Property is read-only"));
+					continue;
+				}
+
+				const FEpicUnrealMCPParsedValue& Parsed = FindOrParse(Column, Resolved.Property);
+				if (!Parsed.Error.IsEmpty())
+				{
+					AddError(Target.Name, Paths[Column], Parsed.Error);
+					continue;
+				}
+
+				// Record the old state for undo before the first write to each object
+				if (!ModifiedObjects.Contains(Resolved.Object))
+				{
+					Resolved.Object->Modify(false);
+					ModifiedObjects.Add(Resolved.Object);
+				}
+
+				// Paths resolve to a single element, also inside fixed-size arrays
+				if (!Parsed.bMerge)
+				{
+					Resolved.Property->CopySingleValue(Resolved.ValuePtr, Parsed.Buffer);
+				}
+				else if (!JsonValueToProperty(Values[Column], Resolved.Property, Resolved.ValuePtr))
+				{
+					AddError(Target.Name, Paths[Column], FString::Printf(TEXT("Failed to convert value. Property type: %s"),
+						*GetPropertyTypeName(Resolved.Property)));
+					continue;
+				}
+				++NumWritten;
+
+				NotifyPolicy->NotifyWrite(*BulkEdit, Resolved.Object, Resolved.MemberProperty, Resolved.Property);
+				BulkEdit->NotifyPackageDirty(Resolved.Object);
+			}
+		}
+	}
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_name"), RowName);
-	Result->SetStringField(TEXT("message"), TEXT("Row deleted successfully"));
-
+	Result->SetNumberField(TEXT("count"), Targets.Num());
+	Result->SetNumberField(TEXT("written"), NumWritten);
+	Result->SetNumberField(TEXT("objects"), ModifiedObjects.Num());
+	Result->SetArrayField(TEXT("errors"), ErrorsJson);
+	Result->SetArrayField(TEXT("missing"), Missing);
+	Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 	return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetDataTableArrayElement(const TSharedPtr<FJsonObject>& Params)
+// Recursion limit for nested structs in dump_overrides
+static const int32 MaxOverrideDepth = 8;
+
+// Pointers to an object's own subobjects (components and other instanced objects) never compare equal
+// to the archetype's; their contents are compared separately, so such pairs count as identical here
+static bool IsOwnSubobjectPair(FProperty* Property, const void* Value, const void* DefaultValue, UObject* Owner, UObject* Archetype)
 {
-	// Get required parameters
-	FString DataTablePath;
-	if (!Params->TryGetStringField(TEXT("data_table_path"), DataTablePath))
+	FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Property);
+	if (!ObjProp || !Owner)
 	{
-		return CreateErrorResponse(TEXT("Missing 'data_table_path' parameter"));
+		return false;
 	}
 
-	FString RowName;
-	if (!Params->TryGetStringField(TEXT("row_name"), RowName))
+	UObject* Object = ObjProp->GetObjectPropertyValue(Value);
+	if (!Object || !Object->IsIn(Owner))
 	{
-		return CreateErrorResponse(TEXT("Missing 'row_name' parameter"));
+		return false;
 	}
 
-	FString ArrayFieldName;
-	if (!Params->TryGetStringField(TEXT("array_field"), ArrayFieldName))
-	{
-		return CreateErrorResponse(TEXT("Missing 'array_field' parameter"));
-	}
+	UObject* DefaultObject = ObjProp->GetObjectPropertyValue(DefaultValue);
+	return !DefaultObject || (DefaultObject->IsIn(Archetype) && DefaultObject->GetFName() == Object->GetFName());
+}
 
-	int32 ElementIndex = -1;
-	if (!Params->TryGetNumberField(TEXT("element_index"), ElementIndex))
-	{
-		return CreateErrorResponse(TEXT("Missing 'element_index' parameter"));
-	}
+int32 FEpicUnrealMCPEditorCommands::DiffStructAgainstDefaults(UStruct* Struct, const void* Data, const void* DefaultData, UObject* Owner, UObject* Archetype,
+	bool bRecursive, int32 Depth, FJsonObject& OutJson)
+{
+	UClass* ArchetypeClass = Struct->IsA<UClass>() && Archetype ? Archetype->GetClass() : nullptr;
 
-	FString ElementFieldName;
-	if (!Params->TryGetStringField(TEXT("element_field"), ElementFieldName))
+	int32 NumOverrides = 0;
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
 	{
-		return CreateErrorResponse(TEXT("Missing 'element_field' parameter"));
-	}
+		FProperty* Property = *PropIt;
+		if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated))
+		{
+			continue;
+		}
 
-	if (!Params->HasField(TEXT("value")))
-	{
-		return CreateErrorResponse(TEXT("Missing 'value' parameter"));
-	}
+		// On objects only editable properties count as customizations, and only those the archetype has too;
+		// variables a Blueprint adds have no parent value to differ from
+		if (ArchetypeClass && (!Property->HasAnyPropertyFlags(CPF_Edit) || !ArchetypeClass->IsChildOf(Property->GetOwnerClass())))
+		{
+			continue;
+		}
 
-	// Load the DataTable
-	UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
-	if (!DataTable)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to load DataTable: %s"), *DataTablePath));
-	}
+		for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+		{
+			const void* Value = Property->ContainerPtrToValuePtr<void>(Data, Index);
+			const void* DefaultValue = Property->ContainerPtrToValuePtr<void>(DefaultData, Index);
+			if (Property->Identical(Value, DefaultValue, PPF_None) || IsOwnSubobjectPair(Property, Value, DefaultValue, Owner, Archetype))
+			{
+				continue;
+			}
 
-	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-	if (!RowStruct)
-	{
-		return CreateErrorResponse(TEXT("DataTable has no row struct"));
-	}
+			const FString Key = Property->ArrayDim > 1
+				? FString::Printf(TEXT("%s[%d]"), *Property->GetName(), Index)
+				: Property->GetName();
 
-	void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
-	if (!RowData)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Row not found: %s"), *RowName));
-	}
+			// Nested structs report only their differing fields; compact ones (vectors, colors, ...) stay whole
+			FStructProperty* StructProp = CastField<FStructProperty>(Property);
+			if (bRecursive && StructProp && Depth < MaxOverrideDepth && !FEpicUnrealMCPPropertyConverter::HasCompactForm(StructProp->Struct))
+			{
+				TSharedPtr<FJsonObject> NestedJson = MakeShared<FJsonObject>();
+				const int32 NumNested = DiffStructAgainstDefaults(StructProp->Struct, Value, DefaultValue, Owner, Archetype, bRecursive, Depth + 1, *NestedJson);
+				if (NumNested > 0)
+				{
+					OutJson.SetObjectField(Key, NestedJson);
+					NumOverrides += NumNested;
+				}
+				continue;
+			}
 
-	// Find the array property
-	FProperty* ArrayProperty = const_cast<UScriptStruct*>(RowStruct)->FindPropertyByName(FName(*ArrayFieldName));
-	if (!ArrayProperty)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Array field not found: %s"), *ArrayFieldName));
+			OutJson.SetField(Key, PropertyToJsonValue(Property, Value));
+			++NumOverrides;
+		}
 	}
+	return NumOverrides;
+}
 
-	FArrayProperty* ArrayProp = CastField<FArrayProperty>(ArrayProperty);
-	if (!ArrayProp)
+int32 FEpicUnrealMCPEditorCommands::DiffObjectAgainstArchetype(UObject* Object, UObject* Archetype, bool bRecursive, FJsonObject& OutJson)
+{
+	if (!Object || !Archetype)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Field '%s' is not an array"), *ArrayFieldName));
+		return 0;
 	}
+	return DiffStructAgainstDefaults(Object->GetClass(), Object, Archetype, Object, Archetype, bRecursive, 0, OutJson);
+}
 
-	void* ArrayPtr = ArrayProperty->ContainerPtrToValuePtr<void>(RowData);
-	FScriptArrayHelper ArrayHelper(ArrayProp, ArrayPtr);
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDumpOverrides(const TSharedPtr<FJsonObject>& Params)
+{
+	bool bRecursive = true;
+	Params->TryGetBoolField(TEXT("recursive"), bRecursive);
 
-	// Validate index
-	if (ElementIndex < 0 || ElementIndex >= ArrayHelper.Num())
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Element index %d out of range (array has %d elements)"), ElementIndex, ArrayHelper.Num()));
-	}
+	bool bIncludeComponents = true;
+	Params->TryGetBoolField(TEXT("include_components"), bIncludeComponents);
 
-	// Get element pointer
-	void* ElementPtr = ArrayHelper.GetRawPtr(ElementIndex);
+	UObject* Object = nullptr;
+	UObject* Archetype = nullptr;
+	AActor* Actor = nullptr;
+	UBlueprint* Blueprint = nullptr;
 
-	// Check if inner property is a struct
-	FStructProperty* StructProp = CastField<FStructProperty>(ArrayProp->Inner);
-	if (!StructProp)
+	FString ActorName;
+	FString BlueprintPath;
+	FString AssetPath;
+	if (Params->TryGetStringField(TEXT("name"), ActorName))
 	{
-		return CreateErrorResponse(TEXT("Array inner type is not a struct"));
+		Actor = ActorIndex->FindByName(ActorName);
+		if (!Actor)
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+		}
+		Object = Actor;
+		Archetype = Actor->GetArchetype();
 	}
+	else if (Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+	{
+		Blueprint = AssetCache->Load<UBlueprint>(BlueprintPath);
+		if (!Blueprint)
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Failed to load Blueprint: %s"), *BlueprintPath));
+		}
+		if (!Blueprint->GeneratedClass || !Blueprint->GeneratedClass->GetSuperClass())
+		{
+			return CreateErrorResponse(TEXT("Blueprint has no GeneratedClass - needs compilation"));
+		}
 
-	UScriptStruct* ElementStruct = StructProp->Struct;
+		// A Blueprint's customizations are its class defaults compared with its parent's
+		Object = Blueprint->GeneratedClass->GetDefaultObject();
+		Archetype = Blueprint->GeneratedClass->GetSuperClass()->GetDefaultObject();
+	}
+	else if (Params->TryGetStringField(TEXT("asset_path"), AssetPath))
+	{
+		Object = AssetCache->Load<UObject>(AssetPath);
+		if (!Object)
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath));
+		}
+		Archetype = Object->GetArchetype();
+	}
+	else
+	{
+		return CreateErrorResponse(TEXT("Provide 'name' (actor), 'blueprint_path' or 'asset_path'"));
+	}
 
-	// Find the field within the struct element
-	FProperty* FieldProperty = ElementStruct->FindPropertyByName(FName(*ElementFieldName));
-	if (!FieldProperty)
+	if (!Archetype)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Field '%s' not found in struct"), *ElementFieldName));
+		return CreateErrorResponse(FString::Printf(TEXT("%s has no archetype to compare with"), *Object->GetName()));
 	}
 
-	void* FieldPtr = FieldProperty->ContainerPtrToValuePtr<void>(ElementPtr);
-	TSharedPtr<FJsonValue> JsonValue = Params->TryGetField(TEXT("value"));
+	TSharedPtr<FJsonObject> OverridesJson = MakeShared<FJsonObject>();
+	int32 NumOverrides = DiffObjectAgainstArchetype(Object, Archetype, bRecursive, *OverridesJson);
 
-	if (!JsonValueToProperty(JsonValue, FieldProperty, FieldPtr))
+	// Components are compared with their own archetypes: the class default subobject, the
+	// Blueprint component template, or the component class defaults for instance components
+	TSharedPtr<FJsonObject> ComponentsJson = MakeShared<FJsonObject>();
+	if (bIncludeComponents && Actor)
 	{
-		return CreateErrorResponse(FString::Printf(
-			TEXT("Failed to set field value. Field type: %s"),
-			*GetPropertyTypeName(FieldProperty)
-		));
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		for (UActorComponent* Component : Components)
+		{
+			TSharedPtr<FJsonObject> ComponentJson = MakeShared<FJsonObject>();
+			const int32 NumComponent = DiffObjectAgainstArchetype(Component, Component->GetArchetype(), bRecursive, *ComponentJson);
+			if (NumComponent > 0)
+			{
+				ComponentsJson->SetObjectField(Component->GetName(), ComponentJson);
+				NumOverrides += NumComponent;
+			}
+		}
 	}
+	else if (bIncludeComponents && Blueprint && Blueprint->SimpleConstructionScript)
+	{
+		for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+		{
+			UActorComponent* Template = Node ? Node->ComponentTemplate : nullptr;
+			if (!Template)
+			{
+				continue;
+			}
 
-	// Mark dirty and notify
-	DataTable->Modify();
-	DataTable->MarkPackageDirty();
-	DataTable->HandleDataTableChanged(FName(*RowName));
+			TSharedPtr<FJsonObject> ComponentJson = MakeShared<FJsonObject>();
+			const int32 NumComponent = DiffObjectAgainstArchetype(Template, Template->GetArchetype(), bRecursive, *ComponentJson);
+			if (NumComponent > 0)
+			{
+				ComponentsJson->SetObjectField(Node->GetVariableName().ToString(), ComponentJson);
+				NumOverrides += NumComponent;
+			}
+		}
+	}
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetBoolField(TEXT("success"), true);
-	Result->SetStringField(TEXT("data_table_path"), DataTablePath);
-	Result->SetStringField(TEXT("row_name"), RowName);
-	Result->SetStringField(TEXT("array_field"), ArrayFieldName);
-	Result->SetNumberField(TEXT("element_index"), ElementIndex);
-	Result->SetStringField(TEXT("element_field"), ElementFieldName);
-	Result->SetStringField(TEXT("field_type"), GetPropertyTypeName(FieldProperty));
-	Result->SetField(TEXT("new_value"), PropertyToJsonValue(FieldProperty, FieldPtr));
-
+	Result->SetStringField(TEXT("object"), Object->GetPathName());
+	Result->SetStringField(TEXT("archetype"), Archetype->GetPathName());
+	Result->SetObjectField(TEXT("overrides"), OverridesJson);
+	if (bIncludeComponents && (Actor || Blueprint))
+	{
+		Result->SetObjectField(TEXT("components"), ComponentsJson);
+	}
+	Result->SetNumberField(TEXT("count"), NumOverrides);
 	return Result;
 }
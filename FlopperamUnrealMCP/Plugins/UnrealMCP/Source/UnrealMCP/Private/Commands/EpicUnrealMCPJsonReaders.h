@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Field readers shared by the request parsers that take vectors, rotators
+ * and counts as plain JSON numbers and arrays.
+ */
+namespace EpicUnrealMCPJsonReaders
+{
+	/** [X, Y] or [X, Y, Z]; a missing Z keeps Default.Z */
+	inline FVector ReadVector(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, const FVector& Default)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
+		if (Json->TryGetArrayField(FieldName, ArrayValue) && ArrayValue->Num() >= 2)
+		{
+			return FVector(
+				(*ArrayValue)[0]->AsNumber(),
+				(*ArrayValue)[1]->AsNumber(),
+				ArrayValue->Num() >= 3 ? (*ArrayValue)[2]->AsNumber() : Default.Z);
+		}
+		return Default;
+	}
+
+	/** Strict [X, Y, Z]; returns false and leaves OutVector alone otherwise */
+	inline bool TryReadVector(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, FVector& OutVector)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
+		if (Json->TryGetArrayField(FieldName, ArrayValue) && ArrayValue->Num() >= 3)
+		{
+			OutVector.X = (*ArrayValue)[0]->AsNumber();
+			OutVector.Y = (*ArrayValue)[1]->AsNumber();
+			OutVector.Z = (*ArrayValue)[2]->AsNumber();
+			return true;
+		}
+		return false;
+	}
+
+	/** [Pitch, Yaw, Roll] in degrees */
+	inline FRotator ReadRotator(const TSharedPtr<FJsonObject>& Json, const FString& FieldName)
+	{
+		const FVector PitchYawRoll = ReadVector(Json, FieldName, FVector::ZeroVector);
+		return FRotator(PitchYawRoll.X, PitchYawRoll.Y, PitchYawRoll.Z);
+	}
+
+	inline double ReadNumber(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, double Default)
+	{
+		double Value = Default;
+		Json->TryGetNumberField(FieldName, Value);
+		return Value;
+	}
+
+	/** Clamped just past Limit so oversized counts fail the caller's limit check instead of allocating */
+	inline int32 ClampCount(double Value, int32 Limit)
+	{
+		return FMath::RoundToInt(FMath::Clamp(Value, 0.0, double(Limit) + 1.0));
+	}
+}
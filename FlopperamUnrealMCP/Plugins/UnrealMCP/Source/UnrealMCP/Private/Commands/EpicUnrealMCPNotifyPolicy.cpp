@@ -0,0 +1,184 @@
+#include "Commands/EpicUnrealMCPNotifyPolicy.h"
+#include "Commands/EpicUnrealMCPBulkEdit.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+
+static const TCHAR* NotifyPolicySection = TEXT("UnrealMCP.NotifyPolicy");
+
+FEpicUnrealMCPNotifyPolicy::FEpicUnrealMCPNotifyPolicy(FEpicUnrealMCPCacheInvalidation& InInvalidation)
+	: bRulesLoaded(false)
+	, Invalidation(InInvalidation)
+	, SubPropertyEvents(0)
+{
+	InvalidationHandle = Invalidation.Register(FSimpleDelegate::CreateRaw(this, &FEpicUnrealMCPNotifyPolicy::Reset));
+}
+
+FEpicUnrealMCPNotifyPolicy::~FEpicUnrealMCPNotifyPolicy()
+{
+	Invalidation.Unregister(InvalidationHandle);
+}
+
+void FEpicUnrealMCPNotifyPolicy::Reset()
+{
+	if (Resolved.Num() > 0)
+	{
+		++Stats.Invalidations;
+	}
+	Resolved.Reset();
+}
+
+void FEpicUnrealMCPNotifyPolicy::LoadRules()
+{
+	TArray<FString> Lines;
+	if (GConfig)
+	{
+		GConfig->GetArray(NotifyPolicySection, TEXT("SubPropertyRule"), Lines, GEditorIni);
+	}
+	ParseRules(Lines);
+}
+
+int32 FEpicUnrealMCPNotifyPolicy::Reload()
+{
+	// GConfig keeps the files it read at startup, so build the Editor hierarchy afresh from disk
+	FConfigFile EditorConfig;
+	FConfigCacheIni::LoadExternalIniFile(EditorConfig, TEXT("Editor"), *FPaths::EngineConfigDir(), *FPaths::ProjectConfigDir(), true);
+
+	TArray<FString> Lines;
+	if (const FConfigSection* Section = EditorConfig.Find(NotifyPolicySection))
+	{
+		TArray<FConfigValue> Values;
+		Section->MultiFind(TEXT("SubPropertyRule"), Values, true);
+		for (const FConfigValue& Value : Values)
+		{
+			Lines.Add(Value.GetValue());
+		}
+	}
+
+	ParseRules(Lines);
+	Reset();
+	return Rules.Num();
+}
+
+void FEpicUnrealMCPNotifyPolicy::ParseRules(const TArray<FString>& Lines)
+{
+	Rules.Reset();
+	bRulesLoaded = true;
+
+	for (const FString& Line : Lines)
+	{
+		FString ClassName;
+		FString StructName;
+		FString PropertyList;
+		FParse::Value(*Line, TEXT("Class="), ClassName);
+		FParse::Value(*Line, TEXT("Struct="), StructName);
+		if (!FParse::Value(*Line, TEXT("Properties="), PropertyList, false))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Ignoring notify rule without Properties: %s"), *Line);
+			continue;
+		}
+
+		FRule& Rule = Rules.AddDefaulted_GetRef();
+		Rule.ClassName = ClassName.IsEmpty() ? NAME_None : FName(*ClassName);
+		Rule.StructName = StructName.IsEmpty() ? NAME_None : FName(*StructName);
+
+		TArray<FString> PropertyNames;
+		PropertyList.ParseIntoArray(PropertyNames, TEXT(","), true);
+		for (const FString& PropertyName : PropertyNames)
+		{
+			Rule.Properties.AddUnique(FName(*PropertyName.TrimStartAndEnd()));
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UnrealMCP: Loaded %d notify rules"), Rules.Num());
+}
+
+bool FEpicUnrealMCPNotifyPolicy::IsClassOrBaseNamed(const UClass* Class, FName ClassName)
+{
+	for (; Class; Class = Class->GetSuperClass())
+	{
+		if (Class->GetFName() == ClassName)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const FEpicUnrealMCPNotifyPolicy::FResolvedEntry& FEpicUnrealMCPNotifyPolicy::FindOrResolve(UClass* Class, UScriptStruct* Struct)
+{
+	FResolvedEntry& Entry = Resolved.FindOrAdd(TPair<const UClass*, const UScriptStruct*>(Class, Struct));
+
+	// A stale class or struct means it was destroyed and another one now lives at the same address
+	if (Entry.Class.IsValid() && Entry.Struct.IsValid())
+	{
+		++Stats.Hits;
+		return Entry;
+	}
+
+	++Stats.Misses;
+	Invalidation.BindDelegates();
+
+	Entry = FResolvedEntry();
+	Entry.Class = Class;
+	Entry.Struct = Struct;
+	for (const FRule& Rule : Rules)
+	{
+		if ((!Rule.StructName.IsNone() && Struct->GetFName() != Rule.StructName)
+			|| (!Rule.ClassName.IsNone() && !IsClassOrBaseNamed(Class, Rule.ClassName)))
+		{
+			continue;
+		}
+
+		for (const FName& PropertyName : Rule.Properties)
+		{
+			if (Struct->FindPropertyByName(PropertyName))
+			{
+				Entry.SubPropertyNames.AddUnique(PropertyName);
+			}
+		}
+	}
+	return Entry;
+}
+
+void FEpicUnrealMCPNotifyPolicy::NotifyWrite(FEpicUnrealMCPBulkEdit& BulkEdit, UObject* Object, FProperty* MemberProperty, FProperty* Property)
+{
+	if (!Object || !MemberProperty)
+	{
+		return;
+	}
+
+	// Lets actors tell which property changed and update their editor visualization accordingly
+	BulkEdit.NotifyPropertyChanged(Object, MemberProperty);
+
+	if (!bRulesLoaded)
+	{
+		LoadRules();
+	}
+
+	// Sub-property events only apply when a whole struct was written
+	FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	if (Rules.Num() == 0 || !StructProp || !StructProp->Struct)
+	{
+		return;
+	}
+
+	for (const FName& SubPropertyName : FindOrResolve(Object->GetClass(), StructProp->Struct).SubPropertyNames)
+	{
+		// A field removed from the struct since the names were cached is skipped
+		if (FProperty* SubProperty = StructProp->Struct->FindPropertyByName(SubPropertyName))
+		{
+			BulkEdit.NotifyPropertyChanged(Object, SubProperty);
+			++SubPropertyEvents;
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPNotifyPolicy::GetStatsJson() const
+{
+	TSharedPtr<FJsonObject> Json = Stats.ToJson(Resolved.Num());
+	Json->SetNumberField(TEXT("rules"), Rules.Num());
+	Json->SetNumberField(TEXT("sub_property_events"), SubPropertyEvents);
+	return Json;
+}
@@ -0,0 +1,583 @@
+#include "Commands/EpicUnrealMCPPatternGenerator.h"
+#include "Commands/EpicUnrealMCPJsonReaders.h"
+
+using namespace EpicUnrealMCPJsonReaders;
+
+namespace
+{
+	// Curve samples per control point segment when turning "points" into a polyline
+	constexpr int32 SplineSubdivisions = 16;
+
+	// Edge length of the blocker hash cells; boxes covering more cells than the cap are tested against every point
+	constexpr float BlockerCellSize = 1000.0f;
+	constexpr int32 MaxCellsPerBlocker = 1024;
+
+	// Bridson's sampler tries this many candidates around an active sample before retiring it
+	constexpr int32 ScatterAttempts = 30;
+	constexpr int64 MaxScatterCells = 16 * 1024 * 1024;
+}
+
+// Out-of-line definition; the limit is bound by reference in FMath::Min
+constexpr int32 FEpicUnrealMCPPatternGenerator::MaxPoints;
+
+FEpicUnrealMCPPatternGenerator::FEpicUnrealMCPPatternGenerator()
+	: bPathClosed(false)
+	, NumCandidates(0)
+{
+}
+
+void FEpicUnrealMCPPatternGenerator::SetPath(TArray<FVector>&& Points, bool bClosed)
+{
+	Path = MoveTemp(Points);
+	bPathClosed = bClosed;
+}
+
+void FEpicUnrealMCPPatternGenerator::AddBlocker(const FBox& Box)
+{
+	if (Box.IsValid)
+	{
+		Blockers.Add(Box);
+	}
+}
+
+bool FEpicUnrealMCPPatternGenerator::Generate(const TSharedPtr<FJsonObject>& PatternJson, FString& OutError)
+{
+	Transforms.Reset();
+	NumCandidates = 0;
+
+	FString Pattern;
+	if (!PatternJson.IsValid() || !PatternJson->TryGetStringField(TEXT("pattern"), Pattern))
+	{
+		OutError = TEXT("Missing 'pattern' (grid, radial, spline or scatter)");
+		return false;
+	}
+
+	FRandomStream Random(int32(ReadNumber(PatternJson, TEXT("seed"), 0.0)));
+	const FTransform Root(ReadRotator(PatternJson, TEXT("rotation")), ReadVector(PatternJson, TEXT("location"), FVector::ZeroVector));
+
+	TArray<FTransform> Candidates;
+	bool bLocal = true;
+	if (Pattern == TEXT("grid"))
+	{
+		if (!GenerateGrid(PatternJson, Candidates, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Pattern == TEXT("radial"))
+	{
+		if (!GenerateRadial(PatternJson, Candidates, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Pattern == TEXT("spline"))
+	{
+		if (!GenerateSpline(PatternJson, Root, Candidates, OutError))
+		{
+			return false;
+		}
+		bLocal = false;
+	}
+	else if (Pattern == TEXT("scatter"))
+	{
+		if (!GenerateScatter(PatternJson, Random, Candidates, OutError))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		OutError = FString::Printf(TEXT("Unknown pattern: %s"), *Pattern);
+		return false;
+	}
+
+	NumCandidates = Candidates.Num();
+
+	const FVector Jitter = ReadVector(PatternJson, TEXT("jitter"), FVector::ZeroVector).GetAbs();
+	const FVector RotationRange = ReadVector(PatternJson, TEXT("random_rotation"), FVector::ZeroVector).GetAbs();
+	const FVector ScaleRange = ReadVector(PatternJson, TEXT("scale_range"), FVector::OneVector);
+	bool bRandomYaw = false;
+	PatternJson->TryGetBoolField(TEXT("random_yaw"), bRandomYaw);
+
+	const bool bHasJitter = !Jitter.IsNearlyZero();
+	const bool bHasRotation = bRandomYaw || !RotationRange.IsNearlyZero();
+	const bool bHasScale = !FMath::IsNearlyEqual(ScaleRange.X, 1.0f) || !FMath::IsNearlyEqual(ScaleRange.Y, 1.0f);
+
+	// Variation is drawn for every candidate before rejection so a seed gives the same piece the same look
+	for (FTransform& Candidate : Candidates)
+	{
+		if (bLocal)
+		{
+			Candidate = Candidate * Root;
+		}
+		if (bHasJitter)
+		{
+			Candidate.AddToTranslation(FVector(
+				Random.FRandRange(-Jitter.X, Jitter.X),
+				Random.FRandRange(-Jitter.Y, Jitter.Y),
+				Random.FRandRange(-Jitter.Z, Jitter.Z)));
+		}
+		if (bHasRotation)
+		{
+			const FRotator Variation(
+				Random.FRandRange(-RotationRange.X, RotationRange.X),
+				(bRandomYaw ? Random.FRandRange(0.0f, 360.0f) : 0.0f) + Random.FRandRange(-RotationRange.Y, RotationRange.Y),
+				Random.FRandRange(-RotationRange.Z, RotationRange.Z));
+			Candidate.SetRotation(Candidate.GetRotation() * Variation.Quaternion());
+		}
+		if (bHasScale)
+		{
+			Candidate.SetScale3D(Candidate.GetScale3D() * Random.FRandRange(ScaleRange.X, ScaleRange.Y));
+		}
+	}
+
+	RejectOverlaps(Candidates,
+		FMath::Max(0.0, ReadNumber(PatternJson, TEXT("min_distance"), 0.0)),
+		FMath::Max(0.0, ReadNumber(PatternJson, TEXT("clearance"), 0.0)));
+
+	Transforms = MoveTemp(Candidates);
+	return true;
+}
+
+bool FEpicUnrealMCPPatternGenerator::GenerateGrid(const TSharedPtr<FJsonObject>& PatternJson, TArray<FTransform>& OutLocal, FString& OutError)
+{
+	const FVector CountsVector = ReadVector(PatternJson, TEXT("counts"), FVector(1.0f, 1.0f, 1.0f));
+	const FIntVector Counts(ClampCount(CountsVector.X, MaxPoints), ClampCount(CountsVector.Y, MaxPoints), ClampCount(CountsVector.Z, MaxPoints));
+	const FVector Spacing = ReadVector(PatternJson, TEXT("spacing"), FVector(100.0f, 100.0f, 100.0f));
+
+	if (int64(Counts.X) * Counts.Y * Counts.Z > MaxPoints)
+	{
+		OutError = FString::Printf(TEXT("Grid exceeds %d points"), MaxPoints);
+		return false;
+	}
+
+	bool bCentered = false;
+	PatternJson->TryGetBoolField(TEXT("centered"), bCentered);
+	const FVector Origin = bCentered
+		? -0.5f * Spacing * FVector(FMath::Max(Counts.X - 1, 0), FMath::Max(Counts.Y - 1, 0), FMath::Max(Counts.Z - 1, 0))
+		: FVector::ZeroVector;
+
+	OutLocal.Reserve(Counts.X * Counts.Y * Counts.Z);
+	for (int32 Z = 0; Z < Counts.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Counts.Y; ++Y)
+		{
+			for (int32 X = 0; X < Counts.X; ++X)
+			{
+				OutLocal.Add(FTransform(Origin + Spacing * FVector(X, Y, Z)));
+			}
+		}
+	}
+	return true;
+}
+
+bool FEpicUnrealMCPPatternGenerator::GenerateRadial(const TSharedPtr<FJsonObject>& PatternJson, TArray<FTransform>& OutLocal, FString& OutError)
+{
+	const int32 Count = ClampCount(ReadNumber(PatternJson, TEXT("count"), 8.0), MaxPoints);
+	const int32 Rings = FMath::Max(1, ClampCount(ReadNumber(PatternJson, TEXT("rings"), 1.0), MaxPoints));
+	const float Radius = ReadNumber(PatternJson, TEXT("radius"), 1000.0);
+	const float RingSpacing = ReadNumber(PatternJson, TEXT("ring_spacing"), Radius);
+	const float StartAngle = ReadNumber(PatternJson, TEXT("start_angle"), 0.0);
+	const float Arc = ReadNumber(PatternJson, TEXT("arc"), 360.0);
+
+	bool bFaceOutward = true;
+	PatternJson->TryGetBoolField(TEXT("face_outward"), bFaceOutward);
+
+	// Proportional rings keep the arc spacing of the first ring, which fills a disc evenly
+	bool bProportional = false;
+	PatternJson->TryGetBoolField(TEXT("proportional"), bProportional);
+
+	TArray<int32> RingCounts;
+	int64 Total = 0;
+	for (int32 Ring = 0; Ring < Rings; ++Ring)
+	{
+		const float RingRadius = Radius + RingSpacing * Ring;
+		const int32 RingCount = bProportional && Radius > KINDA_SMALL_NUMBER
+			? ClampCount(Count * RingRadius / Radius, MaxPoints)
+			: Count;
+		RingCounts.Add(RingCount);
+		Total += RingCount;
+		if (Total > MaxPoints)
+		{
+			OutError = FString::Printf(TEXT("Radial pattern exceeds %d points"), MaxPoints);
+			return false;
+		}
+	}
+
+	// A full circle must not place the last copy on top of the first
+	const bool bFullCircle = FMath::IsNearlyEqual(FMath::Abs(Arc), 360.0f);
+
+	OutLocal.Reserve(Total);
+	for (int32 Ring = 0; Ring < Rings; ++Ring)
+	{
+		const float RingRadius = Radius + RingSpacing * Ring;
+		const int32 RingCount = RingCounts[Ring];
+		const float Step = RingCount <= 1 ? 0.0f : Arc / (bFullCircle ? RingCount : RingCount - 1);
+
+		for (int32 Index = 0; Index < RingCount; ++Index)
+		{
+			const float Angle = StartAngle + Step * Index;
+			const float Radians = FMath::DegreesToRadians(Angle);
+			const FVector Position(RingRadius * FMath::Cos(Radians), RingRadius * FMath::Sin(Radians), 0.0f);
+			OutLocal.Add(FTransform(bFaceOutward ? FRotator(0.0f, Angle, 0.0f) : FRotator::ZeroRotator, Position));
+		}
+	}
+	return true;
+}
+
+bool FEpicUnrealMCPPatternGenerator::GenerateSpline(const TSharedPtr<FJsonObject>& PatternJson, const FTransform& Root, TArray<FTransform>& OutWorld, FString& OutError) const
+{
+	TArray<FVector> Polyline;
+	bool bClosed = bPathClosed;
+
+	if (Path.Num() > 0)
+	{
+		Polyline = Path;
+	}
+	else
+	{
+		const TArray<TSharedPtr<FJsonValue>>* PointsJson;
+		if (!PatternJson->TryGetArrayField(TEXT("points"), PointsJson))
+		{
+			OutError = TEXT("Spline pattern needs 'points' or 'spline_actor'");
+			return false;
+		}
+
+		TArray<FVector> ControlPoints;
+		for (const TSharedPtr<FJsonValue>& PointValue : *PointsJson)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Coords;
+			if (!PointValue.IsValid() || !PointValue->TryGetArray(Coords) || Coords->Num() < 2)
+			{
+				OutError = TEXT("Spline points must be [X, Y] or [X, Y, Z] arrays");
+				return false;
+			}
+			ControlPoints.Add(Root.TransformPosition(FVector(
+				(*Coords)[0]->AsNumber(),
+				(*Coords)[1]->AsNumber(),
+				Coords->Num() >= 3 ? (*Coords)[2]->AsNumber() : 0.0)));
+		}
+
+		bClosed = false;
+		PatternJson->TryGetBoolField(TEXT("closed"), bClosed);
+
+		bool bCurved = true;
+		PatternJson->TryGetBoolField(TEXT("curved"), bCurved);
+
+		if (!bCurved || ControlPoints.Num() < 3)
+		{
+			Polyline = MoveTemp(ControlPoints);
+		}
+		else
+		{
+			// Same auto tangents the spline component uses, sampled densely enough to measure length
+			FInterpCurveVector Curve;
+			for (int32 Index = 0; Index < ControlPoints.Num(); ++Index)
+			{
+				const int32 KeyIndex = Curve.AddPoint(Index, ControlPoints[Index]);
+				Curve.Points[KeyIndex].InterpMode = CIM_CurveAuto;
+			}
+			if (bClosed)
+			{
+				Curve.SetLoopKey(ControlPoints.Num());
+			}
+			Curve.AutoSetTangents(0.0f, false);
+
+			const int32 NumSegments = bClosed ? ControlPoints.Num() : ControlPoints.Num() - 1;
+			const int32 NumSamples = NumSegments * SplineSubdivisions;
+			Polyline.Reserve(NumSamples + 1);
+			for (int32 Sample = 0; Sample < NumSamples + (bClosed ? 0 : 1); ++Sample)
+			{
+				Polyline.Add(Curve.Eval(float(Sample) / SplineSubdivisions, FVector::ZeroVector));
+			}
+		}
+	}
+
+	if (Polyline.Num() < 2)
+	{
+		OutError = TEXT("Spline pattern needs at least two points");
+		return false;
+	}
+	if (bClosed)
+	{
+		Polyline.Add(Polyline[0]);
+	}
+
+	TArray<float> Distances;
+	Distances.SetNumUninitialized(Polyline.Num());
+	Distances[0] = 0.0f;
+	for (int32 Index = 1; Index < Polyline.Num(); ++Index)
+	{
+		Distances[Index] = Distances[Index - 1] + FVector::Dist(Polyline[Index - 1], Polyline[Index]);
+	}
+	const float Length = Distances.Last();
+	if (Length < KINDA_SMALL_NUMBER)
+	{
+		OutError = TEXT("Spline has zero length");
+		return false;
+	}
+
+	// 'count' spreads copies evenly over the whole length; otherwise they are 'spacing' apart
+	float Spacing = ReadNumber(PatternJson, TEXT("spacing"), 200.0);
+	int32 Count = 0;
+	double CountValue = 0.0;
+	if (PatternJson->TryGetNumberField(TEXT("count"), CountValue))
+	{
+		Count = ClampCount(CountValue, MaxPoints);
+		Spacing = bClosed ? Length / FMath::Max(Count, 1) : Length / FMath::Max(Count - 1, 1);
+	}
+	else
+	{
+		if (Spacing <= KINDA_SMALL_NUMBER)
+		{
+			OutError = TEXT("Spline spacing must be positive");
+			return false;
+		}
+		const double Steps = Length / Spacing;
+		Count = ClampCount(bClosed ? FMath::FloorToDouble(Steps - KINDA_SMALL_NUMBER) + 1.0 : FMath::FloorToDouble(Steps + KINDA_SMALL_NUMBER) + 1.0, MaxPoints);
+	}
+
+	if (Count > MaxPoints)
+	{
+		OutError = FString::Printf(TEXT("Spline pattern exceeds %d points"), MaxPoints);
+		return false;
+	}
+
+	bool bAlign = true;
+	PatternJson->TryGetBoolField(TEXT("align"), bAlign);
+
+	// Distances only grow, so the segment cursor never moves backwards
+	OutWorld.Reserve(Count);
+	int32 Segment = 0;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const float Distance = FMath::Min(Spacing * Index, Length);
+		while (Segment < Polyline.Num() - 2 && Distances[Segment + 1] < Distance)
+		{
+			++Segment;
+		}
+
+		const float SegmentLength = Distances[Segment + 1] - Distances[Segment];
+		const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? (Distance - Distances[Segment]) / SegmentLength : 0.0f;
+		const FVector Position = FMath::Lerp(Polyline[Segment], Polyline[Segment + 1], Alpha);
+		const FVector Direction = Polyline[Segment + 1] - Polyline[Segment];
+
+		const FRotator Rotation = bAlign && !Direction.IsNearlyZero()
+			? FRotationMatrix::MakeFromX(Direction).Rotator()
+			: Root.Rotator();
+		OutWorld.Add(FTransform(Rotation, Position));
+	}
+	return true;
+}
+
+bool FEpicUnrealMCPPatternGenerator::GenerateScatter(const TSharedPtr<FJsonObject>& PatternJson, FRandomStream& Random, TArray<FTransform>& OutLocal, FString& OutError) const
+{
+	const FVector Size = ReadVector(PatternJson, TEXT("size"), FVector(2000.0f, 2000.0f, 0.0f));
+	const float MinDistance = ReadNumber(PatternJson, TEXT("min_distance"), 200.0);
+	const int32 MaxCount = FMath::Min(ClampCount(ReadNumber(PatternJson, TEXT("count"), MaxPoints), MaxPoints), MaxPoints);
+
+	if (Size.X <= 0.0f || Size.Y <= 0.0f || MinDistance <= KINDA_SMALL_NUMBER)
+	{
+		OutError = TEXT("Scatter needs a positive 'size' and 'min_distance'");
+		return false;
+	}
+
+	// Bridson's Poisson-disk sampling: a cell of r/sqrt(2) holds at most one sample
+	const float CellSize = MinDistance / FMath::Sqrt(2.0f);
+	const int32 GridX = FMath::CeilToInt(Size.X / CellSize);
+	const int32 GridY = FMath::CeilToInt(Size.Y / CellSize);
+	if (int64(GridX) * GridY > MaxScatterCells)
+	{
+		OutError = TEXT("Scatter area is too large for its min_distance");
+		return false;
+	}
+
+	TArray<int32> Grid;
+	Grid.Init(INDEX_NONE, GridX * GridY);
+	TArray<FVector2D> Samples;
+	TArray<int32> Active;
+	const float MinDistanceSquared = MinDistance * MinDistance;
+
+	auto CellOf = [CellSize, GridX, GridY](const FVector2D& Point)
+	{
+		return FIntPoint(
+			FMath::Clamp(FMath::FloorToInt(Point.X / CellSize), 0, GridX - 1),
+			FMath::Clamp(FMath::FloorToInt(Point.Y / CellSize), 0, GridY - 1));
+	};
+
+	auto AddSample = [&](const FVector2D& Point)
+	{
+		const FIntPoint Cell = CellOf(Point);
+		Grid[Cell.Y * GridX + Cell.X] = Samples.Num();
+		Active.Add(Samples.Num());
+		Samples.Add(Point);
+	};
+
+	if (MaxCount > 0)
+	{
+		AddSample(FVector2D(Random.FRandRange(0.0f, Size.X), Random.FRandRange(0.0f, Size.Y)));
+	}
+
+	while (Active.Num() > 0 && Samples.Num() < MaxCount)
+	{
+		const int32 ActiveSlot = Random.RandHelper(Active.Num());
+		const FVector2D Center = Samples[Active[ActiveSlot]];
+
+		bool bPlaced = false;
+		for (int32 Attempt = 0; Attempt < ScatterAttempts && !bPlaced; ++Attempt)
+		{
+			const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+			const float Distance = MinDistance * (1.0f + Random.FRand());
+			const FVector2D Candidate = Center + Distance * FVector2D(FMath::Cos(Angle), FMath::Sin(Angle));
+			if (Candidate.X < 0.0f || Candidate.Y < 0.0f || Candidate.X >= Size.X || Candidate.Y >= Size.Y)
+			{
+				continue;
+			}
+
+			const FIntPoint Cell = CellOf(Candidate);
+			bool bFits = true;
+			for (int32 Y = FMath::Max(Cell.Y - 2, 0); Y <= FMath::Min(Cell.Y + 2, GridY - 1) && bFits; ++Y)
+			{
+				for (int32 X = FMath::Max(Cell.X - 2, 0); X <= FMath::Min(Cell.X + 2, GridX - 1); ++X)
+				{
+					const int32 Neighbor = Grid[Y * GridX + X];
+					if (Neighbor != INDEX_NONE && FVector2D::DistSquared(Samples[Neighbor], Candidate) < MinDistanceSquared)
+					{
+						bFits = false;
+						break;
+					}
+				}
+			}
+
+			if (bFits)
+			{
+				AddSample(Candidate);
+				bPlaced = true;
+			}
+		}
+
+		if (!bPlaced)
+		{
+			Active.RemoveAtSwap(ActiveSlot);
+		}
+	}
+
+	// Samples live in [0, size); the pattern is centered on its location
+	OutLocal.Reserve(Samples.Num());
+	for (const FVector2D& Sample : Samples)
+	{
+		OutLocal.Add(FTransform(FVector(Sample.X - Size.X * 0.5f, Sample.Y - Size.Y * 0.5f, 0.0f)));
+	}
+	return true;
+}
+
+void FEpicUnrealMCPPatternGenerator::RejectOverlaps(TArray<FTransform>& InOutTransforms, float MinDistance, float Clearance) const
+{
+	if (MinDistance <= KINDA_SMALL_NUMBER && Blockers.Num() == 0)
+	{
+		return;
+	}
+
+	// Bucket blockers by the XY cells they cover
+	TArray<FBox> Expanded;
+	TMap<FIntPoint, TArray<int32>> BlockerCells;
+	TArray<int32> LargeBlockers;
+	Expanded.Reserve(Blockers.Num());
+	for (int32 BlockerIndex = 0; BlockerIndex < Blockers.Num(); ++BlockerIndex)
+	{
+		const FBox& Box = Expanded.Add_GetRef(Blockers[BlockerIndex].ExpandBy(Clearance));
+		const FIntPoint MinCell(FMath::FloorToInt(Box.Min.X / BlockerCellSize), FMath::FloorToInt(Box.Min.Y / BlockerCellSize));
+		const FIntPoint MaxCell(FMath::FloorToInt(Box.Max.X / BlockerCellSize), FMath::FloorToInt(Box.Max.Y / BlockerCellSize));
+		if (int64(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1) > MaxCellsPerBlocker)
+		{
+			LargeBlockers.Add(BlockerIndex);
+			continue;
+		}
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				BlockerCells.FindOrAdd(FIntPoint(X, Y)).Add(BlockerIndex);
+			}
+		}
+	}
+
+	auto IsBlocked = [&](const FVector& Location)
+	{
+		if (const TArray<int32>* Cell = BlockerCells.Find(FIntPoint(FMath::FloorToInt(Location.X / BlockerCellSize), FMath::FloorToInt(Location.Y / BlockerCellSize))))
+		{
+			for (int32 BlockerIndex : *Cell)
+			{
+				if (Expanded[BlockerIndex].IsInsideOrOn(Location))
+				{
+					return true;
+				}
+			}
+		}
+		for (int32 BlockerIndex : LargeBlockers)
+		{
+			if (Expanded[BlockerIndex].IsInsideOrOn(Location))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Accepted points bucketed by min_distance cells; only the 27 surrounding cells can conflict
+	TMap<FIntVector, TArray<int32>> PointCells;
+	const float MinDistanceSquared = MinDistance * MinDistance;
+	auto CellOf = [MinDistance](const FVector& Location)
+	{
+		return FIntVector(
+			FMath::FloorToInt(Location.X / MinDistance),
+			FMath::FloorToInt(Location.Y / MinDistance),
+			FMath::FloorToInt(Location.Z / MinDistance));
+	};
+
+	int32 NumKept = 0;
+	for (int32 Index = 0; Index < InOutTransforms.Num(); ++Index)
+	{
+		const FVector Location = InOutTransforms[Index].GetLocation();
+		if (Blockers.Num() > 0 && IsBlocked(Location))
+		{
+			continue;
+		}
+
+		if (MinDistance > KINDA_SMALL_NUMBER)
+		{
+			const FIntVector Cell = CellOf(Location);
+			bool bOverlaps = false;
+			for (int32 Z = Cell.Z - 1; Z <= Cell.Z + 1 && !bOverlaps; ++Z)
+			{
+				for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1 && !bOverlaps; ++Y)
+				{
+					for (int32 X = Cell.X - 1; X <= Cell.X + 1 && !bOverlaps; ++X)
+					{
+						if (const TArray<int32>* Neighbors = PointCells.Find(FIntVector(X, Y, Z)))
+						{
+							for (int32 Neighbor : *Neighbors)
+							{
+								if (FVector::DistSquared(InOutTransforms[Neighbor].GetLocation(), Location) < MinDistanceSquared)
+								{
+									bOverlaps = true;
+									break;
+								}
+							}
+						}
+					}
+				}
+			}
+			if (bOverlaps)
+			{
+				continue;
+			}
+			PointCells.FindOrAdd(Cell).Add(NumKept);
+		}
+
+		InOutTransforms[NumKept++] = InOutTransforms[Index];
+	}
+
+	InOutTransforms.SetNum(NumKept);
+}
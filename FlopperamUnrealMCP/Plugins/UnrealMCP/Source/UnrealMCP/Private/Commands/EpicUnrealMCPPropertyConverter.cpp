@@ -0,0 +1,1317 @@
+#include "Commands/EpicUnrealMCPPropertyConverter.h"
+#include "Misc/Base64.h"
+#include "UObject/UnrealType.h"
+
+FEpicUnrealMCPPropertyConverter::FEpicUnrealMCPPropertyConverter(FEpicUnrealMCPCacheInvalidation& InInvalidation)
+	: ActiveLimits(nullptr)
+	, Depth(0)
+	, Invalidation(InInvalidation)
+{
+	InvalidationHandle = Invalidation.Register(FSimpleDelegate::CreateRaw(this, &FEpicUnrealMCPPropertyConverter::Reset));
+}
+
+FEpicUnrealMCPPropertyConverter::~FEpicUnrealMCPPropertyConverter()
+{
+	Invalidation.Unregister(InvalidationHandle);
+}
+
+void FEpicUnrealMCPPropertyConverter::Reset()
+{
+	if (Plans.Num() > 0 || PropertyPlans.Num() > 0)
+	{
+		++Stats.Invalidations;
+	}
+	Plans.Reset();
+	PropertyPlans.Reset();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPropertyConverter::GetStatsJson() const
+{
+	return Stats.ToJson(Plans.Num() + PropertyPlans.Num());
+}
+
+// ============================================================================
+// Plans
+// ============================================================================
+
+FString FEpicUnrealMCPPropertyConverter::GetTypeName(FProperty* Property)
+{
+	if (!Property) return TEXT("Unknown");
+
+	if (CastField<FBoolProperty>(Property)) return TEXT("Bool");
+	if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+	{
+		return ByteProp->Enum ? FString::Printf(TEXT("Enum:%s"), *ByteProp->Enum->GetName()) : TEXT("Byte");
+	}
+	if (CastField<FIntProperty>(Property)) return TEXT("Int");
+	if (CastField<FInt64Property>(Property)) return TEXT("Int64");
+	if (CastField<FFloatProperty>(Property)) return TEXT("Float");
+	if (CastField<FDoubleProperty>(Property)) return TEXT("Double");
+	if (CastField<FStrProperty>(Property)) return TEXT("String");
+	if (CastField<FNameProperty>(Property)) return TEXT("Name");
+	if (CastField<FTextProperty>(Property)) return TEXT("Text");
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		return FString::Printf(TEXT("Struct:%s"), *StructProp->Struct->GetName());
+	}
+	if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+	{
+		return FString::Printf(TEXT("Enum:%s"), *EnumProp->GetEnum()->GetName());
+	}
+	if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+	{
+		return FString::Printf(TEXT("Object:%s"), *ObjProp->PropertyClass->GetName());
+	}
+	if (FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(Property))
+	{
+		return FString::Printf(TEXT("SoftClass:%s"), *SoftClassProp->MetaClass->GetName());
+	}
+	if (FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Property))
+	{
+		return FString::Printf(TEXT("SoftObject:%s"), *SoftProp->PropertyClass->GetName());
+	}
+	if (FWeakObjectProperty* WeakProp = CastField<FWeakObjectProperty>(Property))
+	{
+		return FString::Printf(TEXT("WeakObject:%s"), *WeakProp->PropertyClass->GetName());
+	}
+	if (FLazyObjectProperty* LazyProp = CastField<FLazyObjectProperty>(Property))
+	{
+		return FString::Printf(TEXT("LazyObject:%s"), *LazyProp->PropertyClass->GetName());
+	}
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		return FString::Printf(TEXT("Array<%s>"), *GetTypeName(ArrayProp->Inner));
+	}
+	if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		return FString::Printf(TEXT("Map<%s, %s>"),
+			*GetTypeName(MapProp->KeyProp),
+			*GetTypeName(MapProp->ValueProp));
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		return FString::Printf(TEXT("Set<%s>"), *GetTypeName(SetProp->ElementProp));
+	}
+
+	return Property->GetClass()->GetName();
+}
+
+bool FEpicUnrealMCPPropertyConverter::HasCompactForm(const UScriptStruct* Struct)
+{
+	return Struct == TBaseStructure<FVector>::Get()
+		|| Struct == TBaseStructure<FRotator>::Get()
+		|| Struct == TBaseStructure<FTransform>::Get()
+		|| Struct == TBaseStructure<FLinearColor>::Get()
+		|| Struct == TBaseStructure<FColor>::Get()
+		|| Struct == TBaseStructure<FVector2D>::Get();
+}
+
+int32 FEpicUnrealMCPPropertyConverter::GetNumElements(FProperty* Property, const void* ValuePtr)
+{
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		return FScriptArrayHelper(ArrayProp, ValuePtr).Num();
+	}
+	if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		return FScriptMapHelper(MapProp, ValuePtr).Num();
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		return FScriptSetHelper(SetProp, ValuePtr).Num();
+	}
+	return INDEX_NONE;
+}
+
+bool FEpicUnrealMCPPropertyConverter::ParseContinuation(const FString& Token, FString& OutPath, int32& OutOffset)
+{
+	FString OffsetText;
+	if (!Token.Split(TEXT("@"), &OutPath, &OffsetText, ESearchCase::CaseSensitive, ESearchDir::FromEnd)
+		|| OutPath.IsEmpty() || !OffsetText.IsNumeric())
+	{
+		return false;
+	}
+	OutOffset = FMath::Max(0, FCString::Atoi(*OffsetText));
+	return true;
+}
+
+FEpicUnrealMCPPropertyConverter::EKind FEpicUnrealMCPPropertyConverter::Classify(FProperty* Property)
+{
+	if (CastField<FBoolProperty>(Property)) return EKind::Bool;
+	if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+	{
+		return ByteProp->Enum ? EKind::ByteEnum : EKind::Byte;
+	}
+	if (CastField<FIntProperty>(Property)) return EKind::Int;
+	if (CastField<FInt64Property>(Property)) return EKind::Int64;
+	if (CastField<FFloatProperty>(Property)) return EKind::Float;
+	if (CastField<FDoubleProperty>(Property)) return EKind::Double;
+	if (CastField<FStrProperty>(Property)) return EKind::Str;
+	if (CastField<FNameProperty>(Property)) return EKind::Name;
+	if (CastField<FTextProperty>(Property)) return EKind::Text;
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		UScriptStruct* Struct = StructProp->Struct;
+		if (Struct == TBaseStructure<FVector>::Get()) return EKind::Vector;
+		if (Struct == TBaseStructure<FRotator>::Get()) return EKind::Rotator;
+		if (Struct == TBaseStructure<FTransform>::Get()) return EKind::Transform;
+		if (Struct == TBaseStructure<FLinearColor>::Get()) return EKind::LinearColor;
+		if (Struct == TBaseStructure<FColor>::Get()) return EKind::Color;
+		if (Struct == TBaseStructure<FVector2D>::Get()) return EKind::Vector2D;
+		return EKind::Struct;
+	}
+	if (CastField<FEnumProperty>(Property)) return EKind::Enum;
+	// Class properties are object properties too and convert the same way
+	if (CastField<FObjectProperty>(Property)) return EKind::Object;
+	// Soft class properties are soft object properties holding a class path
+	if (CastField<FSoftObjectProperty>(Property)) return EKind::SoftObject;
+	if (CastField<FWeakObjectProperty>(Property) || CastField<FLazyObjectProperty>(Property)) return EKind::Object;
+	if (CastField<FArrayProperty>(Property)) return EKind::Array;
+	if (CastField<FMapProperty>(Property)) return EKind::Map;
+	if (CastField<FSetProperty>(Property)) return EKind::Set;
+	return EKind::Other;
+}
+
+bool FEpicUnrealMCPPropertyConverter::IsNumeric(EKind Kind)
+{
+	return Kind == EKind::Byte || Kind == EKind::Int || Kind == EKind::Int64 || Kind == EKind::Float || Kind == EKind::Double;
+}
+
+void FEpicUnrealMCPPropertyConverter::BuildNode(FProperty* Property, FNode& Out)
+{
+	Out.Property = Property;
+	Out.Kind = Classify(Property);
+
+	if (Out.Kind == EKind::Struct)
+	{
+		Out.Struct = CastFieldChecked<FStructProperty>(Property)->Struct;
+	}
+	else if (Out.Kind == EKind::Array)
+	{
+		BuildNode(CastFieldChecked<FArrayProperty>(Property)->Inner, Out.Children.AddDefaulted_GetRef());
+	}
+	else if (Out.Kind == EKind::Set)
+	{
+		BuildNode(CastFieldChecked<FSetProperty>(Property)->ElementProp, Out.Children.AddDefaulted_GetRef());
+	}
+	else if (Out.Kind == EKind::Map)
+	{
+		FMapProperty* MapProp = CastFieldChecked<FMapProperty>(Property);
+		Out.Children.SetNum(2);
+		BuildNode(MapProp->KeyProp, Out.Children[0]);
+		BuildNode(MapProp->ValueProp, Out.Children[1]);
+	}
+}
+
+TSharedPtr<FEpicUnrealMCPPropertyConverter::FStructPlan> FEpicUnrealMCPPropertyConverter::FindOrBuildPlan(UScriptStruct* Struct)
+{
+	TSharedPtr<FStructPlan>& Entry = Plans.FindOrAdd(Struct);
+
+	// A stale struct means the old one was destroyed and another now lives at the same address
+	if (Entry.IsValid() && Entry->Struct.IsValid())
+	{
+		++Stats.Hits;
+		return Entry;
+	}
+
+	++Stats.Misses;
+	Invalidation.BindDelegates();
+
+	Entry = MakeShared<FStructPlan>();
+	Entry->Struct = Struct;
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	{
+		FNode& Field = Entry->Fields.AddDefaulted_GetRef();
+		BuildNode(*PropIt, Field);
+		Field.Offset = PropIt->GetOffset_ForInternal();
+		Field.Name = PropIt->GetName();
+		Field.TypeName = GetTypeName(*PropIt);
+	}
+	BuildNumericRuns(Entry->Fields);
+	return Entry;
+}
+
+void FEpicUnrealMCPPropertyConverter::BuildNumericRuns(TArray<FNode>& Fields)
+{
+	for (int32 First = 0; First < Fields.Num();)
+	{
+		const FNode& Head = Fields[First];
+		int32 End = First + 1;
+		if (IsNumeric(Head.Kind) && Head.Property->ArrayDim == 1)
+		{
+			const int32 Size = Head.Property->ElementSize;
+			while (End < Fields.Num()
+				&& Fields[End].Kind == Head.Kind
+				&& Fields[End].Property->ArrayDim == 1
+				&& Fields[End].Offset == Head.Offset + (End - First) * Size)
+			{
+				++End;
+			}
+		}
+
+		Fields[First].RunLength = End - First;
+		for (int32 Index = First + 1; Index < End; ++Index)
+		{
+			Fields[Index].RunLength = 0;
+		}
+		First = End;
+	}
+}
+
+TSharedPtr<FEpicUnrealMCPPropertyConverter::FPropertyPlan> FEpicUnrealMCPPropertyConverter::FindOrBuildPropertyPlan(FProperty* Property)
+{
+	UStruct* Owner = Property->GetOwnerStruct();
+	if (!Owner)
+	{
+		// Properties outside any struct have nothing to key their lifetime on
+		TSharedPtr<FPropertyPlan> Uncached = MakeShared<FPropertyPlan>();
+		BuildNode(Property, Uncached->Node);
+		return Uncached;
+	}
+
+	TSharedPtr<FPropertyPlan>& Entry = PropertyPlans.FindOrAdd(Property);
+
+	// Properties are destroyed with their struct, so a stale owner means the address may have been reused
+	if (Entry.IsValid() && Entry->Owner.IsValid())
+	{
+		++Stats.Hits;
+		return Entry;
+	}
+
+	++Stats.Misses;
+	Invalidation.BindDelegates();
+
+	Entry = MakeShared<FPropertyPlan>();
+	Entry->Owner = Owner;
+	BuildNode(Property, Entry->Node);
+	return Entry;
+}
+
+// ============================================================================
+// Conversion
+// ============================================================================
+
+double FEpicUnrealMCPPropertyConverter::ReadNumber(EKind Kind, const void* ValuePtr)
+{
+	switch (Kind)
+	{
+	case EKind::Byte:   return *static_cast<const uint8*>(ValuePtr);
+	case EKind::Int:    return *static_cast<const int32*>(ValuePtr);
+	case EKind::Int64:  return (double)*static_cast<const int64*>(ValuePtr);
+	case EKind::Float:  return *static_cast<const float*>(ValuePtr);
+	case EKind::Double: return *static_cast<const double*>(ValuePtr);
+	default:            return 0.0;
+	}
+}
+
+void FEpicUnrealMCPPropertyConverter::WriteNumber(EKind Kind, void* ValuePtr, double Value)
+{
+	switch (Kind)
+	{
+	case EKind::Byte:   *static_cast<uint8*>(ValuePtr) = static_cast<uint8>(Value); break;
+	case EKind::Int:    *static_cast<int32*>(ValuePtr) = static_cast<int32>(Value); break;
+	case EKind::Int64:  *static_cast<int64*>(ValuePtr) = static_cast<int64>(Value); break;
+	case EKind::Float:  *static_cast<float*>(ValuePtr) = static_cast<float>(Value); break;
+	case EKind::Double: *static_cast<double*>(ValuePtr) = Value; break;
+	default: break;
+	}
+}
+
+template <typename T>
+static void ReadTyped(const void* FirstPtr, int32 Count, double* OutValues)
+{
+	const T* Values = static_cast<const T*>(FirstPtr);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutValues[i] = (double)Values[i];
+	}
+}
+
+template <typename T>
+static void WriteTyped(void* FirstPtr, int32 Count, const double* Values)
+{
+	T* OutValues = static_cast<T*>(FirstPtr);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutValues[i] = static_cast<T>(Values[i]);
+	}
+}
+
+void FEpicUnrealMCPPropertyConverter::ReadNumbers(EKind Kind, const void* FirstPtr, int32 Count, double* OutValues)
+{
+	switch (Kind)
+	{
+	case EKind::Byte:   ReadTyped<uint8>(FirstPtr, Count, OutValues); break;
+	case EKind::Int:    ReadTyped<int32>(FirstPtr, Count, OutValues); break;
+	case EKind::Int64:  ReadTyped<int64>(FirstPtr, Count, OutValues); break;
+	case EKind::Float:  ReadTyped<float>(FirstPtr, Count, OutValues); break;
+	case EKind::Double: ReadTyped<double>(FirstPtr, Count, OutValues); break;
+	default: break;
+	}
+}
+
+void FEpicUnrealMCPPropertyConverter::WriteNumbers(EKind Kind, void* FirstPtr, int32 Count, const double* Values)
+{
+	switch (Kind)
+	{
+	case EKind::Byte:   WriteTyped<uint8>(FirstPtr, Count, Values); break;
+	case EKind::Int:    WriteTyped<int32>(FirstPtr, Count, Values); break;
+	case EKind::Int64:  WriteTyped<int64>(FirstPtr, Count, Values); break;
+	case EKind::Float:  WriteTyped<float>(FirstPtr, Count, Values); break;
+	case EKind::Double: WriteTyped<double>(FirstPtr, Count, Values); break;
+	default: break;
+	}
+}
+
+const TCHAR* FEpicUnrealMCPPropertyConverter::GetScalarName(EKind Kind)
+{
+	switch (Kind)
+	{
+	case EKind::Byte:   return TEXT("u8");
+	case EKind::Int:    return TEXT("i32");
+	case EKind::Int64:  return TEXT("i64");
+	case EKind::Float:  return TEXT("f32");
+	case EKind::Double: return TEXT("f64");
+	default:            return TEXT("");
+	}
+}
+
+bool FEpicUnrealMCPPropertyConverter::GetPackedLayout(const FNode& Element, EKind& OutScalar, TArray<FString>& OutFields)
+{
+	OutFields.Reset();
+	if (IsNumeric(Element.Kind))
+	{
+		OutScalar = Element.Kind;
+		return true;
+	}
+
+	// Structs qualify when their memory is nothing but fields of one numeric type back to back
+	FStructProperty* StructProp = CastField<FStructProperty>(Element.Property);
+	if (!StructProp)
+	{
+		return false;
+	}
+	TSharedPtr<FStructPlan> Plan = FindOrBuildPlan(StructProp->Struct);
+	if (Plan->Fields.Num() == 0 || !IsNumeric(Plan->Fields[0].Kind))
+	{
+		return false;
+	}
+
+	OutScalar = Plan->Fields[0].Kind;
+	const int32 ScalarSize = Plan->Fields[0].Property->ElementSize;
+	for (int32 i = 0; i < Plan->Fields.Num(); ++i)
+	{
+		const FNode& Field = Plan->Fields[i];
+		if (Field.Kind != OutScalar || Field.Offset != i * ScalarSize || Field.Property->ArrayDim != 1)
+		{
+			return false;
+		}
+		OutFields.Add(Field.Name);
+	}
+	return StructProp->Struct->GetStructureSize() == Plan->Fields.Num() * ScalarSize;
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::PackArray(const FNode& Element, FScriptArrayHelper& ArrayHelper, int32 Start, int32 End)
+{
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Packed array encoding assumes a little-endian host");
+
+	EKind Scalar;
+	TArray<FString> Fields;
+	if (!GetPackedLayout(Element, Scalar, Fields))
+	{
+		return nullptr;
+	}
+
+	const int32 Count = End - Start;
+	const int32 Stride = Element.Property->ElementSize;
+
+	TSharedPtr<FJsonObject> PackedJson = MakeShared<FJsonObject>();
+	PackedJson->SetStringField(TEXT("encoding"), TEXT("base64"));
+	PackedJson->SetStringField(TEXT("element"), GetScalarName(Scalar));
+	PackedJson->SetNumberField(TEXT("components"), FMath::Max(1, Fields.Num()));
+	if (Fields.Num() > 0)
+	{
+		// Memory order, which is not always the order of the unpacked form (FColor is B, G, R, A)
+		TArray<TSharedPtr<FJsonValue>> FieldsJson;
+		for (const FString& FieldName : Fields)
+		{
+			FieldsJson.Add(MakeShared<FJsonValueString>(FieldName));
+		}
+		PackedJson->SetArrayField(TEXT("fields"), FieldsJson);
+	}
+	PackedJson->SetNumberField(TEXT("count"), Count);
+	PackedJson->SetStringField(TEXT("data"), Count > 0 ? FBase64::Encode(ArrayHelper.GetRawPtr(Start), Count * Stride) : FString());
+	return MakeShared<FJsonValueObject>(PackedJson);
+}
+
+bool FEpicUnrealMCPPropertyConverter::UnpackArray(const FNode& Node, const FJsonObject& PackedJson, void* ValuePtr)
+{
+	const FNode& Element = Node.Children[0];
+
+	FString Encoding;
+	FString Data;
+	if (!PackedJson.TryGetStringField(TEXT("encoding"), Encoding) || Encoding != TEXT("base64")
+		|| !PackedJson.TryGetStringField(TEXT("data"), Data))
+	{
+		return false;
+	}
+
+	EKind Scalar;
+	TArray<FString> Fields;
+	if (!GetPackedLayout(Element, Scalar, Fields))
+	{
+		return false;
+	}
+
+	// The bytes are copied as they are, so the described layout has to match the array's exactly
+	FString ElementName;
+	int32 Components;
+	if (!PackedJson.TryGetStringField(TEXT("element"), ElementName) || ElementName != GetScalarName(Scalar)
+		|| !PackedJson.TryGetNumberField(TEXT("components"), Components) || Components != FMath::Max(1, Fields.Num()))
+	{
+		return false;
+	}
+
+	// Same size and scalar type is not enough: an RGBA block written into FColor (B, G, R, A) would swap channels
+	TArray<FString> PackedFields;
+	const TArray<TSharedPtr<FJsonValue>>* FieldsJson;
+	if (PackedJson.TryGetArrayField(TEXT("fields"), FieldsJson))
+	{
+		for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsJson)
+		{
+			PackedFields.Add(FieldValue.IsValid() ? FieldValue->AsString() : FString());
+		}
+	}
+	if (PackedFields != Fields)
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FBase64::Decode(Data, Bytes))
+	{
+		return false;
+	}
+
+	const int32 Stride = Element.Property->ElementSize;
+	int32 Count = Bytes.Num() / Stride;
+	if (Bytes.Num() % Stride != 0 || (PackedJson.TryGetNumberField(TEXT("count"), Count) && Count * Stride != Bytes.Num()))
+	{
+		return false;
+	}
+
+	FScriptArrayHelper ArrayHelper(static_cast<FArrayProperty*>(Node.Property), ValuePtr);
+	ArrayHelper.Resize(Count);
+	if (Count > 0)
+	{
+		FMemory::Memcpy(ArrayHelper.GetRawPtr(0), Bytes.GetData(), Bytes.Num());
+	}
+	return true;
+}
+
+static TSharedPtr<FJsonValue> NumbersToJson(std::initializer_list<double> Numbers)
+{
+	TArray<TSharedPtr<FJsonValue>> Arr;
+	Arr.Reserve(Numbers.size());
+	for (double Number : Numbers)
+	{
+		Arr.Add(MakeShared<FJsonValueNumber>(Number));
+	}
+	return MakeShared<FJsonValueArray>(Arr);
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::ToJson(FProperty* Property, const void* ValuePtr)
+{
+	if (!Property || !ValuePtr)
+	{
+		return MakeShared<FJsonValueNull>();
+	}
+
+	return NodeToJson(FindOrBuildPropertyPlan(Property)->Node, ValuePtr);
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::ToJson(FProperty* Property, const void* ValuePtr, const FEpicUnrealMCPConvertLimits& Limits, const FString& Path)
+{
+	if (!Limits.IsActive())
+	{
+		return ToJson(Property, ValuePtr);
+	}
+	if (!Property || !ValuePtr)
+	{
+		return MakeShared<FJsonValueNull>();
+	}
+
+	TSharedPtr<FPropertyPlan> Plan = FindOrBuildPropertyPlan(Property);
+
+	ActiveLimits = &Limits;
+	Depth = 0;
+	CurrentPath = Path;
+	TSharedPtr<FJsonValue> Result = NodeToJson(Plan->Node, ValuePtr);
+	ActiveLimits = nullptr;
+	CurrentPath.Reset();
+	return Result;
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::DescendToJson(const FNode& Node, const void* ValuePtr, const FString& Segment)
+{
+	const int32 Mark = CurrentPath.Len();
+	CurrentPath += Segment;
+	++Depth;
+
+	TSharedPtr<FJsonValue> Result = NodeToJson(Node, ValuePtr);
+
+	--Depth;
+	CurrentPath.LeftInline(Mark, false);
+	return Result;
+}
+
+bool FEpicUnrealMCPPropertyConverter::IsBeyondDepth() const
+{
+	return ActiveLimits->MaxDepth > 0 && Depth >= ActiveLimits->MaxDepth;
+}
+
+void FEpicUnrealMCPPropertyConverter::GetSlice(int32 Num, int32& OutStart, int32& OutEnd) const
+{
+	// The offset only applies to the requested value; nested containers always start at their first element
+	OutStart = Depth == 0 ? FMath::Clamp(ActiveLimits->Offset, 0, Num) : 0;
+	OutEnd = ActiveLimits->MaxElements > 0 ? FMath::Min(Num, OutStart + ActiveLimits->MaxElements) : Num;
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::MakeStub(const FNode& Node, int32 Num) const
+{
+	TSharedPtr<FJsonObject> StubJson = MakeShared<FJsonObject>();
+	StubJson->SetBoolField(TEXT("_truncated"), true);
+	StubJson->SetStringField(TEXT("type"), GetTypeName(Node.Property));
+	if (Num != INDEX_NONE)
+	{
+		StubJson->SetNumberField(TEXT("count"), Num);
+	}
+	StubJson->SetStringField(TEXT("continuation"), FString::Printf(TEXT("%s@0"), *CurrentPath));
+	return MakeShared<FJsonValueObject>(StubJson);
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::MakeSlice(const FNode& Node, const TSharedPtr<FJsonValue>& Items, int32 Num, int32 Start, int32 End) const
+{
+	TSharedPtr<FJsonObject> SliceJson = MakeShared<FJsonObject>();
+	SliceJson->SetBoolField(TEXT("_truncated"), true);
+	SliceJson->SetStringField(TEXT("type"), GetTypeName(Node.Property));
+	SliceJson->SetNumberField(TEXT("count"), Num);
+	SliceJson->SetNumberField(TEXT("offset"), Start);
+	SliceJson->SetField(TEXT("items"), Items);
+	if (End < Num)
+	{
+		SliceJson->SetStringField(TEXT("continuation"), FString::Printf(TEXT("%s@%d"), *CurrentPath, End));
+	}
+	return MakeShared<FJsonValueObject>(SliceJson);
+}
+
+bool FEpicUnrealMCPPropertyConverter::FromJson(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ValuePtr)
+{
+	if (!JsonValue.IsValid() || !Property || !ValuePtr)
+	{
+		return false;
+	}
+
+	return NodeFromJson(FindOrBuildPropertyPlan(Property)->Node, JsonValue, ValuePtr);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPropertyConverter::StructToJson(UScriptStruct* Struct, const void* StructPtr, bool bWithTypes)
+{
+	if (!Struct || !StructPtr)
+	{
+		return MakeShared<FJsonObject>();
+	}
+	return PlanToJson(*FindOrBuildPlan(Struct), StructPtr, bWithTypes);
+}
+
+void FEpicUnrealMCPPropertyConverter::StructFromJson(const FJsonObject& JsonObj, UScriptStruct* Struct, void* StructPtr, bool bUnwrapTyped, TArray<FString>* OutFailedFields)
+{
+	if (!Struct || !StructPtr)
+	{
+		return;
+	}
+	PlanFromJson(*FindOrBuildPlan(Struct), JsonObj, StructPtr, bUnwrapTyped, OutFailedFields);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPropertyConverter::PlanToJson(const FStructPlan& Plan, const void* StructPtr, bool bWithTypes)
+{
+	const uint8* Base = static_cast<const uint8*>(StructPtr);
+	TSharedPtr<FJsonObject> StructJson = MakeShared<FJsonObject>();
+
+	auto SetField = [&StructJson, bWithTypes](const FNode& Field, const TSharedPtr<FJsonValue>& FieldJson)
+	{
+		if (bWithTypes)
+		{
+			TSharedPtr<FJsonObject> FieldObj = MakeShared<FJsonObject>();
+			FieldObj->SetStringField(TEXT("type"), Field.TypeName);
+			FieldObj->SetField(TEXT("value"), FieldJson);
+			StructJson->SetObjectField(Field.Name, FieldObj);
+		}
+		else
+		{
+			StructJson->SetField(Field.Name, FieldJson);
+		}
+	};
+
+	TArray<double, TInlineAllocator<16>> RunValues;
+	for (int32 Index = 0; Index < Plan.Fields.Num();)
+	{
+		const FNode& Field = Plan.Fields[Index];
+		const void* FieldPtr = Base + Field.Offset;
+		if (IsNumeric(Field.Kind))
+		{
+			// The run's fields sit back to back, so they read as one typed array
+			RunValues.SetNumUninitialized(Field.RunLength);
+			ReadNumbers(Field.Kind, FieldPtr, Field.RunLength, RunValues.GetData());
+			for (int32 i = 0; i < Field.RunLength; ++i)
+			{
+				SetField(Plan.Fields[Index + i], MakeShared<FJsonValueNumber>(RunValues[i]));
+			}
+			Index += Field.RunLength;
+			continue;
+		}
+
+		SetField(Field, ActiveLimits ? DescendToJson(Field, FieldPtr, TEXT(".") + Field.Name) : NodeToJson(Field, FieldPtr));
+		++Index;
+	}
+	return StructJson;
+}
+
+void FEpicUnrealMCPPropertyConverter::PlanFromJson(const FStructPlan& Plan, const FJsonObject& JsonObj, void* StructPtr, bool bUnwrapTyped, TArray<FString>* OutFailedFields)
+{
+	uint8* Base = static_cast<uint8*>(StructPtr);
+
+	auto GetField = [&JsonObj, bUnwrapTyped](const FNode& Field)
+	{
+		TSharedPtr<FJsonValue> FieldJson = JsonObj.TryGetField(Field.Name);
+
+		// Accept both {type, value} as returned by StructToJson and the bare value
+		const TSharedPtr<FJsonObject>* TypedField;
+		if (bUnwrapTyped && FieldJson.IsValid() && FieldJson->TryGetObject(TypedField) && (*TypedField)->HasField(TEXT("value")))
+		{
+			FieldJson = (*TypedField)->TryGetField(TEXT("value"));
+		}
+		return FieldJson;
+	};
+
+	TArray<double, TInlineAllocator<16>> RunValues;
+	for (int32 Index = 0; Index < Plan.Fields.Num();)
+	{
+		const FNode& Field = Plan.Fields[Index];
+		void* FieldPtr = Base + Field.Offset;
+		if (IsNumeric(Field.Kind))
+		{
+			// Start from the current values so fields missing from the JSON keep theirs
+			RunValues.SetNumUninitialized(Field.RunLength);
+			ReadNumbers(Field.Kind, FieldPtr, Field.RunLength, RunValues.GetData());
+			for (int32 i = 0; i < Field.RunLength; ++i)
+			{
+				TSharedPtr<FJsonValue> FieldJson = GetField(Plan.Fields[Index + i]);
+				if (FieldJson.IsValid() && !FieldJson->TryGetNumber(RunValues[i]) && OutFailedFields)
+				{
+					OutFailedFields->Add(Plan.Fields[Index + i].Name);
+				}
+			}
+			WriteNumbers(Field.Kind, FieldPtr, Field.RunLength, RunValues.GetData());
+			Index += Field.RunLength;
+			continue;
+		}
+
+		TSharedPtr<FJsonValue> FieldJson = GetField(Field);
+		if (FieldJson.IsValid() && !NodeFromJson(Field, FieldJson, FieldPtr) && OutFailedFields)
+		{
+			OutFailedFields->Add(Field.Name);
+		}
+		++Index;
+	}
+}
+
+TSharedPtr<FJsonValue> FEpicUnrealMCPPropertyConverter::NodeToJson(const FNode& Node, const void* ValuePtr)
+{
+	switch (Node.Kind)
+	{
+	case EKind::Bool:
+		return MakeShared<FJsonValueBoolean>(static_cast<FBoolProperty*>(Node.Property)->GetPropertyValue(ValuePtr));
+
+	case EKind::Byte:
+	case EKind::Int:
+	case EKind::Int64:
+	case EKind::Float:
+	case EKind::Double:
+		return MakeShared<FJsonValueNumber>(ReadNumber(Node.Kind, ValuePtr));
+
+	case EKind::ByteEnum:
+	{
+		const uint8 Value = *static_cast<const uint8*>(ValuePtr);
+		return MakeShared<FJsonValueString>(static_cast<FByteProperty*>(Node.Property)->Enum->GetNameStringByIndex(Value));
+	}
+
+	case EKind::Str:
+		return MakeShared<FJsonValueString>(*static_cast<const FString*>(ValuePtr));
+	case EKind::Name:
+		return MakeShared<FJsonValueString>(static_cast<const FName*>(ValuePtr)->ToString());
+	case EKind::Text:
+		return MakeShared<FJsonValueString>(static_cast<const FText*>(ValuePtr)->ToString());
+
+	case EKind::Vector:
+	{
+		const FVector* Vec = static_cast<const FVector*>(ValuePtr);
+		return NumbersToJson({ Vec->X, Vec->Y, Vec->Z });
+	}
+	case EKind::Rotator:
+	{
+		const FRotator* Rot = static_cast<const FRotator*>(ValuePtr);
+		return NumbersToJson({ Rot->Pitch, Rot->Yaw, Rot->Roll });
+	}
+	case EKind::Transform:
+	{
+		const FTransform* Trans = static_cast<const FTransform*>(ValuePtr);
+		const FVector Location = Trans->GetLocation();
+		const FRotator Rot = Trans->GetRotation().Rotator();
+		const FVector Scale = Trans->GetScale3D();
+
+		TSharedPtr<FJsonObject> TransObj = MakeShared<FJsonObject>();
+		TransObj->SetField(TEXT("location"), NumbersToJson({ Location.X, Location.Y, Location.Z }));
+		TransObj->SetField(TEXT("rotation"), NumbersToJson({ Rot.Pitch, Rot.Yaw, Rot.Roll }));
+		TransObj->SetField(TEXT("scale"), NumbersToJson({ Scale.X, Scale.Y, Scale.Z }));
+		return MakeShared<FJsonValueObject>(TransObj);
+	}
+	case EKind::LinearColor:
+	{
+		const FLinearColor* Color = static_cast<const FLinearColor*>(ValuePtr);
+		return NumbersToJson({ Color->R, Color->G, Color->B, Color->A });
+	}
+	case EKind::Color:
+	{
+		const FColor* Color = static_cast<const FColor*>(ValuePtr);
+		return NumbersToJson({ (double)Color->R, (double)Color->G, (double)Color->B, (double)Color->A });
+	}
+	case EKind::Vector2D:
+	{
+		const FVector2D* Vec = static_cast<const FVector2D*>(ValuePtr);
+		return NumbersToJson({ Vec->X, Vec->Y });
+	}
+
+	case EKind::Struct:
+		if (ActiveLimits && IsBeyondDepth())
+		{
+			return MakeStub(Node, INDEX_NONE);
+		}
+		return MakeShared<FJsonValueObject>(PlanToJson(*FindOrBuildPlan(Node.Struct), ValuePtr, false));
+
+	case EKind::Enum:
+	{
+		FEnumProperty* EnumProp = static_cast<FEnumProperty*>(Node.Property);
+		const int64 Value = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+		return MakeShared<FJsonValueString>(EnumProp->GetEnum()->GetNameStringByValue(Value));
+	}
+
+	case EKind::Object:
+	{
+		UObject* Obj = static_cast<FObjectPropertyBase*>(Node.Property)->GetObjectPropertyValue(ValuePtr);
+		if (Obj)
+		{
+			return MakeShared<FJsonValueString>(Obj->GetPathName());
+		}
+		return MakeShared<FJsonValueNull>();
+	}
+
+	case EKind::SoftObject:
+	{
+		const FSoftObjectPath& Path = static_cast<const FSoftObjectPtr*>(ValuePtr)->ToSoftObjectPath();
+		if (Path.IsNull())
+		{
+			return MakeShared<FJsonValueNull>();
+		}
+		return MakeShared<FJsonValueString>(Path.ToString());
+	}
+
+	case EKind::Array:
+	{
+		FScriptArrayHelper ArrayHelper(static_cast<FArrayProperty*>(Node.Property), ValuePtr);
+		const FNode& Element = Node.Children[0];
+		const int32 Num = ArrayHelper.Num();
+
+		int32 Start = 0;
+		int32 End = Num;
+		if (ActiveLimits)
+		{
+			if (IsBeyondDepth())
+			{
+				return MakeStub(Node, Num);
+			}
+			GetSlice(Num, Start, End);
+		}
+
+		if (ActiveLimits && ActiveLimits->bPacked)
+		{
+			if (TSharedPtr<FJsonValue> Packed = PackArray(Element, ArrayHelper, Start, End))
+			{
+				return Start > 0 || End < Num ? MakeSlice(Node, Packed, Num, Start, End) : Packed;
+			}
+		}
+
+		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		JsonArray.Reserve(End - Start);
+
+		if (IsNumeric(Element.Kind))
+		{
+			// Elements are packed, so walk the raw buffer
+			const uint8* Data = Num > 0 ? ArrayHelper.GetRawPtr(0) : nullptr;
+			const int32 Stride = Element.Property->ElementSize;
+			for (int32 i = Start; i < End; ++i)
+			{
+				JsonArray.Add(MakeShared<FJsonValueNumber>(ReadNumber(Element.Kind, Data + i * Stride)));
+			}
+		}
+		else if (Element.Kind == EKind::Struct && !ActiveLimits)
+		{
+			TSharedPtr<FStructPlan> Plan = FindOrBuildPlan(Element.Struct);
+			for (int32 i = Start; i < End; ++i)
+			{
+				JsonArray.Add(MakeShared<FJsonValueObject>(PlanToJson(*Plan, ArrayHelper.GetRawPtr(i), false)));
+			}
+		}
+		else
+		{
+			for (int32 i = Start; i < End; ++i)
+			{
+				JsonArray.Add(ActiveLimits
+					? DescendToJson(Element, ArrayHelper.GetRawPtr(i), FString::Printf(TEXT("[%d]"), i))
+					: NodeToJson(Element, ArrayHelper.GetRawPtr(i)));
+			}
+		}
+
+		TSharedPtr<FJsonValue> Items = MakeShared<FJsonValueArray>(JsonArray);
+		return Start > 0 || End < Num ? MakeSlice(Node, Items, Num, Start, End) : Items;
+	}
+
+	case EKind::Map:
+	{
+		FScriptMapHelper MapHelper(static_cast<FMapProperty*>(Node.Property), ValuePtr);
+		const FNode& Key = Node.Children[0];
+		const FNode& Value = Node.Children[1];
+		const int32 Num = MapHelper.Num();
+
+		int32 Start = 0;
+		int32 End = Num;
+		if (ActiveLimits)
+		{
+			if (IsBeyondDepth())
+			{
+				return MakeStub(Node, Num);
+			}
+			GetSlice(Num, Start, End);
+		}
+
+		TSharedPtr<FJsonObject> JsonMap = MakeShared<FJsonObject>();
+		for (int32 i = 0, Logical = 0; i < MapHelper.GetMaxIndex() && Logical < End; ++i)
+		{
+			if (!MapHelper.IsValidIndex(i) || Logical++ < Start)
+			{
+				continue;
+			}
+
+			// Keys become JSON object keys, so they are exported as text
+			FString KeyStr;
+			Key.Property->ExportTextItem(KeyStr, MapHelper.GetKeyPtr(i), nullptr, nullptr, PPF_None);
+			JsonMap->SetField(KeyStr, ActiveLimits
+				? DescendToJson(Value, MapHelper.GetValuePtr(i), TEXT("{") + KeyStr + TEXT("}"))
+				: NodeToJson(Value, MapHelper.GetValuePtr(i)));
+		}
+
+		TSharedPtr<FJsonValue> Items = MakeShared<FJsonValueObject>(JsonMap);
+		return Start > 0 || End < Num ? MakeSlice(Node, Items, Num, Start, End) : Items;
+	}
+
+	case EKind::Set:
+	{
+		FScriptSetHelper SetHelper(static_cast<FSetProperty*>(Node.Property), ValuePtr);
+		const FNode& Element = Node.Children[0];
+		const int32 Num = SetHelper.Num();
+
+		int32 Start = 0;
+		int32 End = Num;
+		if (ActiveLimits)
+		{
+			if (IsBeyondDepth())
+			{
+				return MakeStub(Node, Num);
+			}
+			GetSlice(Num, Start, End);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		for (int32 i = 0, Logical = 0; i < SetHelper.GetMaxIndex() && Logical < End; ++i)
+		{
+			if (!SetHelper.IsValidIndex(i) || Logical++ < Start)
+			{
+				continue;
+			}
+
+			if (ActiveLimits)
+			{
+				FString ElementStr;
+				Element.Property->ExportTextItem(ElementStr, SetHelper.GetElementPtr(i), nullptr, nullptr, PPF_None);
+				JsonArray.Add(DescendToJson(Element, SetHelper.GetElementPtr(i), TEXT("{") + ElementStr + TEXT("}")));
+			}
+			else
+			{
+				JsonArray.Add(NodeToJson(Element, SetHelper.GetElementPtr(i)));
+			}
+		}
+
+		TSharedPtr<FJsonValue> Items = MakeShared<FJsonValueArray>(JsonArray);
+		return Start > 0 || End < Num ? MakeSlice(Node, Items, Num, Start, End) : Items;
+	}
+
+	default:
+	{
+		// Fallback: export as text
+		FString ExportedText;
+		Node.Property->ExportTextItem(ExportedText, ValuePtr, nullptr, nullptr, PPF_None);
+		return MakeShared<FJsonValueString>(ExportedText);
+	}
+	}
+}
+
+bool FEpicUnrealMCPPropertyConverter::NodeFromJson(const FNode& Node, const TSharedPtr<FJsonValue>& JsonValue, void* ValuePtr)
+{
+	if (!JsonValue.IsValid())
+	{
+		return false;
+	}
+
+	switch (Node.Kind)
+	{
+	case EKind::Bool:
+	{
+		bool BoolVal;
+		if (JsonValue->TryGetBool(BoolVal))
+		{
+			static_cast<FBoolProperty*>(Node.Property)->SetPropertyValue(ValuePtr, BoolVal);
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::Byte:
+	case EKind::Int:
+	case EKind::Int64:
+	case EKind::Float:
+	case EKind::Double:
+	{
+		double NumVal;
+		if (JsonValue->TryGetNumber(NumVal))
+		{
+			WriteNumber(Node.Kind, ValuePtr, NumVal);
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::ByteEnum:
+	{
+		FString EnumStr;
+		if (JsonValue->TryGetString(EnumStr))
+		{
+			const int32 EnumValue = static_cast<FByteProperty*>(Node.Property)->Enum->GetIndexByNameString(EnumStr);
+			if (EnumValue != INDEX_NONE)
+			{
+				*static_cast<uint8*>(ValuePtr) = static_cast<uint8>(EnumValue);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	case EKind::Str:
+	case EKind::Name:
+	case EKind::Text:
+	{
+		FString StrVal;
+		if (!JsonValue->TryGetString(StrVal))
+		{
+			return false;
+		}
+		if (Node.Kind == EKind::Str)
+		{
+			*static_cast<FString*>(ValuePtr) = StrVal;
+		}
+		else if (Node.Kind == EKind::Name)
+		{
+			*static_cast<FName*>(ValuePtr) = FName(*StrVal);
+		}
+		else
+		{
+			*static_cast<FText*>(ValuePtr) = FText::FromString(StrVal);
+		}
+		return true;
+	}
+
+	case EKind::Vector:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr;
+		if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+		{
+			FVector* Vec = static_cast<FVector*>(ValuePtr);
+			Vec->X = (*Arr)[0]->AsNumber();
+			Vec->Y = (*Arr)[1]->AsNumber();
+			Vec->Z = (*Arr)[2]->AsNumber();
+			return true;
+		}
+		return false;
+	}
+	case EKind::Rotator:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr;
+		if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+		{
+			FRotator* Rot = static_cast<FRotator*>(ValuePtr);
+			Rot->Pitch = (*Arr)[0]->AsNumber();
+			Rot->Yaw = (*Arr)[1]->AsNumber();
+			Rot->Roll = (*Arr)[2]->AsNumber();
+			return true;
+		}
+		return false;
+	}
+	case EKind::Transform:
+	{
+		const TSharedPtr<FJsonObject>* TransObj;
+		if (!JsonValue->TryGetObject(TransObj))
+		{
+			return false;
+		}
+		FTransform* Trans = static_cast<FTransform*>(ValuePtr);
+
+		const TArray<TSharedPtr<FJsonValue>>* LocArr;
+		if ((*TransObj)->TryGetArrayField(TEXT("location"), LocArr) && LocArr->Num() >= 3)
+		{
+			Trans->SetLocation(FVector((*LocArr)[0]->AsNumber(), (*LocArr)[1]->AsNumber(), (*LocArr)[2]->AsNumber()));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* RotArr;
+		if ((*TransObj)->TryGetArrayField(TEXT("rotation"), RotArr) && RotArr->Num() >= 3)
+		{
+			Trans->SetRotation(FQuat(FRotator((*RotArr)[0]->AsNumber(), (*RotArr)[1]->AsNumber(), (*RotArr)[2]->AsNumber())));
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ScaleArr;
+		if ((*TransObj)->TryGetArrayField(TEXT("scale"), ScaleArr) && ScaleArr->Num() >= 3)
+		{
+			Trans->SetScale3D(FVector((*ScaleArr)[0]->AsNumber(), (*ScaleArr)[1]->AsNumber(), (*ScaleArr)[2]->AsNumber()));
+		}
+		return true;
+	}
+	case EKind::LinearColor:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr;
+		if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+		{
+			FLinearColor* Color = static_cast<FLinearColor*>(ValuePtr);
+			Color->R = (*Arr)[0]->AsNumber();
+			Color->G = (*Arr)[1]->AsNumber();
+			Color->B = (*Arr)[2]->AsNumber();
+			Color->A = Arr->Num() >= 4 ? (*Arr)[3]->AsNumber() : 1.0f;
+			return true;
+		}
+		return false;
+	}
+	case EKind::Color:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr;
+		if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 3)
+		{
+			FColor* Color = static_cast<FColor*>(ValuePtr);
+			Color->R = static_cast<uint8>((*Arr)[0]->AsNumber());
+			Color->G = static_cast<uint8>((*Arr)[1]->AsNumber());
+			Color->B = static_cast<uint8>((*Arr)[2]->AsNumber());
+			Color->A = Arr->Num() >= 4 ? static_cast<uint8>((*Arr)[3]->AsNumber()) : 255;
+			return true;
+		}
+		return false;
+	}
+	case EKind::Vector2D:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr;
+		if (JsonValue->TryGetArray(Arr) && Arr->Num() >= 2)
+		{
+			FVector2D* Vec = static_cast<FVector2D*>(ValuePtr);
+			Vec->X = (*Arr)[0]->AsNumber();
+			Vec->Y = (*Arr)[1]->AsNumber();
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::Struct:
+	{
+		// Generic struct - try JSON object first, then string fallback
+		const TSharedPtr<FJsonObject>* JsonObj;
+		if (JsonValue->TryGetObject(JsonObj))
+		{
+			PlanFromJson(*FindOrBuildPlan(Node.Struct), **JsonObj, ValuePtr, false, nullptr);
+			return true;
+		}
+		// String fallback for backwards compatibility
+		FString StrVal;
+		if (JsonValue->TryGetString(StrVal))
+		{
+			Node.Property->ImportText(*StrVal, ValuePtr, PPF_None, nullptr);
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::Enum:
+	{
+		FString EnumStr;
+		if (JsonValue->TryGetString(EnumStr))
+		{
+			FEnumProperty* EnumProp = static_cast<FEnumProperty*>(Node.Property);
+			const int64 EnumValue = EnumProp->GetEnum()->GetValueByNameString(EnumStr);
+			if (EnumValue != INDEX_NONE)
+			{
+				EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, EnumValue);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	case EKind::Object:
+	{
+		// Object reference (by path)
+		FString PathStr;
+		if (JsonValue->TryGetString(PathStr))
+		{
+			FObjectPropertyBase* ObjProp = static_cast<FObjectPropertyBase*>(Node.Property);
+			UObject* LoadedObj = StaticLoadObject(ObjProp->PropertyClass, nullptr, *PathStr);
+			ObjProp->SetObjectPropertyValue(ValuePtr, LoadedObj);
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::SoftObject:
+	{
+		// Stored as a path without loading, which is the point of a soft reference
+		if (JsonValue->IsNull())
+		{
+			static_cast<FSoftObjectPtr*>(ValuePtr)->Reset();
+			return true;
+		}
+		FString PathStr;
+		if (JsonValue->TryGetString(PathStr))
+		{
+			*static_cast<FSoftObjectPtr*>(ValuePtr) = FSoftObjectPath(PathStr);
+			return true;
+		}
+		return false;
+	}
+
+	case EKind::Array:
+	{
+		const TSharedPtr<FJsonObject>* PackedJson;
+		if (JsonValue->TryGetObject(PackedJson) && (*PackedJson)->HasField(TEXT("encoding")))
+		{
+			return UnpackArray(Node, **PackedJson, ValuePtr);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!JsonValue->TryGetArray(JsonArray))
+		{
+			return false;
+		}
+
+		FScriptArrayHelper ArrayHelper(static_cast<FArrayProperty*>(Node.Property), ValuePtr);
+		ArrayHelper.Resize(JsonArray->Num());
+		const FNode& Element = Node.Children[0];
+
+		if (IsNumeric(Element.Kind))
+		{
+			uint8* Data = JsonArray->Num() > 0 ? ArrayHelper.GetRawPtr(0) : nullptr;
+			const int32 Stride = Element.Property->ElementSize;
+			for (int32 i = 0; i < JsonArray->Num(); ++i)
+			{
+				double NumVal;
+				if (!(*JsonArray)[i]->TryGetNumber(NumVal))
+				{
+					return false;
+				}
+				WriteNumber(Element.Kind, Data + i * Stride, NumVal);
+			}
+			return true;
+		}
+
+		for (int32 i = 0; i < JsonArray->Num(); ++i)
+		{
+			if (!NodeFromJson(Element, (*JsonArray)[i], ArrayHelper.GetRawPtr(i)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	case EKind::Map:
+	{
+		const TSharedPtr<FJsonObject>* JsonObj;
+		if (!JsonValue->TryGetObject(JsonObj))
+		{
+			return false;
+		}
+
+		FScriptMapHelper MapHelper(static_cast<FMapProperty*>(Node.Property), ValuePtr);
+		MapHelper.EmptyValues();
+		const FNode& Key = Node.Children[0];
+		const FNode& Value = Node.Children[1];
+
+		for (const auto& Pair : (*JsonObj)->Values)
+		{
+			const int32 Index = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+
+			// Keys come from JSON object keys, so they are imported as text
+			Key.Property->ImportText(*Pair.Key, MapHelper.GetKeyPtr(Index), PPF_None, nullptr);
+
+			if (!NodeFromJson(Value, Pair.Value, MapHelper.GetValuePtr(Index)))
+			{
+				MapHelper.Rehash();
+				return false;
+			}
+		}
+
+		MapHelper.Rehash();
+		return true;
+	}
+
+	case EKind::Set:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!JsonValue->TryGetArray(JsonArray))
+		{
+			return false;
+		}
+
+		FScriptSetHelper SetHelper(static_cast<FSetProperty*>(Node.Property), ValuePtr);
+		SetHelper.EmptyElements();
+		const FNode& Element = Node.Children[0];
+
+		for (const TSharedPtr<FJsonValue>& ElementJson : *JsonArray)
+		{
+			const int32 Index = SetHelper.AddDefaultValue_Invalid_NeedsRehash();
+			if (!NodeFromJson(Element, ElementJson, SetHelper.GetElementPtr(Index)))
+			{
+				SetHelper.Rehash();
+				return false;
+			}
+		}
+
+		SetHelper.Rehash();
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,354 @@
+#include "Commands/EpicUnrealMCPPropertyResolver.h"
+#include "UObject/UnrealType.h"
+
+constexpr int32 FEpicUnrealMCPPropertyResolver::MaxCachedPaths;
+
+FEpicUnrealMCPPropertyResolver::FEpicUnrealMCPPropertyResolver(FEpicUnrealMCPCacheInvalidation& InInvalidation)
+	: Invalidation(InInvalidation)
+{
+	InvalidationHandle = Invalidation.Register(FSimpleDelegate::CreateRaw(this, &FEpicUnrealMCPPropertyResolver::Reset));
+}
+
+FEpicUnrealMCPPropertyResolver::~FEpicUnrealMCPPropertyResolver()
+{
+	Invalidation.Unregister(InvalidationHandle);
+}
+
+void FEpicUnrealMCPPropertyResolver::Reset()
+{
+	if (Cache.Num() > 0)
+	{
+		++Stats.Invalidations;
+	}
+	Cache.Reset();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPropertyResolver::GetStatsJson() const
+{
+	return Stats.ToJson(Cache.Num());
+}
+
+const FEpicUnrealMCPPropertyResolver::FCompiledPath& FEpicUnrealMCPPropertyResolver::FindOrCompile(UStruct* Owner, const FString& Path)
+{
+	const TPair<const UStruct*, FString> Key(Owner, Path);
+
+	// A stale owner means the struct was destroyed and another one now lives at the same address
+	FCompiledPath* Entry = Cache.Find(Key);
+	if (Entry && Entry->Owner.IsValid())
+	{
+		++Stats.Hits;
+		return *Entry;
+	}
+
+	++Stats.Misses;
+	FCompiledPath Compiled;
+	Compile(Owner, Path, Compiled);
+
+	// Clients can send any number of distinct bad paths, so only paths that resolve are kept
+	if (!Compiled.Error.IsEmpty())
+	{
+		Failed = MoveTemp(Compiled);
+		return Failed;
+	}
+
+	if (Cache.Num() >= MaxCachedPaths)
+	{
+		Reset();
+	}
+	return Cache.Add(Key, MoveTemp(Compiled));
+}
+
+void FEpicUnrealMCPPropertyResolver::Compile(UStruct* Owner, const FString& Path, FCompiledPath& Out)
+{
+	Out.Owner = Owner;
+
+	UStruct* Current = Owner;
+	FProperty* Value = nullptr;
+	int32 Offset = 0;
+	int32 Pos = 0;
+	const int32 Len = Path.Len();
+
+	// Consecutive member and fixed-size array accesses collapse into one offset step
+	auto FlushOffset = [&Out, &Offset]()
+	{
+		if (Offset != 0)
+		{
+			FStep& Step = Out.Steps.AddDefaulted_GetRef();
+			Step.Kind = EStepKind::Offset;
+			Step.Offset = Offset;
+			Offset = 0;
+		}
+	};
+
+	while (true)
+	{
+		const int32 NameStart = Pos;
+		while (Pos < Len && Path[Pos] != TEXT('.') && Path[Pos] != TEXT('[') && Path[Pos] != TEXT('{'))
+		{
+			++Pos;
+		}
+		const FString Name = Path.Mid(NameStart, Pos - NameStart).TrimStartAndEnd();
+		if (Name.IsEmpty())
+		{
+			Out.Error = FString::Printf(TEXT("Empty property name at position %d in '%s'"), NameStart, *Path);
+			return;
+		}
+
+		if (Value)
+		{
+			if (FStructProperty* StructProp = CastField<FStructProperty>(Value))
+			{
+				Current = StructProp->Struct;
+			}
+			else if (CastField<FObjectPropertyBase>(Value))
+			{
+				// The rest depends on the runtime class of the referenced object
+				FlushOffset();
+				Out.Leaf = Value;
+				Out.Remainder = Path.Mid(NameStart);
+				return;
+			}
+			else
+			{
+				Out.Error = FString::Printf(TEXT("'%s' is not a struct or object and has no member '%s'"), *Value->GetName(), *Name);
+				return;
+			}
+		}
+
+		FProperty* Property = FindFProperty<FProperty>(Current, *Name);
+		if (!Property)
+		{
+			Out.Error = FString::Printf(TEXT("Property not found: %s on %s"), *Name, *Current->GetName());
+			return;
+		}
+
+		if (!Out.MemberProperty)
+		{
+			Out.MemberProperty = Property;
+		}
+		Offset += Property->GetOffset_ForInternal();
+		Value = Property;
+		bool bIndexedFixedArray = false;
+
+		while (Pos < Len && (Path[Pos] == TEXT('[') || Path[Pos] == TEXT('{')))
+		{
+			const bool bIndex = Path[Pos] == TEXT('[');
+			const TCHAR Close = bIndex ? TEXT(']') : TEXT('}');
+			int32 End = Pos + 1;
+			while (End < Len && Path[End] != Close)
+			{
+				++End;
+			}
+			if (End >= Len)
+			{
+				Out.Error = FString::Printf(TEXT("Missing '%c' in '%s'"), Close, *Path);
+				return;
+			}
+			const FString Inner = Path.Mid(Pos + 1, End - Pos - 1);
+			Pos = End + 1;
+
+			if (bIndex)
+			{
+				if (Inner.IsEmpty() || !Inner.IsNumeric() || Inner.Contains(TEXT(".")) || Inner.StartsWith(TEXT("-")))
+				{
+					Out.Error = FString::Printf(TEXT("Invalid index '%s' for '%s'"), *Inner, *Value->GetName());
+					return;
+				}
+				const int32 Index = FCString::Atoi(*Inner);
+
+				if (Value->ArrayDim > 1 && !bIndexedFixedArray)
+				{
+					if (Index >= Value->ArrayDim)
+					{
+						Out.Error = FString::Printf(TEXT("Index %d out of range for '%s' (%d elements)"), Index, *Value->GetName(), Value->ArrayDim);
+						return;
+					}
+					Offset += Index * Value->ElementSize;
+					bIndexedFixedArray = true;
+				}
+				else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Value))
+				{
+					FlushOffset();
+					FStep& Step = Out.Steps.AddDefaulted_GetRef();
+					Step.Kind = EStepKind::ArrayElement;
+					Step.Property = ArrayProp;
+					Step.Index = Index;
+					Value = ArrayProp->Inner;
+				}
+				else
+				{
+					Out.Error = FString::Printf(TEXT("'%s' is not an array"), *Value->GetName());
+					return;
+				}
+			}
+			else if (FMapProperty* MapProp = CastField<FMapProperty>(Value))
+			{
+				FlushOffset();
+				FStep& Step = Out.Steps.AddDefaulted_GetRef();
+				Step.Kind = EStepKind::MapValue;
+				Step.Property = MapProp;
+				Step.Key = Inner;
+				Value = MapProp->ValueProp;
+			}
+			else if (FSetProperty* SetProp = CastField<FSetProperty>(Value))
+			{
+				FlushOffset();
+				FStep& Step = Out.Steps.AddDefaulted_GetRef();
+				Step.Kind = EStepKind::SetElement;
+				Step.Property = SetProp;
+				Step.Key = Inner;
+				Value = SetProp->ElementProp;
+			}
+			else
+			{
+				Out.Error = FString::Printf(TEXT("'%s' is not a map or set"), *Value->GetName());
+				return;
+			}
+		}
+
+		// An element of a dynamic array, map or set is a single value, and so is an indexed fixed-size array
+		Out.NumElements = bIndexedFixedArray ? 1 : Value->ArrayDim;
+
+		if (Pos >= Len)
+		{
+			break;
+		}
+		if (Path[Pos] != TEXT('.'))
+		{
+			Out.Error = FString::Printf(TEXT("Unexpected '%c' at position %d in '%s'"), Path[Pos], Pos, *Path);
+			return;
+		}
+		++Pos;
+	}
+
+	FlushOffset();
+	Out.Leaf = Value;
+}
+
+uint8* FEpicUnrealMCPPropertyResolver::FindKeyedElement(const FStep& Step, uint8* ContainerPtr)
+{
+	FMapProperty* MapProp = CastField<FMapProperty>(Step.Property);
+	FSetProperty* SetProp = CastField<FSetProperty>(Step.Property);
+	FProperty* KeyProp = MapProp ? MapProp->KeyProp : SetProp->ElementProp;
+
+	void* KeyPtr = FMemory::Malloc(KeyProp->GetSize(), KeyProp->GetMinAlignment());
+	KeyProp->InitializeValue(KeyPtr);
+
+	// Strings and names take the key text verbatim; ImportText would stop at the first space
+	bool bParsed = true;
+	if (FStrProperty* StrProp = CastField<FStrProperty>(KeyProp))
+	{
+		StrProp->SetPropertyValue(KeyPtr, Step.Key);
+	}
+	else if (FNameProperty* NameProp = CastField<FNameProperty>(KeyProp))
+	{
+		NameProp->SetPropertyValue(KeyPtr, FName(*Step.Key));
+	}
+	else
+	{
+		bParsed = KeyProp->ImportText(*Step.Key, KeyPtr, PPF_None, nullptr) != nullptr;
+	}
+
+	uint8* Element = nullptr;
+	if (bParsed && MapProp)
+	{
+		FScriptMapHelper Helper(MapProp, ContainerPtr);
+		const int32 Index = Helper.FindMapIndexWithKey(KeyPtr);
+		if (Index != INDEX_NONE)
+		{
+			Element = Helper.GetValuePtr(Index);
+		}
+	}
+	else if (bParsed)
+	{
+		FScriptSetHelper Helper(SetProp, ContainerPtr);
+		const int32 Index = Helper.FindElementIndex(KeyPtr);
+		if (Index != INDEX_NONE)
+		{
+			Element = Helper.GetElementPtr(Index);
+		}
+	}
+
+	KeyProp->DestroyValue(KeyPtr);
+	FMemory::Free(KeyPtr);
+	return Element;
+}
+
+bool FEpicUnrealMCPPropertyResolver::Resolve(UObject* Object, const FString& Path, FEpicUnrealMCPResolvedProperty& OutResolved, FString& OutError, bool bForWrite)
+{
+	if (!Object)
+	{
+		OutError = TEXT("No object to resolve the property path on");
+		return false;
+	}
+
+	Invalidation.BindDelegates();
+
+	UObject* Owner = Object;
+	FString Remaining = Path;
+	while (true)
+	{
+		const FCompiledPath& Compiled = FindOrCompile(Owner->GetClass(), Remaining);
+		if (!Compiled.Error.IsEmpty())
+		{
+			OutError = Compiled.Error;
+			return false;
+		}
+
+		uint8* Address = reinterpret_cast<uint8*>(Owner);
+		for (const FStep& Step : Compiled.Steps)
+		{
+			if (Step.Kind == EStepKind::Offset)
+			{
+				Address += Step.Offset;
+			}
+			else if (Step.Kind == EStepKind::ArrayElement)
+			{
+				FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Step.Property), Address);
+				if (!Helper.IsValidIndex(Step.Index))
+				{
+					OutError = FString::Printf(TEXT("Index %d out of range for '%s' (%d elements)"), Step.Index, *Step.Property->GetName(), Helper.Num());
+					return false;
+				}
+				Address = Helper.GetRawPtr(Step.Index);
+			}
+			else
+			{
+				Address = FindKeyedElement(Step, Address);
+				if (!Address)
+				{
+					OutError = FString::Printf(TEXT("No entry '%s' in '%s'"), *Step.Key, *Step.Property->GetName());
+					return false;
+				}
+			}
+		}
+
+		if (Compiled.Remainder.IsEmpty())
+		{
+			OutResolved.Property = Compiled.Leaf;
+			OutResolved.ValuePtr = Address;
+			OutResolved.Object = Owner;
+			OutResolved.MemberProperty = Compiled.MemberProperty;
+			OutResolved.NumElements = Compiled.NumElements;
+			return true;
+		}
+
+		UObject* Next = CastFieldChecked<FObjectPropertyBase>(Compiled.Leaf)->GetObjectPropertyValue(Address);
+		if (!Next)
+		{
+			OutError = FString::Printf(TEXT("'%s' is not set"), *Compiled.Leaf->GetName());
+			return false;
+		}
+
+		// Writes stay inside the object's own subobjects; anything else (a mesh, a material) is a shared asset
+		if (bForWrite && !Next->IsIn(Object))
+		{
+			OutError = FString::Printf(TEXT("Cannot write through '%s': path leaves the object (%s is not owned by %s)"),
+				*Compiled.Leaf->GetName(), *Next->GetName(), *Object->GetName());
+			return false;
+		}
+		Owner = Next;
+		// Copied, since the next lookup may grow the cache and move Compiled
+		Remaining = Compiled.Remainder;
+	}
+}
@@ -0,0 +1,278 @@
+#include "Commands/EpicUnrealMCPPropertyWatch.h"
+#include "Commands/EpicUnrealMCPPropertyResolver.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Crc.h"
+#include "UObject/UnrealType.h"
+
+FEpicUnrealMCPPropertyWatch::FEpicUnrealMCPPropertyWatch(FEpicUnrealMCPPropertyResolver& InResolver)
+	: Resolver(InResolver)
+	, NumWatches(0)
+	, NextId(1)
+	, Cursor(0)
+	, BudgetSeconds(0.0005)
+	, ChangedEvent(FPlatformProcess::GetSynchEventFromPool(true))
+	, NumFlagged(0)
+	, SweepStartTime(0.0)
+	, LastSweepSeconds(0.0)
+	, Checks(0)
+	, ChangesSeen(0)
+	, Sweeps(0)
+	, OverBudgetFrames(0)
+{
+}
+
+FEpicUnrealMCPPropertyWatch::~FEpicUnrealMCPPropertyWatch()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+	FPlatformProcess::ReturnSynchEventToPool(ChangedEvent);
+}
+
+bool FEpicUnrealMCPPropertyWatch::Hash(FEpicUnrealMCPPropertyWatchEntry& Entry, uint32& OutHash)
+{
+	FEpicUnrealMCPResolvedProperty Resolved;
+	FString PathError;
+	if (!Resolver.Resolve(Entry.Object.Get(), Entry.Path, Resolved, PathError))
+	{
+		OutHash = 0;
+		return false;
+	}
+
+	OutHash = HashValue(Resolved);
+	return true;
+}
+
+uint32 FEpicUnrealMCPPropertyWatch::HashValue(const FEpicUnrealMCPResolvedProperty& Resolved)
+{
+	FProperty* Property = Resolved.Property;
+	const int32 Count = Resolved.NumElements;
+
+	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		// Bitfield bools share their byte with other flags, so only the value itself counts
+		uint32 Bits = 0;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const void* ElementPtr = static_cast<const uint8*>(Resolved.ValuePtr) + Index * Property->ElementSize;
+			Bits = (Bits << 1) | (BoolProp->GetPropertyValue(ElementPtr) ? 1 : 0);
+		}
+		return FCrc::MemCrc32(&Bits, sizeof(Bits));
+	}
+
+	if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+	{
+		return FCrc::MemCrc32(Resolved.ValuePtr, Property->ElementSize * Count);
+	}
+
+	// Strings, containers and object references hold pointers, so hash what they export to instead
+	uint32 ValueHash = 0;
+	FString Text;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Text.Reset();
+		const void* ElementPtr = static_cast<const uint8*>(Resolved.ValuePtr) + Index * Property->ElementSize;
+		Property->ExportTextItem(Text, ElementPtr, nullptr, nullptr, PPF_None);
+		ValueHash = FCrc::StrCrc32(*Text, ValueHash);
+	}
+	return ValueHash;
+}
+
+void FEpicUnrealMCPPropertyWatch::Flag(FEpicUnrealMCPPropertyWatchEntry& Entry)
+{
+	++ChangesSeen;
+	Entry.LastChangeTime = FPlatformTime::Seconds();
+	if (Entry.Changes++ == 0 && NumFlagged++ == 0)
+	{
+		ChangedEvent->Trigger();
+	}
+}
+
+int32 FEpicUnrealMCPPropertyWatch::Watch(UObject* Object, const FString& Target, const FString& Path, FString& OutError)
+{
+	if (!Object)
+	{
+		OutError = TEXT("Invalid object");
+		return 0;
+	}
+
+	FEpicUnrealMCPPropertyWatchEntry Entry;
+	Entry.Object = Object;
+	Entry.Target = Target;
+	Entry.Path = Path;
+
+	// The first hash is the baseline, so registering never reports a change
+	FEpicUnrealMCPResolvedProperty Resolved;
+	if (!Resolver.Resolve(Object, Path, Resolved, OutError))
+	{
+		return 0;
+	}
+	Entry.Hash = HashValue(Resolved);
+	Entry.bResolved = true;
+	Entry.Id = NextId++;
+	Watches.Add(Entry);
+	NumWatches = Watches.Num();
+
+	if (!TickerHandle.IsValid())
+	{
+		SweepStartTime = FPlatformTime::Seconds();
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEpicUnrealMCPPropertyWatch::OnTick), 0.0f);
+	}
+	return Entry.Id;
+}
+
+bool FEpicUnrealMCPPropertyWatch::Unwatch(int32 Id)
+{
+	const int32 Index = Watches.IndexOfByPredicate([Id](const FEpicUnrealMCPPropertyWatchEntry& Entry)
+	{
+		return Entry.Id == Id;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (Watches[Index].Changes > 0 && --NumFlagged == 0)
+	{
+		ChangedEvent->Reset();
+	}
+	if (Index < Cursor)
+	{
+		--Cursor;
+	}
+	Watches.RemoveAt(Index);
+	NumWatches = Watches.Num();
+	return true;
+}
+
+int32 FEpicUnrealMCPPropertyWatch::UnwatchAll()
+{
+	const int32 Count = Watches.Num();
+	Watches.Reset();
+	NumWatches = 0;
+	Cursor = 0;
+	NumFlagged = 0;
+	ChangedEvent->Reset();
+	return Count;
+}
+
+void FEpicUnrealMCPPropertyWatch::SetBudget(double InBudgetSeconds)
+{
+	// Always check at least one watch per frame, and never take a noticeable part of it
+	BudgetSeconds = FMath::Clamp(InBudgetSeconds, 0.0, 0.005);
+}
+
+void FEpicUnrealMCPPropertyWatch::ConsumeChanges(TFunctionRef<void(const FEpicUnrealMCPPropertyWatchEntry&)> Visitor)
+{
+	bool bAnyRemoved = false;
+	for (FEpicUnrealMCPPropertyWatchEntry& Entry : Watches)
+	{
+		if (Entry.Changes > 0)
+		{
+			Visitor(Entry);
+			Entry.Changes = 0;
+		}
+		bAnyRemoved |= Entry.bRemoved;
+	}
+	NumFlagged = 0;
+	ChangedEvent->Reset();
+
+	// Removed watches stay until their removal has been reported once
+	if (bAnyRemoved)
+	{
+		Watches.RemoveAll([](const FEpicUnrealMCPPropertyWatchEntry& Entry)
+		{
+			return Entry.bRemoved;
+		});
+		NumWatches = Watches.Num();
+		Cursor = 0;
+	}
+}
+
+bool FEpicUnrealMCPPropertyWatch::WaitForChanges(uint32 TimeoutMs)
+{
+	if (NumWatches == 0)
+	{
+		return false;
+	}
+	return ChangedEvent->Wait(TimeoutMs);
+}
+
+bool FEpicUnrealMCPPropertyWatch::OnTick(float DeltaTime)
+{
+	if (Watches.Num() == 0)
+	{
+		// Returning false removes the ticker; the next Watch adds it again
+		TickerHandle.Reset();
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline = StartTime + BudgetSeconds;
+
+	// Round-robin from where the last frame stopped, each watch at most once per frame
+	int32 Checked = 0;
+	while (Checked < Watches.Num())
+	{
+		if (Cursor >= Watches.Num())
+		{
+			Cursor = 0;
+			++Sweeps;
+			LastSweepSeconds = StartTime - SweepStartTime;
+			SweepStartTime = StartTime;
+		}
+
+		FEpicUnrealMCPPropertyWatchEntry& Entry = Watches[Cursor++];
+		++Checked;
+		++Checks;
+
+		if (Entry.bRemoved)
+		{
+			continue;
+		}
+
+		// Destroyed objects (an actor deleted, or a PIE session ending) are reported once and then dropped
+		if (!Entry.Object.IsValid())
+		{
+			Entry.bRemoved = true;
+			Flag(Entry);
+			continue;
+		}
+
+		uint32 NewHash = 0;
+		const bool bResolved = Hash(Entry, NewHash);
+		if (bResolved != Entry.bResolved || NewHash != Entry.Hash)
+		{
+			Entry.bResolved = bResolved;
+			Entry.Hash = NewHash;
+			Flag(Entry);
+		}
+
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+
+	if (Checked < Watches.Num())
+	{
+		++OverBudgetFrames;
+	}
+	return true;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPropertyWatch::GetStatsJson() const
+{
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetNumberField(TEXT("watches"), Watches.Num());
+	Stats->SetNumberField(TEXT("pending"), NumFlagged);
+	Stats->SetNumberField(TEXT("budget_ms"), BudgetSeconds * 1000.0);
+	Stats->SetNumberField(TEXT("last_sweep_ms"), LastSweepSeconds * 1000.0);
+	Stats->SetNumberField(TEXT("sweeps"), Sweeps);
+	Stats->SetNumberField(TEXT("checks"), Checks);
+	Stats->SetNumberField(TEXT("changes"), ChangesSeen);
+	Stats->SetNumberField(TEXT("over_budget_frames"), OverBudgetFrames);
+	return Stats;
+}
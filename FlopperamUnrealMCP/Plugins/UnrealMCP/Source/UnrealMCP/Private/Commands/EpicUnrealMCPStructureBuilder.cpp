@@ -0,0 +1,290 @@
+#include "Commands/EpicUnrealMCPStructureBuilder.h"
+#include "Commands/EpicUnrealMCPJsonReaders.h"
+#include "Commands/EpicUnrealMCPPatternGenerator.h"
+
+using namespace EpicUnrealMCPJsonReaders;
+
+namespace
+{
+	int32 ReadCount(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, int32 Default)
+	{
+		return ClampCount(ReadNumber(Json, FieldName, Default), FEpicUnrealMCPStructureBuilder::MaxPieces);
+	}
+
+	FTransform ReadLocalTransform(const TSharedPtr<FJsonObject>& Json)
+	{
+		return FTransform(
+			ReadRotator(Json, TEXT("rotation")),
+			ReadVector(Json, TEXT("location"), FVector::ZeroVector),
+			ReadVector(Json, TEXT("scale"), FVector::OneVector));
+	}
+}
+
+// Out-of-line definitions; the limits are bound by reference in FMath::Min
+constexpr int32 FEpicUnrealMCPStructureBuilder::MaxPieces;
+constexpr int32 FEpicUnrealMCPStructureBuilder::MaxDepth;
+
+FEpicUnrealMCPStructureBuilder::FEpicUnrealMCPStructureBuilder()
+	: NumPieces(0)
+{
+}
+
+bool FEpicUnrealMCPStructureBuilder::Build(const TSharedPtr<FJsonObject>& StructureJson, FString& OutError)
+{
+	Primitives.Reset();
+	NumPieces = 0;
+	Defaults.Reset();
+
+	if (!StructureJson.IsValid())
+	{
+		OutError = TEXT("Structure spec is not an object");
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* DefaultsJson;
+	if (StructureJson->TryGetObjectField(TEXT("defaults"), DefaultsJson))
+	{
+		Defaults = *DefaultsJson;
+	}
+
+	// The structure's own location/rotation place the whole build; scale is not applied at the root
+	const FTransform Root(ReadRotator(StructureJson, TEXT("rotation")), ReadVector(StructureJson, TEXT("location"), FVector::ZeroVector));
+	return ExpandChildren(StructureJson, { Root }, 0, OutError);
+}
+
+bool FEpicUnrealMCPStructureBuilder::ExpandChildren(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, int32 Depth, FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Children;
+	const TSharedPtr<FJsonObject>* Child;
+	if (Element->TryGetArrayField(TEXT("elements"), Children))
+	{
+		for (const TSharedPtr<FJsonValue>& ChildValue : *Children)
+		{
+			if (!ChildValue.IsValid() || ChildValue->Type != EJson::Object)
+			{
+				OutError = TEXT("Structure elements must be objects");
+				return false;
+			}
+			if (!ExpandElement(ChildValue->AsObject(), Parents, Depth + 1, OutError))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	if (Element->TryGetObjectField(TEXT("element"), Child))
+	{
+		return ExpandElement(*Child, Parents, Depth + 1, OutError);
+	}
+
+	OutError = TEXT("Structure container has no 'elements' or 'element'");
+	return false;
+}
+
+bool FEpicUnrealMCPStructureBuilder::ExpandElement(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, int32 Depth, FString& OutError)
+{
+	if (Depth > MaxDepth)
+	{
+		OutError = FString::Printf(TEXT("Structure nesting exceeds %d levels"), MaxDepth);
+		return false;
+	}
+
+	FString Kind = TEXT("primitive");
+	Element->TryGetStringField(TEXT("kind"), Kind);
+
+	const FTransform Local = ReadLocalTransform(Element);
+
+	TArray<FTransform> LocalParents;
+	LocalParents.Reserve(Parents.Num());
+	for (const FTransform& Parent : Parents)
+	{
+		LocalParents.Add(Local * Parent);
+	}
+
+	if (Kind == TEXT("primitive"))
+	{
+		return EmitPrimitive(Element, MoveTemp(LocalParents), OutError);
+	}
+	if (Kind == TEXT("wall"))
+	{
+		return ExpandWall(Element, LocalParents, OutError);
+	}
+
+	// Every other kind is a pattern of offsets applied to each child
+	TArray<FTransform> Pattern;
+	if (Kind == TEXT("group"))
+	{
+		Pattern.Add(FTransform::Identity);
+	}
+	else if (Kind == TEXT("repeat"))
+	{
+		const int32 Count = FMath::Min(ReadCount(Element, TEXT("count"), 1), MaxPieces);
+		const FVector Offset = ReadVector(Element, TEXT("offset"), FVector::ZeroVector);
+		const FRotator RotationStep = ReadRotator(Element, TEXT("rotation_step"));
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Pattern.Add(FTransform(RotationStep * Index, Offset * Index));
+		}
+	}
+	else if (Kind == TEXT("grid"))
+	{
+		if (!FEpicUnrealMCPPatternGenerator::GenerateGrid(Element, Pattern, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Kind == TEXT("ring"))
+	{
+		if (!FEpicUnrealMCPPatternGenerator::GenerateRadial(Element, Pattern, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Kind == TEXT("stack") || Kind == TEXT("floors"))
+	{
+		const int32 Count = FMath::Min(ReadCount(Element, TEXT("count"), 1), MaxPieces);
+		const float Height = ReadNumber(Element, TEXT("height"), 300.0);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Pattern.Add(FTransform(FVector(0.0f, 0.0f, Height * Index)));
+		}
+	}
+	else
+	{
+		OutError = FString::Printf(TEXT("Unknown structure element kind: %s"), *Kind);
+		return false;
+	}
+
+	if (int64(LocalParents.Num()) * Pattern.Num() > MaxPieces)
+	{
+		OutError = FString::Printf(TEXT("Structure exceeds %d pieces"), MaxPieces);
+		return false;
+	}
+
+	TArray<FTransform> ChildParents;
+	ChildParents.Reserve(LocalParents.Num() * Pattern.Num());
+	for (const FTransform& Parent : LocalParents)
+	{
+		for (const FTransform& Offset : Pattern)
+		{
+			ChildParents.Add(Offset * Parent);
+		}
+	}
+
+	return ExpandChildren(Element, ChildParents, Depth, OutError);
+}
+
+bool FEpicUnrealMCPStructureBuilder::ExpandWall(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, FString& OutError)
+{
+	if (!Element->HasField(TEXT("end")))
+	{
+		OutError = TEXT("Wall element is missing 'end'");
+		return false;
+	}
+
+	const FVector Start = ReadVector(Element, TEXT("start"), FVector::ZeroVector);
+	const FVector End = ReadVector(Element, TEXT("end"), FVector::ZeroVector);
+	const float Height = ReadNumber(Element, TEXT("height"), 300.0);
+	const float Thickness = ReadNumber(Element, TEXT("thickness"), 100.0);
+	const float SegmentLength = FMath::Max(1.0, ReadNumber(Element, TEXT("segment_length"), 200.0));
+	const float SegmentHeight = FMath::Max(1.0, ReadNumber(Element, TEXT("segment_height"), SegmentLength));
+	// Edge length of the block mesh at scale 1; the engine's basic cube is 100 units
+	const float UnitSize = FMath::Max(1.0, ReadNumber(Element, TEXT("unit_size"), 100.0));
+
+	// Walls are vertical: Z comes from 'start' and only the XY direction is used
+	const FVector Direction = FVector(End.X - Start.X, End.Y - Start.Y, 0.0f);
+	const float Length = Direction.Size();
+	if (Length < KINDA_SMALL_NUMBER || Height <= 0.0f)
+	{
+		OutError = TEXT("Wall has zero length or height");
+		return false;
+	}
+
+	const int32 Columns = FMath::Max(1, ClampCount(Length / SegmentLength, MaxPieces));
+	const int32 Rows = FMath::Max(1, ClampCount(Height / SegmentHeight, MaxPieces));
+	if (int64(Rows) * Columns > MaxPieces)
+	{
+		OutError = FString::Printf(TEXT("Wall exceeds %d pieces"), MaxPieces);
+		return false;
+	}
+
+	const float BlockLength = Length / Columns;
+	const float BlockHeight = Height / Rows;
+	const FTransform WallFrame(FRotator(0.0f, Direction.Rotation().Yaw, 0.0f), Start);
+
+	TArray<FTransform> Blocks;
+	Blocks.Reserve(Rows * Columns + Columns);
+	for (int32 Row = 0; Row < Rows; ++Row)
+	{
+		for (int32 Column = 0; Column < Columns; ++Column)
+		{
+			Blocks.Add(FTransform(
+				FRotator::ZeroRotator,
+				FVector((Column + 0.5f) * BlockLength, 0.0f, (Row + 0.5f) * BlockHeight),
+				FVector(BlockLength, Thickness, BlockHeight) / UnitSize) * WallFrame);
+		}
+	}
+
+	bool bBattlements = false;
+	Element->TryGetBoolField(TEXT("battlements"), bBattlements);
+	if (bBattlements)
+	{
+		const float MerlonHeight = ReadNumber(Element, TEXT("merlon_height"), BlockHeight * 0.5f);
+		for (int32 Column = 0; Column < Columns; Column += 2)
+		{
+			Blocks.Add(FTransform(
+				FRotator::ZeroRotator,
+				FVector((Column + 0.5f) * BlockLength, 0.0f, Height + MerlonHeight * 0.5f),
+				FVector(BlockLength, Thickness, MerlonHeight) / UnitSize) * WallFrame);
+		}
+	}
+
+	if (int64(Parents.Num()) * Blocks.Num() > MaxPieces)
+	{
+		OutError = FString::Printf(TEXT("Structure exceeds %d pieces"), MaxPieces);
+		return false;
+	}
+
+	TArray<FTransform> WorldTransforms;
+	WorldTransforms.Reserve(Parents.Num() * Blocks.Num());
+	for (const FTransform& Parent : Parents)
+	{
+		for (const FTransform& Block : Blocks)
+		{
+			WorldTransforms.Add(Block * Parent);
+		}
+	}
+
+	return EmitPrimitive(Element, MoveTemp(WorldTransforms), OutError);
+}
+
+bool FEpicUnrealMCPStructureBuilder::EmitPrimitive(const TSharedPtr<FJsonObject>& Element, TArray<FTransform>&& WorldTransforms, FString& OutError)
+{
+	NumPieces += WorldTransforms.Num();
+	if (NumPieces > MaxPieces)
+	{
+		OutError = FString::Printf(TEXT("Structure exceeds %d pieces"), MaxPieces);
+		return false;
+	}
+
+	FEpicUnrealMCPStructurePrimitive& Primitive = Primitives.AddDefaulted_GetRef();
+	Primitive.Spec = MergeWithDefaults(Element);
+	Primitive.Transforms = MoveTemp(WorldTransforms);
+	return true;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPStructureBuilder::MergeWithDefaults(const TSharedPtr<FJsonObject>& Element) const
+{
+	if (!Defaults.IsValid())
+	{
+		return Element;
+	}
+
+	TSharedPtr<FJsonObject> Merged = MakeShared<FJsonObject>();
+	Merged->Values = Defaults->Values;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Element->Values)
+	{
+		Merged->Values.Add(Field.Key, Field.Value);
+	}
+	return Merged;
+}
@@ -0,0 +1,555 @@
+#include "Commands/EpicUnrealMCPWorldSnapshot.h"
+#include "Commands/EpicUnrealMCPActorFilter.h"
+#include "Commands/EpicUnrealMCPActorIndex.h"
+#include "ActorEditorUtils.h"
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "Hash/CityHash.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	int64 Quantize(float Value, double Scale)
+	{
+		return int64(FMath::RoundToDouble(double(Value) * Scale));
+	}
+
+	// Centimetre location, 1e-4 rotation and scale steps; q and -q are the same rotation
+	void QuantizeTransform(const FTransform& Transform, int64 (&OutValues)[10])
+	{
+		const FVector Location = Transform.GetLocation();
+		const FVector Scale = Transform.GetScale3D();
+		FQuat Rotation = Transform.GetRotation().GetNormalized();
+		if (Rotation.W < 0.0f)
+		{
+			Rotation = Rotation * -1.0f;
+		}
+
+		OutValues[0] = Quantize(Location.X, 100.0);
+		OutValues[1] = Quantize(Location.Y, 100.0);
+		OutValues[2] = Quantize(Location.Z, 100.0);
+		OutValues[3] = Quantize(Rotation.X, 10000.0);
+		OutValues[4] = Quantize(Rotation.Y, 10000.0);
+		OutValues[5] = Quantize(Rotation.Z, 10000.0);
+		OutValues[6] = Quantize(Rotation.W, 10000.0);
+		OutValues[7] = Quantize(Scale.X, 10000.0);
+		OutValues[8] = Quantize(Scale.Y, 10000.0);
+		OutValues[9] = Quantize(Scale.Z, 10000.0);
+	}
+
+	void HashTransform(FArchive& Ar, const FTransform& Transform)
+	{
+		int64 Values[10];
+		QuantizeTransform(Transform, Values);
+		Ar.Serialize(Values, sizeof(Values));
+	}
+
+	// Same test the hash applies, so a hash mismatch always shows up as some difference
+	bool SameTransform(const FTransform& A, const FTransform& B)
+	{
+		int64 ValuesA[10];
+		int64 ValuesB[10];
+		QuantizeTransform(A, ValuesA);
+		QuantizeTransform(B, ValuesB);
+		return FMemory::Memcmp(ValuesA, ValuesB, sizeof(ValuesA)) == 0;
+	}
+
+	bool SameInstances(const FEpicUnrealMCPInstanceRecord& A, const FEpicUnrealMCPInstanceRecord& B)
+	{
+		if (A.StaticMesh != B.StaticMesh || A.Materials != B.Materials || A.Instances.Num() != B.Instances.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < A.Instances.Num(); ++Index)
+		{
+			if (!SameTransform(A.Instances[Index], B.Instances[Index]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Names of everything but the transform that differs between two records of the same actor
+	void CollectChangedFields(const FEpicUnrealMCPActorRecord& Before, const FEpicUnrealMCPActorRecord& After, TArray<FString>& OutFields)
+	{
+		if (Before.ClassPath != After.ClassPath)
+		{
+			OutFields.Add(TEXT("class"));
+		}
+		if (Before.Label != After.Label)
+		{
+			OutFields.Add(TEXT("label"));
+		}
+		if (Before.FolderPath != After.FolderPath)
+		{
+			OutFields.Add(TEXT("folder"));
+		}
+		if (Before.StaticMesh != After.StaticMesh)
+		{
+			OutFields.Add(TEXT("static_mesh"));
+		}
+		if (Before.Materials != After.Materials)
+		{
+			OutFields.Add(TEXT("materials"));
+		}
+
+		for (int32 Index = 0; Index < Before.PropertyNames.Num(); ++Index)
+		{
+			const int32 AfterIndex = After.PropertyNames.IndexOfByKey(Before.PropertyNames[Index]);
+			if (AfterIndex == INDEX_NONE || After.PropertyHashes[AfterIndex] != Before.PropertyHashes[Index])
+			{
+				OutFields.Add(Before.PropertyNames[Index].ToString());
+			}
+		}
+		for (const FName& PropertyName : After.PropertyNames)
+		{
+			if (!Before.PropertyNames.Contains(PropertyName))
+			{
+				OutFields.Add(PropertyName.ToString());
+			}
+		}
+
+		for (const FEpicUnrealMCPInstanceRecord& Group : Before.InstanceGroups)
+		{
+			const FEpicUnrealMCPInstanceRecord* AfterGroup = After.InstanceGroups.FindByPredicate([&Group](const FEpicUnrealMCPInstanceRecord& Candidate)
+			{
+				return Candidate.Component == Group.Component;
+			});
+			if (!AfterGroup || !SameInstances(Group, *AfterGroup))
+			{
+				OutFields.Add(Group.Component.ToString());
+			}
+		}
+		for (const FEpicUnrealMCPInstanceRecord& Group : After.InstanceGroups)
+		{
+			const bool bInBefore = Before.InstanceGroups.ContainsByPredicate([&Group](const FEpicUnrealMCPInstanceRecord& Candidate)
+			{
+				return Candidate.Component == Group.Component;
+			});
+			if (!bInBefore)
+			{
+				OutFields.Add(Group.Component.ToString());
+			}
+		}
+	}
+
+	FString GetPathOrEmpty(const UObject* Object)
+	{
+		return Object ? Object->GetPathName() : FString();
+	}
+
+	TArray<FString> GetOverrideMaterialPaths(const UStaticMeshComponent* Component)
+	{
+		TArray<FString> Paths;
+		Paths.Reserve(Component->OverrideMaterials.Num());
+		for (const UMaterialInterface* Material : Component->OverrideMaterials)
+		{
+			Paths.Add(GetPathOrEmpty(Material));
+		}
+		return Paths;
+	}
+
+	// FName indices change between editor sessions, so structs holding names cannot be hashed by their bytes
+	bool HasStableBytes(const UStruct* Struct)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			if (It->IsA<FNameProperty>())
+			{
+				return false;
+			}
+			const FStructProperty* InnerStruct = CastField<FStructProperty>(*It);
+			if (InnerStruct && !HasStableBytes(InnerStruct->Struct))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Plain values hash their bytes and object references their path; only the rest pay for export text.
+	// Snapshot files are compared in later sessions, so nothing session-specific may reach the hash.
+	uint32 HashPropertyValue(FProperty* Property, const void* ValuePtr, const void* DefaultPtr, AActor* Actor)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			// Bitfield bools share their byte with other flags
+			const uint32 Bit = BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+			return FCrc::MemCrc32(&Bit, sizeof(Bit));
+		}
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+		{
+			return FCrc::StrCrc32(*NameProperty->GetPropertyValue(ValuePtr).ToString());
+		}
+		if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+		{
+			return FCrc::StrCrc32(*GetPathOrEmpty(ObjectProperty->GetObjectPropertyValue(ValuePtr)));
+		}
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && (!StructProperty || HasStableBytes(StructProperty->Struct)))
+		{
+			return FCrc::MemCrc32(ValuePtr, Property->ElementSize);
+		}
+
+		FString ValueText;
+		Property->ExportTextItem(ValueText, ValuePtr, DefaultPtr, Actor, PPF_None);
+		return FCrc::StrCrc32(*ValueText);
+	}
+
+	// Editable, non-transient actor properties whose value differs from the class defaults
+	template <typename FuncType>
+	void ForEachNonDefaultProperty(AActor* Actor, FuncType&& Func)
+	{
+		const UObject* Defaults = Actor->GetClass()->GetDefaultObject();
+		const uint64 SkipFlags = CPF_Transient | CPF_DuplicateTransient | CPF_EditConst | CPF_Deprecated |
+			CPF_InstancedReference | CPF_ContainsInstancedReference;
+
+		for (TFieldIterator<FProperty> It(Actor->GetClass()); It; ++It)
+		{
+			FProperty* Property = *It;
+			if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(SkipFlags) || Property->ArrayDim != 1)
+			{
+				continue;
+			}
+
+			// References to the actor's own subobjects would not survive a respawn
+			if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				UObject* Value = ObjectProperty->GetObjectPropertyValue_InContainer(Actor);
+				if (Value && Value->IsIn(Actor))
+				{
+					continue;
+				}
+			}
+
+			if (Property->Identical_InContainer(Actor, Defaults))
+			{
+				continue;
+			}
+
+			Func(Property, Property->ContainerPtrToValuePtr<void>(Actor), Property->ContainerPtrToValuePtr<void>(Defaults));
+		}
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FEpicUnrealMCPInstanceRecord& Record)
+{
+	Ar << Record.Component;
+	Ar << Record.StaticMesh;
+	Ar << Record.Materials;
+	Ar << Record.Instances;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FEpicUnrealMCPActorRecord& Record)
+{
+	Ar << Record.Name;
+	Ar << Record.Level;
+	Ar << Record.ClassPath;
+	Ar << Record.Label;
+	Ar << Record.FolderPath;
+	Ar << Record.Transform;
+	Ar << Record.StaticMesh;
+	Ar << Record.Materials;
+	Ar << Record.PropertyNames;
+	Ar << Record.PropertyHashes;
+	Ar << Record.PropertyValues;
+	Ar << Record.InstanceGroups;
+	Ar << Record.Hash;
+	return Ar;
+}
+
+void FEpicUnrealMCPActorRecord::Capture(AActor* Actor, bool bExportValues)
+{
+	ReadActor(Actor, bExportValues);
+	Hash = ComputeHash();
+}
+
+void FEpicUnrealMCPActorRecord::ReadActor(AActor* Actor, bool bExportValues)
+{
+	Name = Actor->GetFName();
+	Level = FEpicUnrealMCPActorIndex::GetLevelName(Actor);
+	ClassPath = Actor->GetClass()->GetPathName();
+	Label = Actor->GetActorLabel();
+	FolderPath = Actor->GetFolderPath();
+
+	// Actors of a map loaded for diffing are not registered, so their world transforms were never computed;
+	// compose them from the relative transforms up the attachment chain instead
+	USceneComponent* Root = Actor->GetRootComponent();
+	if (Root && !Root->IsRegistered())
+	{
+		Transform = Root->GetRelativeTransform();
+		for (USceneComponent* Parent = Root->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+		{
+			Transform = Transform * Parent->GetRelativeTransform();
+		}
+	}
+	else
+	{
+		Transform = Actor->GetActorTransform();
+	}
+
+	if (UStaticMeshComponent* MeshComponent = GetMeshComponent(Actor))
+	{
+		StaticMesh = GetPathOrEmpty(MeshComponent->GetStaticMesh());
+		Materials = GetOverrideMaterialPaths(MeshComponent);
+	}
+
+	ForEachNonDefaultProperty(Actor, [this, Actor, bExportValues](FProperty* Property, const void* ValuePtr, const void* DefaultPtr)
+	{
+		PropertyNames.Add(Property->GetFName());
+		PropertyHashes.Add(HashPropertyValue(Property, ValuePtr, DefaultPtr, Actor));
+		if (bExportValues)
+		{
+			FString& ValueText = PropertyValues.AddDefaulted_GetRef();
+			Property->ExportTextItem(ValueText, ValuePtr, DefaultPtr, Actor, PPF_None);
+		}
+	});
+
+	TInlineComponentArray<UInstancedStaticMeshComponent*> InstanceComponents(Actor);
+	for (UInstancedStaticMeshComponent* Component : InstanceComponents)
+	{
+		FEpicUnrealMCPInstanceRecord& Group = InstanceGroups.AddDefaulted_GetRef();
+		Group.Component = Component->GetFName();
+		Group.StaticMesh = GetPathOrEmpty(Component->GetStaticMesh());
+		Group.Materials = GetOverrideMaterialPaths(Component);
+
+		const int32 NumInstances = Component->GetInstanceCount();
+		Group.Instances.SetNum(NumInstances);
+		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+		{
+			Component->GetInstanceTransform(InstanceIndex, Group.Instances[InstanceIndex], false);
+		}
+	}
+
+	// Component order is not stable across respawns
+	InstanceGroups.Sort([](const FEpicUnrealMCPInstanceRecord& A, const FEpicUnrealMCPInstanceRecord& B)
+	{
+		return A.Component.LexicalLess(B.Component);
+	});
+}
+
+void FEpicUnrealMCPActorRecord::CaptureAll(const TArray<AActor*>& Actors, TArray<FEpicUnrealMCPActorRecord>& OutRecords, bool bExportValues)
+{
+	OutRecords.Reset();
+	OutRecords.SetNum(Actors.Num());
+
+	// GetActorLabel can write the label and ExportTextItem runs arbitrary exporters, so UObjects are only touched here
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
+	{
+		OutRecords[Index].ReadActor(Actors[Index], bExportValues);
+	}
+
+	// Hashing only reads the plain records
+	ParallelFor(OutRecords.Num(), [&OutRecords](int32 Index)
+	{
+		OutRecords[Index].Hash = OutRecords[Index].ComputeHash();
+	});
+}
+
+void FEpicUnrealMCPActorRecord::ExportNonDefaultProperties(AActor* Actor, TArray<FName>& OutNames, TArray<FString>& OutValues)
+{
+	ForEachNonDefaultProperty(Actor, [Actor, &OutNames, &OutValues](FProperty* Property, const void* ValuePtr, const void* DefaultPtr)
+	{
+		FString ValueText;
+		Property->ExportTextItem(ValueText, ValuePtr, DefaultPtr, Actor, PPF_None);
+		OutNames.Add(Property->GetFName());
+		OutValues.Add(MoveTemp(ValueText));
+	});
+}
+
+UStaticMeshComponent* FEpicUnrealMCPActorRecord::GetMeshComponent(AActor* Actor)
+{
+	UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Actor->GetRootComponent());
+	return MeshComponent && !MeshComponent->IsA<UInstancedStaticMeshComponent>() ? MeshComponent : nullptr;
+}
+
+uint64 FEpicUnrealMCPActorRecord::ComputeHash()
+{
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+
+	Writer << ClassPath << Label << FolderPath << StaticMesh << Materials << PropertyNames << PropertyHashes;
+	HashTransform(Writer, Transform);
+
+	for (FEpicUnrealMCPInstanceRecord& Group : InstanceGroups)
+	{
+		int32 NumInstances = Group.Instances.Num();
+		Writer << Group.Component << Group.StaticMesh << Group.Materials << NumInstances;
+		for (const FTransform& Instance : Group.Instances)
+		{
+			HashTransform(Writer, Instance);
+		}
+	}
+
+	return CityHash64(reinterpret_cast<const char*>(Buffer.GetData()), Buffer.Num());
+}
+
+constexpr uint32 FEpicUnrealMCPWorldSnapshot::FileMagic;
+constexpr int32 FEpicUnrealMCPWorldSnapshot::FileVersion;
+
+bool FEpicUnrealMCPWorldSnapshot::CanCapture(const AActor* Actor)
+{
+	return Actor && !Actor->IsA<AWorldSettings>() && !FActorEditorUtils::IsABuilderBrush(Actor) && !Actor->HasAnyFlags(RF_Transient);
+}
+
+FString FEpicUnrealMCPWorldSnapshot::GetFilePath(const FString& SnapshotName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("MCPSnapshots") / FPaths::MakeValidFileName(SnapshotName) + TEXT(".mcpsnap");
+}
+
+void FEpicUnrealMCPWorldSnapshot::CaptureActors(const TArray<AActor*>& InActors)
+{
+	FEpicUnrealMCPActorRecord::CaptureAll(InActors, Actors);
+	BuildIndex();
+}
+
+bool FEpicUnrealMCPWorldSnapshot::CompileFilter(FEpicUnrealMCPActorFilter& OutFilter) const
+{
+	if (FilterJson.IsEmpty())
+	{
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> ScopeJson;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FilterJson);
+	FString FilterError;
+	return FJsonSerializer::Deserialize(Reader, ScopeJson) && ScopeJson.IsValid() && OutFilter.Compile(ScopeJson, FilterError);
+}
+
+const FEpicUnrealMCPActorRecord* FEpicUnrealMCPWorldSnapshot::FindRecord(FName LevelName, FName ActorName) const
+{
+	const int32* Index = RecordIndex.Find(TPair<FName, FName>(LevelName, ActorName));
+	return Index ? &Actors[*Index] : nullptr;
+}
+
+void FEpicUnrealMCPWorldSnapshot::SaveToBytes(TArray<uint8>& OutBytes)
+{
+	FMemoryWriter Writer(OutBytes, true);
+	Serialize(Writer);
+}
+
+bool FEpicUnrealMCPWorldSnapshot::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	FMemoryReader Reader(Bytes, true);
+	Serialize(Reader);
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	BuildIndex();
+	return true;
+}
+
+void FEpicUnrealMCPWorldSnapshot::BuildIndex()
+{
+	RecordIndex.Reset();
+	RecordIndex.Reserve(Actors.Num());
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
+	{
+		RecordIndex.Add(Actors[Index].GetKey(), Index);
+	}
+}
+
+void FEpicUnrealMCPWorldSnapshot::Serialize(FArchive& Ar)
+{
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Ar.IsLoading() && (Magic != FileMagic || Version != FileVersion))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << Name;
+	Ar << MapName;
+	Ar << FilterJson;
+	Ar << Created;
+	Ar << Actors;
+}
+
+void FEpicUnrealMCPWorldDiff::Compute(const TArray<FEpicUnrealMCPActorRecord>& Base, const TArray<FEpicUnrealMCPActorRecord>& Target)
+{
+	TMap<TPair<FName, FName>, int32> BaseIndex;
+	BaseIndex.Reserve(Base.Num());
+	for (int32 Index = 0; Index < Base.Num(); ++Index)
+	{
+		BaseIndex.Add(Base[Index].GetKey(), Index);
+	}
+
+	// Workers only read the records and the lookup and write their own slot
+	TArray<int32> BaseMatch;
+	TArray<bool> bMoved;
+	TArray<TArray<FString>> Fields;
+	BaseMatch.Init(INDEX_NONE, Target.Num());
+	bMoved.Init(false, Target.Num());
+	Fields.SetNum(Target.Num());
+
+	ParallelFor(Target.Num(), [&](int32 Index)
+	{
+		const int32* Match = BaseIndex.Find(Target[Index].GetKey());
+		if (!Match)
+		{
+			return;
+		}
+		BaseMatch[Index] = *Match;
+
+		const FEpicUnrealMCPActorRecord& Before = Base[*Match];
+		const FEpicUnrealMCPActorRecord& After = Target[Index];
+		if (Before.Hash != After.Hash)
+		{
+			bMoved[Index] = !SameTransform(Before.Transform, After.Transform);
+			CollectChangedFields(Before, After, Fields[Index]);
+		}
+	});
+
+	TBitArray<> BaseSeen(false, Base.Num());
+	for (int32 Index = 0; Index < Target.Num(); ++Index)
+	{
+		const int32 Match = BaseMatch[Index];
+		if (Match == INDEX_NONE)
+		{
+			Added.Add(Index);
+			continue;
+		}
+		BaseSeen[Match] = true;
+
+		if (Base[Match].Hash == Target[Index].Hash)
+		{
+			++NumUnchanged;
+			continue;
+		}
+		if (bMoved[Index])
+		{
+			Moved.Emplace(Match, Index);
+		}
+		if (Fields[Index].Num() > 0)
+		{
+			Changed.Emplace(Match, Index);
+			ChangedFields.Add(MoveTemp(Fields[Index]));
+		}
+	}
+
+	for (int32 Index = 0; Index < Base.Num(); ++Index)
+	{
+		if (!BaseSeen[Index])
+		{
+			Removed.Add(Index);
+		}
+	}
+}
@@ -200,6 +200,17 @@ FString FEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
 {
 	UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPBridge: Executing command: %s"), *CommandType);
 
+	// Long poll: wait here on the server thread so a client waiting for changes costs no game thread round trips
+	if (CommandType == TEXT("poll_property_changes"))
+	{
+		double WaitMs = 0.0;
+		if (Params.IsValid() && Params->TryGetNumberField(TEXT("wait_ms"), WaitMs) && WaitMs > 0.0)
+		{
+			// Stays well inside the client's socket timeout
+			EditorCommands->WaitForPropertyChanges(static_cast<uint32>(FMath::Min(WaitMs, 5000.0)));
+		}
+	}
+
 	// Create a promise to wait for the result
 	TPromise<FString> Promise;
 	TFuture<FString> Future = Promise.GetFuture();
@@ -233,6 +244,8 @@ FString FEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
 					 CommandType == TEXT("editor_validate_assets") ||
 					 CommandType == TEXT("editor_take_screenshot") ||
 					 CommandType == TEXT("editor_move_camera") ||
+					 CommandType == TEXT("get_server_stats") ||
+					 CommandType == TEXT("reload_notify_policy") ||
 					 // Widget Blueprint commands
 					 CommandType == TEXT("create_widget_blueprint") ||
 					 CommandType == TEXT("add_widget_to_blueprint") ||
@@ -264,7 +277,44 @@ FString FEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
 					 CommandType == TEXT("set_data_table_row_field") ||
 					 CommandType == TEXT("add_data_table_row") ||
 					 CommandType == TEXT("delete_data_table_row") ||
-					 CommandType == TEXT("set_data_table_array_element"))
+					 CommandType == TEXT("set_data_table_array_element") ||
+					 // Bulk Actor commands
+					 CommandType == TEXT("get_actor_transforms_bulk") ||
+					 CommandType == TEXT("spawn_actors") ||
+					 CommandType == TEXT("convert_to_instances") ||
+					 CommandType == TEXT("set_actor_transforms") ||
+					 CommandType == TEXT("delete_actors") ||
+					 CommandType == TEXT("set_actors_folder") ||
+					 // Async asset loading commands
+					 CommandType == TEXT("preload_assets") ||
+					 CommandType == TEXT("get_async_job") ||
+					 // Structure builder commands
+					 CommandType == TEXT("build_structure") ||
+					 // Prefab commands
+					 CommandType == TEXT("capture_prefab") ||
+					 CommandType == TEXT("stamp_prefab") ||
+					 // Pattern spawn commands
+					 CommandType == TEXT("spawn_pattern") ||
+					 // Bulk edit commands
+					 CommandType == TEXT("begin_bulk_edit") ||
+					 CommandType == TEXT("end_bulk_edit") ||
+					 // World snapshot commands
+					 CommandType == TEXT("snapshot_world") ||
+					 CommandType == TEXT("restore_world") ||
+					 CommandType == TEXT("diff_world") ||
+					 // Multi-object property commands
+					 CommandType == TEXT("get_properties") ||
+					 CommandType == TEXT("set_properties") ||
+					 CommandType == TEXT("dump_overrides") ||
+					 // Component commands
+					 CommandType == TEXT("list_components") ||
+					 CommandType == TEXT("get_component_property") ||
+					 CommandType == TEXT("set_component_property") ||
+					 CommandType == TEXT("set_component_transform") ||
+					 // Property watch commands
+					 CommandType == TEXT("watch_properties") ||
+					 CommandType == TEXT("poll_property_changes") ||
+					 CommandType == TEXT("unwatch_properties"))
 			{
 				ResultJson = EditorCommands->HandleCommand(CommandType, Params);
 			}
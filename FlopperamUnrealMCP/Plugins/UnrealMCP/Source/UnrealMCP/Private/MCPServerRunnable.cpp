@@ -11,6 +11,76 @@
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTime.h"
 
+namespace
+{
+    // Upper bound on a single buffered command; protects against a client that never closes its JSON
+    constexpr int32 MaxCommandBytes = 64 * 1024 * 1024;
+
+    /**
+     * Incremental scanner that detects when a streamed JSON document is complete.
+     * Bulk commands easily exceed one Recv() chunk, so bytes are accumulated until
+     * the top-level object closes. State carries over between chunks so each byte
+     * is only inspected once.
+     */
+    struct FJsonDocumentScanner
+    {
+        int32 Depth = 0;
+        int32 ScannedBytes = 0;
+        bool bInString = false;
+        bool bEscaped = false;
+        bool bStarted = false;
+
+        void Reset()
+        {
+            *this = FJsonDocumentScanner();
+        }
+
+        bool Scan(const TArray<uint8>& Bytes)
+        {
+            for (; ScannedBytes < Bytes.Num(); ++ScannedBytes)
+            {
+                const uint8 Byte = Bytes[ScannedBytes];
+                if (bInString)
+                {
+                    if (bEscaped)
+                    {
+                        bEscaped = false;
+                    }
+                    else if (Byte == '\\')
+                    {
+                        bEscaped = true;
+                    }
+                    else if (Byte == '"')
+                    {
+                        bInString = false;
+                    }
+                    continue;
+                }
+
+                if (Byte == '"')
+                {
+                    bInString = true;
+                }
+                else if (Byte == '{' || Byte == '[')
+                {
+                    ++Depth;
+                    bStarted = true;
+                }
+                else if (Byte == '}' || Byte == ']')
+                {
+                    --Depth;
+                    if (bStarted && Depth <= 0)
+                    {
+                        ++ScannedBytes;
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+}
+
 FMCPServerRunnable::FMCPServerRunnable(FEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
@@ -54,10 +124,12 @@ uint32 FMCPServerRunnable::Run()
                 ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
                 
                 uint8 Buffer[8192];
+                TArray<uint8> MessageBytes;
+                FJsonDocumentScanner Scanner;
                 while (bRunning)
                 {
                     int32 BytesRead = 0;
-                    if (ClientSocket->Recv(Buffer, sizeof(Buffer) - 1, BytesRead))
+                    if (ClientSocket->Recv(Buffer, sizeof(Buffer), BytesRead))
                     {
                         if (BytesRead == 0)
                         {
@@ -65,76 +137,93 @@ uint32 FMCPServerRunnable::Run()
                             break;
                         }
 
-                        // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
+                        // Accumulate until the JSON document is complete (large bulk commands span many chunks).
+                        // One chunk can also end one command and hold the next, so every complete document is answered before the next Recv.
+                        MessageBytes.Append(Buffer, BytesRead);
+                        while (Scanner.Scan(MessageBytes))
+                        {
+                            // Convert received data to string
+                            FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(MessageBytes.GetData()), Scanner.ScannedBytes);
+                            FString ReceivedText(Converter.Length(), Converter.Get());
+                            MessageBytes.RemoveAt(0, Scanner.ScannedBytes, false);
+                            Scanner.Reset();
+
+                            FString LogReceived = ReceivedText.Len() > 500 ? ReceivedText.Left(500) + TEXT("...") : ReceivedText;
+                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received (%d chars): %s"), ReceivedText.Len(), *LogReceived);
 
-                        // Parse JSON
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
+                            // Parse JSON
+                            TSharedPtr<FJsonObject> JsonObject;
+                            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
                         
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
-                        {
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
+                            if (FJsonSerializer::Deserialize(Reader, JsonObject))
                             {
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
+                                // Get command type
+                                FString CommandType;
+                                if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
+                                {
+                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
 
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
+                                    // Execute command
+                                    FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
 
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Command executed, response length: %d"), Response.Len());
+                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Command executed, response length: %d"), Response.Len());
 
-                                // Log response for debugging (truncated for large responses)
-                                FString LogResponse = Response.Len() > 200 ? Response.Left(200) + TEXT("...") : Response;
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
-                                       Response.Len(), *LogResponse);
+                                    // Log response for debugging (truncated for large responses)
+                                    FString LogResponse = Response.Len() > 200 ? Response.Left(200) + TEXT("...") : Response;
+                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
+                                           Response.Len(), *LogResponse);
 
-                                // Convert to UTF8 once
-                                FTCHARToUTF8 UTF8Response(*Response);
-                                const uint8* DataToSend = (const uint8*)UTF8Response.Get();
-                                int32 TotalDataSize = UTF8Response.Length();
-                                int32 TotalBytesSent = 0;
-                                bool bSuccess = true;
+                                    // Convert to UTF8 once
+                                    FTCHARToUTF8 UTF8Response(*Response);
+                                    const uint8* DataToSend = (const uint8*)UTF8Response.Get();
+                                    int32 TotalDataSize = UTF8Response.Length();
+                                    int32 TotalBytesSent = 0;
+                                    bool bSuccess = true;
 
-                                // Send all data in a loop (TCP may not send everything at once)
-                                while (TotalBytesSent < TotalDataSize)
-                                {
-                                    int32 BytesSent = 0;
-                                    bool bSendResult = ClientSocket->Send(DataToSend + TotalBytesSent,
-                                                                          TotalDataSize - TotalBytesSent,
-                                                                          BytesSent);
-
-                                    if (!bSendResult)
+                                    // Send all data in a loop (TCP may not send everything at once)
+                                    while (TotalBytesSent < TotalDataSize)
                                     {
-                                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                                        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
-                                               TotalBytesSent, TotalDataSize, LastError);
-                                        bSuccess = false;
-                                        break;
+                                        int32 BytesSent = 0;
+                                        bool bSendResult = ClientSocket->Send(DataToSend + TotalBytesSent,
+                                                                              TotalDataSize - TotalBytesSent,
+                                                                              BytesSent);
+
+                                        if (!bSendResult)
+                                        {
+                                            int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+                                            UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
+                                                   TotalBytesSent, TotalDataSize, LastError);
+                                            bSuccess = false;
+                                            break;
+                                        }
+
+                                        TotalBytesSent += BytesSent;
+                                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
+                                               BytesSent, TotalBytesSent, TotalDataSize);
                                     }
 
-                                    TotalBytesSent += BytesSent;
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
-                                           BytesSent, TotalBytesSent, TotalDataSize);
+                                    if (bSuccess)
+                                    {
+                                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
+                                               TotalBytesSent);
+                                    }
                                 }
-
-                                if (bSuccess)
+                                else
                                 {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
-                                           TotalBytesSent);
+                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
                                 }
                             }
                             else
                             {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
                             }
                         }
-                        else
+
+                        if (MessageBytes.Num() > MaxCommandBytes)
                         {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
+                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Command exceeds %d bytes, discarding"), MaxCommandBytes);
+                            MessageBytes.Reset();
+                            Scanner.Reset();
                         }
                     }
                     else
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Internationalization/Regex.h"
+
+class AActor;
+
+/**
+ * Actor query compiled once per request from JSON parameters.
+ *
+ * Supported fields (all optional, all ANDed together):
+ *   pattern         - name pattern, interpreted according to match_mode
+ *   match_mode      - "contains" (default), "exact", "glob" or "regex"
+ *   case_sensitive  - default true
+ *   match_field     - "name" (object name, default), "label" (outliner label) or "either"
+ *   class           - class name; subclasses match too
+ *   tags            - array of actor tags, actor must carry all of them
+ *   folder          - outliner folder; subfolders match too
+ *   bounds_min/max  - [X, Y, Z] box the actor location must lie in
+ *   max_results     - stop after this many matches (0 = unlimited)
+ *
+ * Cheap predicates (class, tags, folder, bounds) run before the name test.
+ */
+class UNREALMCP_API FEpicUnrealMCPActorFilter
+{
+public:
+	enum class EMatchMode : uint8
+	{
+		Contains,
+		Exact,
+		Glob,
+		Regex
+	};
+
+	enum class EMatchField : uint8
+	{
+		Name,
+		Label,
+		Either
+	};
+
+	FEpicUnrealMCPActorFilter();
+
+	/** Parse and precompile a filter. Returns false and fills OutError on bad input. */
+	bool Compile(const TSharedPtr<FJsonObject>& Params, FString& OutError);
+
+	/** True if the filter has no predicates at all */
+	bool IsEmpty() const;
+
+	bool Matches(const AActor* Actor) const;
+
+	int32 GetMaxResults() const { return MaxResults; }
+
+private:
+	bool MatchesString(const FString& Candidate) const;
+
+	FString Pattern;
+	EMatchMode MatchMode;
+	EMatchField MatchField;
+	ESearchCase::Type SearchCase;
+	TOptional<FRegexPattern> RegexPattern;
+
+	UClass* ClassFilter;
+	TArray<FName> RequiredTags;
+	FString Folder;
+	bool bHasBounds;
+	FBox Bounds;
+	int32 MaxResults;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Name-keyed index of the actors in the editor world.
+ *
+ * Actor names are only unique within a level, so entries are keyed by level
+ * and name; a bare name prefers the persistent level.
+ *
+ * Handlers used to call GetAllActorsOfClass and compare names on every
+ * request. The index is built once per world and then kept current from
+ * the engine's level actor added/deleted delegates. Anything that can
+ * reshuffle actors wholesale (undo/redo, map change, actor list change)
+ * only marks the index dirty so it is rebuilt on the next query.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPActorIndex
+{
+public:
+	FEpicUnrealMCPActorIndex();
+	~FEpicUnrealMCPActorIndex();
+
+	/** Editor world the index is tracking (nullptr if no editor world) */
+	UWorld* GetWorld();
+
+	/**
+	 * O(1) lookup by object name. Returns nullptr if not found or stale.
+	 * The string overload also takes a full path name, which tells apart
+	 * same-named actors in different streaming levels.
+	 */
+	AActor* FindByName(const FString& ActorName);
+	AActor* FindByName(FName ActorName);
+
+	/** Lookup by the level name from GetLevelName and object name */
+	AActor* Find(FName LevelName, FName ActorName);
+
+	/** NAME_None for the persistent level, the short package name of a streaming level otherwise */
+	static FName GetLevelName(const ULevel* Level);
+	static FName GetLevelName(const AActor* Actor);
+
+	/** Dense list of indexed actors. Entries are validated by the caller via IsValid(). */
+	const TArray<TWeakObjectPtr<AActor>>& GetActors();
+
+	/** Number of indexed actors */
+	int32 Num();
+
+	/** Must be called after an actor's object name has been changed through Rename() */
+	void NotifyActorRenamed(AActor* Actor, FName OldName);
+
+	/** Force a full rebuild on the next query */
+	void MarkDirty() { bDirty = true; }
+
+private:
+	void EnsureUpToDate();
+	void BindDelegates();
+	void UnbindDelegates();
+	void Rebuild(UWorld* World);
+
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnLevelActorListChanged();
+	void OnMapChange(uint32 MapChangeFlags);
+	void OnPostUndoRedo();
+
+	TWeakObjectPtr<UWorld> IndexedWorld;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	// (level name, actor name) to slot in Actors
+	TMap<TPair<FName, FName>, int32> KeyToSlot;
+	// Actor name to the levels holding an actor of that name
+	TMultiMap<FName, FName> NameToLevels;
+	bool bDirty;
+	bool bDelegatesBound;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle PostUndoRedoHandle;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/Object.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/SoftObjectPath.h"
+#include "Engine/StreamableManager.h"
+
+struct FAssetData;
+enum class EPackageReloadPhase : uint8;
+class FPackageReloadedEvent;
+
+/**
+ * Path-keyed cache of loaded assets and Blueprint classes.
+ *
+ * Entries are weak, so garbage-collected assets simply miss and are loaded
+ * again. Renamed and reloaded packages drop their entries, and objects
+ * replaced by hot reload or reinstancing are patched in place. Failed loads
+ * are not cached so assets created later resolve normally.
+ *
+ * Also owns the streamable manager used for asynchronous preloading.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPAssetCache
+{
+public:
+	FEpicUnrealMCPAssetCache();
+	~FEpicUnrealMCPAssetCache();
+
+	/** Load (or fetch) an asset of type T by object path. Returns nullptr if it does not load or has another type. */
+	template<typename T>
+	T* Load(const FString& AssetPath)
+	{
+		return Cast<T>(LoadObjectCached(AssetPath, T::StaticClass()));
+	}
+
+	/** Load a Blueprint generated class; "_C" is appended to the path if missing */
+	UClass* LoadBlueprintClass(const FString& BlueprintPath, UClass* BaseClass);
+
+	/** Start an async load of the given paths; OnLoaded fires on the game thread when all have finished */
+	TSharedPtr<FStreamableHandle> RequestAsyncLoad(const TArray<FSoftObjectPath>& Paths, FStreamableDelegate OnLoaded);
+
+	/** Drop every entry */
+	void Reset();
+
+	/** Entry count, hit/miss counters and hit rate for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	UObject* LoadObjectCached(const FString& AssetPath, UClass* AssetClass);
+
+	void BindDelegates();
+	void UnbindDelegates();
+
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+
+	TMap<FString, TWeakObjectPtr<UObject>> Entries;
+	FStreamableManager StreamableManager;
+	bool bDelegatesBound;
+
+	uint64 Hits;
+	uint64 Misses;
+	uint64 LoadFailures;
+	uint64 Invalidations;
+
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle PackageReloadedHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+};
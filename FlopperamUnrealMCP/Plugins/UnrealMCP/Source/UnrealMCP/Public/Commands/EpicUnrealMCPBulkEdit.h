@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UPackage;
+class FProperty;
+class UStruct;
+class FLevelEditorViewportClient;
+class IInputProcessor;
+
+/**
+ * Defers editor side effects of mass edits until the outermost scope ends.
+ *
+ * Outside a scope every Notify* call performs its side effect immediately.
+ * Inside one, handlers only record what they touched and the flush runs
+ * PostEditChangeProperty once per object and property, PostEditMove once
+ * per moved actor, dirties each package once and redraws the level
+ * viewports once. Selection changes are batched for the whole scope.
+ *
+ * Batch commands open an implicit scope with FScope. begin_bulk_edit opens
+ * an explicit one that spans requests; it also suspends realtime rendering
+ * in the level viewports, wraps everything in one undo transaction (or marks
+ * the scope as no-undo), and is ended automatically after a timeout so a
+ * client that goes away cannot leave the editor frozen.
+ *
+ * The undo transaction stays open between requests, so anything the user
+ * did in that time would be recorded into it. The first key press or mouse
+ * click in the editor therefore closes it: MCP edits made so far become one
+ * undo step, and later requests in the scope record their own steps again.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPBulkEdit
+{
+public:
+	/** Implicit scope for the duration of one batch command */
+	struct FScope
+	{
+		explicit FScope(FEpicUnrealMCPBulkEdit& InBulkEdit)
+			: BulkEdit(InBulkEdit)
+		{
+			BulkEdit.Begin();
+		}
+
+		~FScope()
+		{
+			BulkEdit.End();
+		}
+
+	private:
+		FEpicUnrealMCPBulkEdit& BulkEdit;
+	};
+
+	FEpicUnrealMCPBulkEdit();
+	~FEpicUnrealMCPBulkEdit();
+
+	bool IsActive() const { return Depth > 0; }
+	bool IsExplicit() const { return bExplicit; }
+
+	/** True while an explicit scope opened with bTransact = false is active */
+	bool IsNoUndo() const { return bExplicit && bNoUndoScope; }
+
+	/** True while an explicit scope holds an open undo transaction */
+	bool IsTransacting() const { return bExplicit && bOwnsTransaction; }
+
+	/** Open the explicit scope; calling it again while open only extends the timeout */
+	void BeginExplicit(float TimeoutSeconds, bool bTransact);
+
+	/** Close the explicit scope. Returns what was flushed, or nullptr if no explicit scope was open. */
+	TSharedPtr<FJsonObject> EndExplicit();
+
+	void NotifyPropertyChanged(UObject* Object, FProperty* Property);
+	void NotifyActorMoved(AActor* Actor);
+	void NotifyPackageDirty(UObject* Object);
+	void RequestRedraw();
+
+	/** Scope state and deferral counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	void Begin();
+	void End();
+	void Flush();
+	bool OnTick(float DeltaTime);
+
+	/** Close the scope's undo transaction, at the end of the scope or on the first user input */
+	void StopRecording();
+
+	int32 Depth;
+	bool bExplicit;
+	bool bNoUndoScope;
+	bool bOwnsTransaction;
+	// Set when user input closed the transaction before end_bulk_edit
+	bool bRecordingStopped;
+	TSharedPtr<IInputProcessor> InputWatcher;
+	double ExplicitDeadline;
+	FDelegateHandle TickerHandle;
+	TArray<FLevelEditorViewportClient*> RealtimeOverrides;
+
+	/**
+	 * A changed property, kept by owner and name since explicit scopes can span
+	 * a Blueprint compile or struct edit that rebuilds the FProperty.
+	 */
+	struct FPendingProperty
+	{
+		TWeakObjectPtr<UStruct> Owner;
+		FName Name;
+
+		bool operator==(const FPendingProperty& Other) const
+		{
+			return Owner == Other.Owner && Name == Other.Name;
+		}
+	};
+
+	TMap<TWeakObjectPtr<UObject>, TArray<FPendingProperty>> ChangedProperties;
+	TSet<TWeakObjectPtr<AActor>> MovedActors;
+	TSet<TWeakObjectPtr<UPackage>> DirtyPackages;
+	bool bRedrawRequested;
+
+	// Counters of the last flush, reported by end_bulk_edit
+	int32 LastFlushProperties;
+	int32 LastFlushMoves;
+	int32 LastFlushPackages;
+	double LastFlushSeconds;
+
+	uint64 NumScopes;
+	uint64 NumDeferred;
+	uint64 NumCoalesced;
+};
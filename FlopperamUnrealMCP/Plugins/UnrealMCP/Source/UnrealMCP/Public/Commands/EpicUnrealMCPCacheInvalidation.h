@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Kismet2/StructureEditorUtils.h"
+
+/** Lookup counters shared by the plugin's caches */
+struct FEpicUnrealMCPCacheStats
+{
+	uint64 Hits = 0;
+	uint64 Misses = 0;
+	uint64 Invalidations = 0;
+
+	/** entries, hits, misses, invalidations and hit_rate for get_server_stats */
+	TSharedPtr<FJsonObject> ToJson(int32 NumEntries) const;
+};
+
+/**
+ * Tells the caches keyed by classes, structs or properties when those may
+ * have been rebuilt: after a Blueprint compile, when objects are reinstanced,
+ * after a hot reload, and after a user defined struct is edited (which
+ * changes its layout in place, so the struct pointer alone cannot tell).
+ *
+ * Each cache registers its Reset once; the engine delegates are bound only
+ * once for all of them, on the first cache miss, because GEditor does not
+ * exist yet when the module starts up.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPCacheInvalidation : public FStructureEditorUtils::INotifyOnStructChanged
+{
+public:
+	FEpicUnrealMCPCacheInvalidation();
+	virtual ~FEpicUnrealMCPCacheInvalidation();
+
+	/** Call Callback whenever cached layouts may be stale; returns the handle for Unregister */
+	FDelegateHandle Register(FSimpleDelegate Callback);
+	void Unregister(FDelegateHandle Handle);
+
+	/** Bind the engine delegates if they are not bound yet */
+	void BindDelegates();
+
+	// INotifyOnStructChanged
+	virtual void PreChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override;
+	virtual void PostChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override;
+
+private:
+	void UnbindDelegates();
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void OnBlueprintCompiled();
+	void OnHotReload(bool bWasTriggeredAutomatically);
+
+	FSimpleMulticastDelegate OnInvalidate;
+	bool bDelegatesBound;
+
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle HotReloadHandle;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+
+class AActor;
+class UActorComponent;
+
+/** One component of an actor and the names it can be addressed by */
+struct FEpicUnrealMCPComponentEntry
+{
+	TWeakObjectPtr<UActorComponent> Component;
+	// Object name, e.g. "StaticMeshComponent0" or the Blueprint variable name
+	FName Name;
+	// Actor property that references the component, e.g. "StaticMeshComponent"; None if there is none
+	FName PropertyName;
+};
+
+/**
+ * Per-actor cache of components by name.
+ *
+ * A component can be addressed by its object name or by the name of the
+ * actor property that points at it, so "StaticMeshComponent" finds the
+ * component a native class creates as "StaticMeshComponent0". Building an
+ * actor's entry walks its owned components and the component properties of
+ * its class once; later lookups are a hash lookup. An entry is rebuilt when
+ * the actor's component count changes or a cached component has gone away,
+ * and the whole cache is dropped on every Invalidation broadcast, since a
+ * recompiled class can add, remove or rename component properties. Entries of destroyed actors are swept whenever the map has
+ * doubled since the last sweep, so deleting actors does not leak entries.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPComponentIndex
+{
+public:
+	explicit FEpicUnrealMCPComponentIndex(FEpicUnrealMCPCacheInvalidation& InInvalidation);
+	~FEpicUnrealMCPComponentIndex();
+
+	/** Component of Actor by object or property name. Returns nullptr if there is none. */
+	UActorComponent* Find(AActor* Actor, const FString& ComponentName);
+
+	/** Every component of Actor in a stable order */
+	const TArray<FEpicUnrealMCPComponentEntry>& GetComponents(AActor* Actor);
+
+	/** Drop every cached actor */
+	void Reset();
+
+	/** Cached actor count and hit/miss counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	struct FActorEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TArray<FEpicUnrealMCPComponentEntry> Components;
+		TMap<FName, int32> NameToSlot;
+	};
+
+	FActorEntry& FindOrBuild(AActor* Actor, bool bForceRebuild);
+	static bool IsStale(const FActorEntry& Entry, AActor* Actor);
+	static void Build(AActor* Actor, FActorEntry& Out);
+	void SweepDestroyedActors();
+
+	TMap<const AActor*, FActorEntry> Entries;
+	// Entry count that triggers the next sweep of destroyed actors
+	int32 SweepThreshold;
+
+	FEpicUnrealMCPCacheInvalidation& Invalidation;
+	FDelegateHandle InvalidationHandle;
+	FEpicUnrealMCPCacheStats Stats;
+};
@@ -2,10 +2,73 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "UObject/SoftObjectPath.h"
 
 // Forward declarations for Widget Blueprint support
 class UWidgetBlueprint;
 class UWidget;
+class FEpicUnrealMCPActorIndex;
+class FEpicUnrealMCPAssetCache;
+class FEpicUnrealMCPBulkEdit;
+class FEpicUnrealMCPCacheInvalidation;
+class FEpicUnrealMCPPropertyResolver;
+class FEpicUnrealMCPPropertyConverter;
+class FEpicUnrealMCPNotifyPolicy;
+class FEpicUnrealMCPComponentIndex;
+class FEpicUnrealMCPPropertyWatch;
+class FEpicUnrealMCPWorldSnapshot;
+struct FEpicUnrealMCPActorRecord;
+struct FEpicUnrealMCPConvertLimits;
+class UStaticMesh;
+class UMaterialInterface;
+class UActorComponent;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * One resolved entry of a batched spawn request.
+ * Classes and meshes are resolved before any actor is spawned.
+ */
+struct FEpicUnrealMCPSpawnSpec
+{
+	FString Name;
+	UClass* ActorClass = nullptr;
+	UStaticMesh* StaticMesh = nullptr;
+	// Per-slot material overrides; null entries keep the mesh default
+	TArray<UMaterialInterface*> Materials;
+	FTransform Transform;
+	FName FolderPath;
+	// Exported-text property values applied before construction runs
+	TMap<FName, FString> PropertyValues;
+};
+
+/**
+ * One object addressed by a multi-object property command: an actor, an
+ * asset, or the class default object of a Blueprint asset.
+ */
+struct FEpicUnrealMCPPropertyTarget
+{
+	// Actor name or asset path, as echoed back in results
+	FString Name;
+	UObject* Object = nullptr;
+};
+
+/**
+ * An asynchronous asset load started by preload_assets or by a spawn command
+ * called with async=true. Spawn jobs re-run their command once loading ends.
+ */
+struct FEpicUnrealMCPAsyncJob
+{
+	// Command to re-run after loading; empty for plain preloads
+	FString CommandType;
+	TSharedPtr<FJsonObject> Params;
+	TArray<FSoftObjectPath> Paths;
+	// Keeps the loaded assets resident until the job is released
+	TSharedPtr<struct FStreamableHandle> Handle;
+	TSharedPtr<FJsonObject> Result;
+	bool bComplete = false;
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+};
 
 /**
  * Handler class for Editor-related MCP commands
@@ -22,6 +85,9 @@ public:
 	// Handle editor commands
 	TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+	// Block until a watched property changes or TimeoutMs passes; called on the server thread before poll_property_changes
+	void WaitForPropertyChanges(uint32 TimeoutMs);
+
 private:
 	// Actor manipulation commands
 	TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
@@ -41,6 +107,8 @@ private:
 	TSharedPtr<FJsonObject> HandleEditorValidateAssets(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleEditorTakeScreenshot(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleEditorMoveCamera(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleGetServerStats(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleReloadNotifyPolicy(const TSharedPtr<FJsonObject>& Params);
 
 	// ============================================================================
 	// Widget Blueprint Commands
@@ -101,15 +169,122 @@ private:
 	TSharedPtr<FJsonObject> HandleDeleteDataTableRow(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleSetDataTableArrayElement(const TSharedPtr<FJsonObject>& Params);
 
+	// ============================================================================
+	// Bulk Actor Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleGetActorTransformsBulk(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSpawnActors(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleConvertToInstances(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSetActorTransforms(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleDeleteActors(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSetActorsFolder(const TSharedPtr<FJsonObject>& Params);
+
+	// Bulk Query Helpers
+	bool CollectActorsByQuery(const TSharedPtr<FJsonObject>& Params, TArray<AActor*>& OutActors,
+		TArray<TSharedPtr<FJsonValue>>& OutMissing, FString& OutError);
+
+	// Bulk Spawn Helpers
+	bool ParseSpawnSpec(const TSharedPtr<FJsonObject>& ItemJson, FEpicUnrealMCPSpawnSpec& OutSpec, FString& OutError);
+	TSharedPtr<FJsonObject> SpawnActorBatch(UWorld* World, const TArray<FEpicUnrealMCPSpawnSpec>& Specs,
+		const TArray<FString>& SpecErrors, bool bUniqueNames, bool bInstanced);
+
+	// Instancing Helpers
+	TSharedPtr<FJsonObject> SpawnInstancedActor(const TSharedPtr<FJsonObject>& Params);
+	UHierarchicalInstancedStaticMeshComponent* FindOrCreateInstanceGroup(UWorld* World, UStaticMesh* Mesh,
+		const TArray<UMaterialInterface*>& Materials);
+
+	// ============================================================================
+	// Async Asset Loading Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandlePreloadAssets(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleGetAsyncJob(const TSharedPtr<FJsonObject>& Params);
+
+	// Async Loading Helpers
+	void CollectSpawnAssetPaths(const TSharedPtr<FJsonObject>& SpecJson, TArray<FSoftObjectPath>& OutPaths) const;
+	TSharedPtr<FJsonObject> DeferUntilLoaded(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TArray<FSoftObjectPath>& Paths);
+	int32 StartAsyncJob(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TArray<FSoftObjectPath>& Paths);
+	void OnAsyncJobLoaded(int32 JobId);
+	void EvictFinishedAsyncJobs();
+
+	// ============================================================================
+	// Structure Builder Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleBuildStructure(const TSharedPtr<FJsonObject>& Params);
+
+	// ============================================================================
+	// Prefab Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleCapturePrefab(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleStampPrefab(const TSharedPtr<FJsonObject>& Params);
+
+	// Prefab Helpers
+	TSharedPtr<FJsonObject> FindPrefab(const FString& PrefabName);
+
+	// ============================================================================
+	// Pattern Spawn Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleSpawnPattern(const TSharedPtr<FJsonObject>& Params);
+
+	// ============================================================================
+	// Bulk Edit Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleBeginBulkEdit(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleEndBulkEdit(const TSharedPtr<FJsonObject>& Params);
+
+	// ============================================================================
+	// World Snapshot Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleSnapshotWorld(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleRestoreWorld(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleDiffWorld(const TSharedPtr<FJsonObject>& Params);
+
+	// World Snapshot Helpers
+	TSharedPtr<FEpicUnrealMCPWorldSnapshot> FindSnapshot(const FString& SnapshotName);
+	void ApplyActorRecord(AActor* Actor, const FEpicUnrealMCPActorRecord& Record);
+
+	// ============================================================================
+	// Component Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleListComponents(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleGetComponentProperty(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSetComponentProperty(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSetComponentTransform(const TSharedPtr<FJsonObject>& Params);
+
+	// Component Helpers
+	bool FindComponentTarget(const TSharedPtr<FJsonObject>& Params, AActor*& OutActor, UActorComponent*& OutComponent,
+		FString& OutPropertyPath, FString& OutError);
+
+	// ============================================================================
+	// Property Watch Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleWatchProperties(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandlePollPropertyChanges(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleUnwatchProperties(const TSharedPtr<FJsonObject>& Params);
+
+	// ============================================================================
+	// Multi-Object Property Commands
+	// ============================================================================
+	TSharedPtr<FJsonObject> HandleGetProperties(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleSetProperties(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleDumpOverrides(const TSharedPtr<FJsonObject>& Params);
+
+	// Multi-Object Property Helpers
+	bool CollectPropertyTargets(const TSharedPtr<FJsonObject>& Params, TArray<FEpicUnrealMCPPropertyTarget>& OutTargets,
+		TArray<TSharedPtr<FJsonValue>>& OutMissing, FString& OutError);
+	int32 DiffStructAgainstDefaults(UStruct* Struct, const void* Data, const void* DefaultData, UObject* Owner, UObject* Archetype,
+		bool bRecursive, int32 Depth, FJsonObject& OutJson);
+	int32 DiffObjectAgainstArchetype(UObject* Object, UObject* Archetype, bool bRecursive, FJsonObject& OutJson);
+
 	// Data Table Helpers
 	TSharedPtr<FJsonObject> RowStructToJson(UScriptStruct* RowStruct, const void* RowData);
 	bool JsonToRowStruct(const TSharedPtr<FJsonObject>& JsonObj, UScriptStruct* RowStruct, void* RowData);
 
 	// Actor Property Helpers
 	AActor* FindActorByName(const FString& ActorName);
-	TSharedPtr<FJsonValue> PropertyToJsonValue(UProperty* Property, const void* ValuePtr);
-	bool JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, UProperty* Property, void* ValuePtr);
-	FString GetPropertyTypeName(UProperty* Property);
+	TSharedPtr<FJsonValue> PropertyToJsonValue(FProperty* Property, const void* ValuePtr);
+	TSharedPtr<FJsonValue> PropertyToJsonValue(FProperty* Property, const void* ValuePtr, const FEpicUnrealMCPConvertLimits& Limits, const FString& Path);
+	bool JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ValuePtr);
+	FString GetPropertyTypeName(FProperty* Property);
 
 	// Widget Blueprint Helpers
 	UWidgetBlueprint* LoadWidgetBlueprint(const FString& AssetPath);
@@ -128,4 +303,45 @@ private:
 	// Helper to convert actor to JSON
 	TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
 	TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bIncludeSuccess = false);
+
+	// Resets the property caches below when layouts are rebuilt; declared first so it outlives them
+	TSharedPtr<FEpicUnrealMCPCacheInvalidation> CacheInvalidation;
+
+	// Name-keyed index of editor world actors, shared by all handlers
+	TSharedPtr<FEpicUnrealMCPActorIndex> ActorIndex;
+
+	// Path-keyed cache of loaded meshes, materials and Blueprint classes, shared by all handlers
+	TSharedPtr<FEpicUnrealMCPAssetCache> AssetCache;
+
+	// Defers editor notifications during batch commands and begin_bulk_edit scopes
+	TSharedPtr<FEpicUnrealMCPBulkEdit> BulkEdit;
+
+	// Compiled nested property paths ("Component.RelativeLocation.X", "Items[3]", "Map{Key}")
+	TSharedPtr<FEpicUnrealMCPPropertyResolver> PropertyResolver;
+
+	// Per-struct conversion plans behind PropertyToJsonValue/JsonValueToProperty
+	TSharedPtr<FEpicUnrealMCPPropertyConverter> PropertyConverter;
+
+	// Which change notifications a property write sends; project rules come from editor config
+	TSharedPtr<FEpicUnrealMCPNotifyPolicy> NotifyPolicy;
+
+	// Components of each actor by object and property name
+	TSharedPtr<FEpicUnrealMCPComponentIndex> ComponentIndex;
+
+	// Watched property values, re-hashed every frame; holds a reference to PropertyResolver
+	TSharedPtr<FEpicUnrealMCPPropertyWatch> PropertyWatch;
+
+	// Requests that opened an undo transaction, and undoable requests run with no_undo
+	uint64 NumTransactions = 0;
+	uint64 NumNoUndoRequests = 0;
+
+	// Outstanding and finished async load jobs, keyed by job id; finished jobs expire, see EvictFinishedAsyncJobs
+	TMap<int32, FEpicUnrealMCPAsyncJob> AsyncJobs;
+	int32 NextAsyncJobId = 1;
+
+	// Captured prefab templates by name; also filled lazily from Saved/MCPPrefabs
+	TMap<FString, TSharedPtr<FJsonObject>> Prefabs;
+
+	// World snapshots by name; also filled lazily from Saved/MCPSnapshots
+	TMap<FString, TSharedPtr<FEpicUnrealMCPWorldSnapshot>> Snapshots;
 };
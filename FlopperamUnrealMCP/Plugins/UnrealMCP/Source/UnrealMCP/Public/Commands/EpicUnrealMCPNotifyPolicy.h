@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+
+class FProperty;
+class UClass;
+class UScriptStruct;
+class FEpicUnrealMCPBulkEdit;
+
+/**
+ * Decides which change notifications a property write sends.
+ *
+ * The written top-level property always gets PostEditChangeProperty. When a
+ * whole struct is written, some actors also need events for individual
+ * fields of it to refresh their editor visualization. Which fields those are
+ * is project specific, so they come from the editor config rather than the
+ * plugin:
+ *
+ *   [UnrealMCP.NotifyPolicy]
+ *   +SubPropertyRule=(Class="SVGLegionSpawn",Struct="SpawnContext",Properties="SoldierType,TeamID,bDisabled")
+ *
+ * Class matches the object's class or any base class by name; Struct matches
+ * the written struct type by name. Either may be left out to match anything.
+ *
+ * Rules are read from config on first use. Reload re-reads them from the
+ * ini files on disk, so rules edited while the editor runs take effect
+ * without a restart.
+ *
+ * Notifications go through FEpicUnrealMCPBulkEdit, so inside a scope each
+ * (object, property) pair is sent once when the scope ends. The field names a
+ * rule set picks for a (class, struct) pair are resolved once and cached until
+ * Invalidation reports a rebuild; the properties themselves are looked up by
+ * name on every write.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPNotifyPolicy
+{
+public:
+	explicit FEpicUnrealMCPNotifyPolicy(FEpicUnrealMCPCacheInvalidation& InInvalidation);
+	~FEpicUnrealMCPNotifyPolicy();
+
+	/** Queue the notifications for writing Property (at or below MemberProperty) on Object */
+	void NotifyWrite(FEpicUnrealMCPBulkEdit& BulkEdit, UObject* Object, FProperty* MemberProperty, FProperty* Property);
+
+	/** Re-read the rules from the Editor ini files on disk and drop resolved entries. Returns the rule count. */
+	int32 Reload();
+
+	/** Rule count, resolved entries and hit/miss counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	struct FRule
+	{
+		// Empty matches any class or struct
+		FName ClassName;
+		FName StructName;
+		TArray<FName> Properties;
+	};
+
+	struct FResolvedEntry
+	{
+		TWeakObjectPtr<UClass> Class;
+		TWeakObjectPtr<UScriptStruct> Struct;
+		// Names rather than FProperty pointers: editing a user defined struct or a hot reload
+		// rebuilds the struct's properties while the struct itself stays valid
+		TArray<FName> SubPropertyNames;
+	};
+
+	void LoadRules();
+	void ParseRules(const TArray<FString>& Lines);
+	const FResolvedEntry& FindOrResolve(UClass* Class, UScriptStruct* Struct);
+	static bool IsClassOrBaseNamed(const UClass* Class, FName ClassName);
+
+	void Reset();
+
+	TArray<FRule> Rules;
+	bool bRulesLoaded;
+
+	TMap<TPair<const UClass*, const UScriptStruct*>, FResolvedEntry> Resolved;
+
+	FEpicUnrealMCPCacheInvalidation& Invalidation;
+	FDelegateHandle InvalidationHandle;
+	FEpicUnrealMCPCacheStats Stats;
+	uint64 SubPropertyEvents;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Generates placement transforms for spawn_pattern.
+ *
+ * Patterns ("pattern" field):
+ *   grid    - counts [X, Y, Z] at spacing [X, Y, Z], optionally centered
+ *   radial  - count copies on each of rings concentric circles, optionally facing outward
+ *   spline  - copies every spacing units (or count evenly) along a curve through
+ *             "points", or along a path supplied with SetPath
+ *   scatter - Poisson-disk samples over size [X, Y] at least min_distance apart
+ *
+ * Variation is drawn from a stream seeded by "seed", so the same request
+ * always yields the same layout: jitter [X, Y, Z], random_yaw,
+ * random_rotation [P, Y, R] (max deviation) and scale_range [min, max].
+ *
+ * Overlap rejection drops a point closer than min_distance to an earlier
+ * point or inside a blocker box. Both tests go through uniform hash grids,
+ * so generation stays linear in the number of points.
+ */
+class UNREALMCP_API FEpicUnrealMCPPatternGenerator
+{
+public:
+	static constexpr int32 MaxPoints = 100000;
+
+	FEpicUnrealMCPPatternGenerator();
+
+	/** World-space polyline for the spline pattern, used instead of "points" */
+	void SetPath(TArray<FVector>&& Points, bool bClosed);
+
+	/** World-space box no generated point may fall inside; add before Generate */
+	void AddBlocker(const FBox& Box);
+
+	/** Generate the pattern in world space. Returns false and fills OutError on bad input. */
+	bool Generate(const TSharedPtr<FJsonObject>& PatternJson, FString& OutError);
+
+	const TArray<FTransform>& GetTransforms() const { return Transforms; }
+
+	/** Points produced by the pattern before overlap rejection */
+	int32 GetNumCandidates() const { return NumCandidates; }
+
+	int32 GetNumRejected() const { return NumCandidates - Transforms.Num(); }
+
+	/** Local grid offsets only, without root transform, variation or rejection; also used by build_structure */
+	static bool GenerateGrid(const TSharedPtr<FJsonObject>& PatternJson, TArray<FTransform>& OutLocal, FString& OutError);
+
+	/** Local ring offsets only, without root transform, variation or rejection; also used by build_structure */
+	static bool GenerateRadial(const TSharedPtr<FJsonObject>& PatternJson, TArray<FTransform>& OutLocal, FString& OutError);
+
+private:
+	bool GenerateSpline(const TSharedPtr<FJsonObject>& PatternJson, const FTransform& Root, TArray<FTransform>& OutWorld, FString& OutError) const;
+	bool GenerateScatter(const TSharedPtr<FJsonObject>& PatternJson, FRandomStream& Random, TArray<FTransform>& OutLocal, FString& OutError) const;
+
+	/** Drops points that overlap earlier points or blockers, preserving order */
+	void RejectOverlaps(TArray<FTransform>& InOutTransforms, float MinDistance, float Clearance) const;
+
+	TArray<FVector> Path;
+	bool bPathClosed;
+	TArray<FBox> Blockers;
+	TArray<FTransform> Transforms;
+	int32 NumCandidates;
+};
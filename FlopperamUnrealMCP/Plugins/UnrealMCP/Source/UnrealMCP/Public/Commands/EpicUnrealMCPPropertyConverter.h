@@ -0,0 +1,213 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+
+class FProperty;
+class FScriptArrayHelper;
+class UStruct;
+class UScriptStruct;
+
+/**
+ * Size limits and encoding for reading a value. Containers longer than
+ * MaxElements and structs or containers nested deeper than MaxDepth below the
+ * requested value are cut off, and the cut carries a continuation token
+ * ("<path>@<offset>") that fetches the next slice when passed back as
+ * 'continuation'.
+ */
+struct FEpicUnrealMCPConvertLimits
+{
+	// Elements per container; 0 = no limit
+	int32 MaxElements = 0;
+	// Nesting levels expanded below the requested value; 0 = no limit
+	int32 MaxDepth = 0;
+	// First element returned when the requested value itself is a container
+	int32 Offset = 0;
+	// Arrays of numbers or all-numeric structs as packed base64 blocks
+	bool bPacked = false;
+
+	bool IsActive() const { return MaxElements > 0 || MaxDepth > 0 || Offset > 0 || bPacked; }
+};
+
+/**
+ * Converts property values to and from JSON.
+ *
+ * Every struct is compiled once into a flat list of fields (offset, kind,
+ * cached name and type name), so converting a row or a nested struct is a
+ * switch per field instead of a chain of casts, an iterator walk and a name
+ * conversion. Numeric fields and arrays of numbers are read and written
+ * straight from memory; consecutive fields of one numeric type laid out back
+ * to back (the components of a vector or color, a block of stats) form a run
+ * that converts in one typed loop. Top-level properties passed to ToJson and
+ * FromJson are compiled the same way and cached by property.
+ *
+ * Object references convert as path strings: hard, weak and lazy references
+ * load the object when written, soft references store the path unresolved.
+ *
+ * Arrays whose elements are numbers or structs made only of one numeric type
+ * (FVector, FLinearColor, FIntPoint, ...) can also travel as a packed block,
+ * {encoding: "base64", element: "f32", components, fields, count, data}, where
+ * data is the array memory as little-endian bytes. FromJson accepts that form
+ * for any such array; ToJson produces it when asked to through bPacked.
+ *
+ * Plans are keyed by struct or property pointer and dropped whenever
+ * Invalidation reports that property layouts may have been rebuilt.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPPropertyConverter
+{
+public:
+	explicit FEpicUnrealMCPPropertyConverter(FEpicUnrealMCPCacheInvalidation& InInvalidation);
+	~FEpicUnrealMCPPropertyConverter();
+
+	TSharedPtr<FJsonValue> ToJson(FProperty* Property, const void* ValuePtr);
+
+	/**
+	 * ToJson within size limits. A container that is sliced becomes
+	 * {_truncated, type, count, offset, items, continuation}; a struct or
+	 * container past the depth limit becomes {_truncated, type, count,
+	 * continuation}. With bPacked, arrays that have a packed form use it.
+	 * Path is the property path of the value, used for tokens.
+	 */
+	TSharedPtr<FJsonValue> ToJson(FProperty* Property, const void* ValuePtr, const FEpicUnrealMCPConvertLimits& Limits, const FString& Path);
+
+	bool FromJson(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ValuePtr);
+
+	/** Struct fields as a JSON object; with bWithTypes each field is {type, value} */
+	TSharedPtr<FJsonObject> StructToJson(UScriptStruct* Struct, const void* StructPtr, bool bWithTypes);
+
+	/**
+	 * Write the fields present in JsonObj into the struct. With bUnwrapTyped a
+	 * field given as {type, value} uses its value. Fields that fail to convert
+	 * are skipped and appended to OutFailedFields if given.
+	 */
+	void StructFromJson(const FJsonObject& JsonObj, UScriptStruct* Struct, void* StructPtr, bool bUnwrapTyped, TArray<FString>* OutFailedFields = nullptr);
+
+	/** "Int", "Struct:Vector", "Array<Float>" and so on */
+	static FString GetTypeName(FProperty* Property);
+
+	/** Vectors, rotators, transforms and colors convert as a whole value rather than field by field */
+	static bool HasCompactForm(const UScriptStruct* Struct);
+
+	/** Element count of an array, map or set value; INDEX_NONE for anything else */
+	static int32 GetNumElements(FProperty* Property, const void* ValuePtr);
+
+	/** Split a continuation token into its property path and offset */
+	static bool ParseContinuation(const FString& Token, FString& OutPath, int32& OutOffset);
+
+	/** Drop every compiled struct and property */
+	void Reset();
+
+	/** Compiled struct and property count and hit/miss counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	enum class EKind : uint8
+	{
+		Bool,
+		Byte,
+		ByteEnum,
+		Int,
+		Int64,
+		Float,
+		Double,
+		Str,
+		Name,
+		Text,
+		Vector,
+		Rotator,
+		Transform,
+		LinearColor,
+		Color,
+		Vector2D,
+		Struct,
+		Enum,
+		// Hard, weak and lazy references
+		Object,
+		// Soft object and soft class references
+		SoftObject,
+		Array,
+		Map,
+		Set,
+		// Anything else; read as export text, not writable
+		Other
+	};
+
+	/** One value slot: a struct field, or the element/key/value of a container */
+	struct FNode
+	{
+		EKind Kind = EKind::Other;
+		FProperty* Property = nullptr;
+		// Offset inside the owning struct; zero for container elements
+		int32 Offset = 0;
+		// Struct fields only
+		FString Name;
+		FString TypeName;
+		// Struct fields only: fields from this one on that form a numeric run, 0 for the rest of a run
+		int32 RunLength = 1;
+		// Generic structs; their plan is looked up when converting
+		UScriptStruct* Struct = nullptr;
+		// Array/set element, or map key and value
+		TArray<FNode> Children;
+	};
+
+	struct FStructPlan
+	{
+		TWeakObjectPtr<UStruct> Struct;
+		TArray<FNode> Fields;
+	};
+
+	/** A top-level property; the owner tells a live property from one freed with its struct */
+	struct FPropertyPlan
+	{
+		TWeakObjectPtr<UStruct> Owner;
+		FNode Node;
+	};
+
+	static EKind Classify(FProperty* Property);
+	static void BuildNode(FProperty* Property, FNode& Out);
+	static bool IsNumeric(EKind Kind);
+
+	TSharedPtr<FStructPlan> FindOrBuildPlan(UScriptStruct* Struct);
+	TSharedPtr<FPropertyPlan> FindOrBuildPropertyPlan(FProperty* Property);
+	static void BuildNumericRuns(TArray<FNode>& Fields);
+
+	TSharedPtr<FJsonValue> NodeToJson(const FNode& Node, const void* ValuePtr);
+	bool NodeFromJson(const FNode& Node, const TSharedPtr<FJsonValue>& JsonValue, void* ValuePtr);
+	TSharedPtr<FJsonObject> PlanToJson(const FStructPlan& Plan, const void* StructPtr, bool bWithTypes);
+	void PlanFromJson(const FStructPlan& Plan, const FJsonObject& JsonObj, void* StructPtr, bool bUnwrapTyped, TArray<FString>* OutFailedFields);
+
+	// Limited reads: the child at Segment below the current path, one level deeper
+	TSharedPtr<FJsonValue> DescendToJson(const FNode& Node, const void* ValuePtr, const FString& Segment);
+	bool IsBeyondDepth() const;
+	void GetSlice(int32 Num, int32& OutStart, int32& OutEnd) const;
+	TSharedPtr<FJsonValue> MakeStub(const FNode& Node, int32 Num) const;
+	TSharedPtr<FJsonValue> MakeSlice(const FNode& Node, const TSharedPtr<FJsonValue>& Items, int32 Num, int32 Start, int32 End) const;
+
+	// Packed arrays
+	bool GetPackedLayout(const FNode& Element, EKind& OutScalar, TArray<FString>& OutFields);
+	TSharedPtr<FJsonValue> PackArray(const FNode& Element, FScriptArrayHelper& ArrayHelper, int32 Start, int32 End);
+	bool UnpackArray(const FNode& Node, const FJsonObject& PackedJson, void* ValuePtr);
+	static const TCHAR* GetScalarName(EKind Kind);
+
+	// Raw numeric reads and writes, shared by struct fields and array elements
+	static double ReadNumber(EKind Kind, const void* ValuePtr);
+	static void WriteNumber(EKind Kind, void* ValuePtr, double Value);
+	static void ReadNumbers(EKind Kind, const void* FirstPtr, int32 Count, double* OutValues);
+	static void WriteNumbers(EKind Kind, void* FirstPtr, int32 Count, const double* Values);
+
+	// Set only for the duration of a limited ToJson
+	const FEpicUnrealMCPConvertLimits* ActiveLimits;
+	int32 Depth;
+	FString CurrentPath;
+
+	TMap<const UStruct*, TSharedPtr<FStructPlan>> Plans;
+	TMap<const FProperty*, TSharedPtr<FPropertyPlan>> PropertyPlans;
+
+	FEpicUnrealMCPCacheInvalidation& Invalidation;
+	FDelegateHandle InvalidationHandle;
+	FEpicUnrealMCPCacheStats Stats;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Commands/EpicUnrealMCPCacheInvalidation.h"
+
+class FProperty;
+class UStruct;
+
+/** Where a property path ends up on one object */
+struct FEpicUnrealMCPResolvedProperty
+{
+	// Property describing the value at ValuePtr
+	FProperty* Property = nullptr;
+	void* ValuePtr = nullptr;
+	// Object that owns the value; differs from the start object once the path crossed an object reference
+	UObject* Object = nullptr;
+	// Top-level property of Object the value lives under, for Modify and change notifications
+	FProperty* MemberProperty = nullptr;
+	// Values of Property laid out from ValuePtr: ArrayDim for a whole fixed-size array, 1 once the path indexes into it
+	int32 NumElements = 1;
+};
+
+/**
+ * Resolves nested property paths against objects.
+ *
+ * Syntax: members are separated by dots, [N] indexes an array (dynamic or
+ * fixed size) and {Key} looks up a map value or set element by its key as
+ * text, e.g. "StaticMeshComponent.RelativeLocation.X", "Items[3].Count" or
+ * "Stats{Health}". A member access on an object reference continues in the
+ * referenced object.
+ *
+ * Each (class or struct, path) pair is compiled once into a chain of steps
+ * in which runs of struct member accesses and fixed-size array indices are
+ * folded into a single offset, so repeated lookups are a hash lookup plus a
+ * few pointer hops. Paths that cross an object reference are cached per
+ * segment against the runtime class of the referenced object. Failed
+ * compilations are not cached, and the cache is dropped once it holds
+ * MaxCachedPaths entries or whenever Invalidation reports that properties
+ * may have been rebuilt.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FEpicUnrealMCPPropertyResolver
+{
+public:
+	explicit FEpicUnrealMCPPropertyResolver(FEpicUnrealMCPCacheInvalidation& InInvalidation);
+	~FEpicUnrealMCPPropertyResolver();
+
+	/**
+	 * Resolve Path on Object. Returns false and fills OutError if any part does not exist.
+	 * With bForWrite the path may only continue into objects owned by Object (components and
+	 * other subobjects), so a write cannot reach a shared asset such as the mesh of a component.
+	 */
+	bool Resolve(UObject* Object, const FString& Path, FEpicUnrealMCPResolvedProperty& OutResolved, FString& OutError, bool bForWrite = false);
+
+	/** Drop every compiled path */
+	void Reset();
+
+	static constexpr int32 MaxCachedPaths = 4096;
+
+	/** Cached path count and hit/miss counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	enum class EStepKind : uint8
+	{
+		Offset,
+		ArrayElement,
+		MapValue,
+		SetElement
+	};
+
+	struct FStep
+	{
+		EStepKind Kind = EStepKind::Offset;
+		int32 Offset = 0;
+		// Container property for the element steps
+		FProperty* Property = nullptr;
+		int32 Index = 0;
+		FString Key;
+	};
+
+	struct FCompiledPath
+	{
+		TWeakObjectPtr<UStruct> Owner;
+		TArray<FStep> Steps;
+		FProperty* Leaf = nullptr;
+		FProperty* MemberProperty = nullptr;
+		int32 NumElements = 1;
+		// Rest of the path, continued in the object the chain ends on
+		FString Remainder;
+		FString Error;
+	};
+
+	const FCompiledPath& FindOrCompile(UStruct* Owner, const FString& Path);
+	static void Compile(UStruct* Owner, const FString& Path, FCompiledPath& Out);
+	static uint8* FindKeyedElement(const FStep& Step, uint8* ContainerPtr);
+
+	TMap<TPair<const UStruct*, FString>, FCompiledPath> Cache;
+	// Holds the latest failed compilation, which is never added to Cache
+	FCompiledPath Failed;
+
+	FEpicUnrealMCPCacheInvalidation& Invalidation;
+	FDelegateHandle InvalidationHandle;
+	FEpicUnrealMCPCacheStats Stats;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+#include "Templates/Atomic.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FEvent;
+class FEpicUnrealMCPPropertyResolver;
+struct FEpicUnrealMCPResolvedProperty;
+
+/** One watched (object, property path) pair */
+struct FEpicUnrealMCPPropertyWatchEntry
+{
+	int32 Id = 0;
+	TWeakObjectPtr<UObject> Object;
+	// Target name as echoed back in events, e.g. "Door_1" or "Door_1.StaticMeshComponent"
+	FString Target;
+	FString Path;
+	uint32 Hash = 0;
+	bool bResolved = false;
+	// Changes seen since the last poll, and when the latest one was seen
+	int32 Changes = 0;
+	double LastChangeTime = 0.0;
+	bool bRemoved = false;
+};
+
+/**
+ * Server-side change detection for watch_properties.
+ *
+ * Each watched value is reduced to a hash: a memory CRC for plain-old-data
+ * properties and a CRC of the exported text for everything else. A core
+ * ticker re-hashes watches round-robin every frame until the time budget is
+ * spent, so a large watch list is spread over several frames instead of
+ * stalling one. Changes only set a per-watch flag; the values themselves are
+ * converted when the client polls, so a value that changes every frame costs
+ * one conversion per poll rather than one per frame.
+ *
+ * The socket protocol is strictly request/response, so changes cannot be
+ * pushed. Instead poll_property_changes may wait on the server thread with
+ * WaitForChanges until the first change is flagged, which gives the client
+ * push-like latency without a game thread hop per check.
+ *
+ * Everything except WaitForChanges is game thread only. WaitForChanges
+ * returns at once while nothing is watched, so a poll without watches does
+ * not hold the server thread for its whole wait.
+ */
+class UNREALMCP_API FEpicUnrealMCPPropertyWatch
+{
+public:
+	explicit FEpicUnrealMCPPropertyWatch(FEpicUnrealMCPPropertyResolver& InResolver);
+	~FEpicUnrealMCPPropertyWatch();
+
+	/** Start watching Path on Object. Returns the watch id, or 0 and fills OutError if the path does not resolve. */
+	int32 Watch(UObject* Object, const FString& Target, const FString& Path, FString& OutError);
+
+	/** Stop watching one id. Returns false if it was not watched. */
+	bool Unwatch(int32 Id);
+
+	/** Stop every watch; returns how many there were */
+	int32 UnwatchAll();
+
+	/** Time spent hashing per frame, in seconds */
+	void SetBudget(double InBudgetSeconds);
+
+	/** Hand every flagged watch to Visitor and clear its flag; removed watches are dropped afterwards */
+	void ConsumeChanges(TFunctionRef<void(const FEpicUnrealMCPPropertyWatchEntry&)> Visitor);
+
+	/** Block until a change is flagged or TimeoutMs passes; returns false at once if nothing is watched. Safe on any thread. */
+	bool WaitForChanges(uint32 TimeoutMs);
+
+	int32 Num() const { return Watches.Num(); }
+
+	/** Watch count, sweep timing and change counters for get_server_stats */
+	TSharedPtr<FJsonObject> GetStatsJson() const;
+
+private:
+	bool OnTick(float DeltaTime);
+	bool Hash(FEpicUnrealMCPPropertyWatchEntry& Entry, uint32& OutHash);
+	static uint32 HashValue(const FEpicUnrealMCPResolvedProperty& Resolved);
+	void Flag(FEpicUnrealMCPPropertyWatchEntry& Entry);
+
+	FEpicUnrealMCPPropertyResolver& Resolver;
+
+	TArray<FEpicUnrealMCPPropertyWatchEntry> Watches;
+	// Watches.Num() for WaitForChanges, which runs on the server thread
+	TAtomic<int32> NumWatches;
+	int32 NextId;
+	int32 Cursor;
+	double BudgetSeconds;
+	FDelegateHandle TickerHandle;
+
+	// Manual-reset event, triggered while any watch is flagged
+	FEvent* ChangedEvent;
+	int32 NumFlagged;
+
+	// Time of the last complete pass over every watch
+	double SweepStartTime;
+	double LastSweepSeconds;
+
+	uint64 Checks;
+	uint64 ChangesSeen;
+	uint64 Sweeps;
+	uint64 OverBudgetFrames;
+};
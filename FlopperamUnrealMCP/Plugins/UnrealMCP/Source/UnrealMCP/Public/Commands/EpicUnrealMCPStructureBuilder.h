@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * One distinct piece template of an expanded structure and every world
+ * transform it is placed at. The spec holds the spawn fields (type,
+ * blueprint_path, static_mesh, material, name, folder) with the
+ * structure defaults already merged in.
+ */
+struct FEpicUnrealMCPStructurePrimitive
+{
+	TSharedPtr<FJsonObject> Spec;
+	TArray<FTransform> Transforms;
+};
+
+/**
+ * Expands a declarative build_structure spec into placed primitives.
+ *
+ * Element kinds ("kind" field, default "primitive"):
+ *   primitive - a spawn spec; location/rotation/scale are local to the parent
+ *   group     - children under a shared local transform
+ *   repeat    - count copies stepping by offset and rotation
+ *   grid      - counts [X, Y, Z] at spacing [X, Y, Z], optionally centered
+ *   ring      - count copies on a circle of radius over arc degrees (spawn_pattern radial)
+ *   stack     - count floors stacked height apart ("floors" is an alias)
+ *   wall      - blocks filling start..end up to height, optional battlements
+ *
+ * Containers take their children in "elements" (array) or "element" (object).
+ * Each primitive is visited once with the full list of parent transforms,
+ * so expansion cost is linear in the number of placed pieces.
+ */
+class UNREALMCP_API FEpicUnrealMCPStructureBuilder
+{
+public:
+	static constexpr int32 MaxPieces = 100000;
+	static constexpr int32 MaxDepth = 16;
+
+	FEpicUnrealMCPStructureBuilder();
+
+	/** Expand the structure. Returns false and fills OutError on bad input or if MaxPieces is exceeded. */
+	bool Build(const TSharedPtr<FJsonObject>& StructureJson, FString& OutError);
+
+	const TArray<FEpicUnrealMCPStructurePrimitive>& GetPrimitives() const { return Primitives; }
+
+	int32 GetNumPieces() const { return NumPieces; }
+
+private:
+	bool ExpandElement(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, int32 Depth, FString& OutError);
+	bool ExpandChildren(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, int32 Depth, FString& OutError);
+	bool ExpandWall(const TSharedPtr<FJsonObject>& Element, const TArray<FTransform>& Parents, FString& OutError);
+	bool EmitPrimitive(const TSharedPtr<FJsonObject>& Element, TArray<FTransform>&& WorldTransforms, FString& OutError);
+
+	TSharedPtr<FJsonObject> MergeWithDefaults(const TSharedPtr<FJsonObject>& Element) const;
+
+	TSharedPtr<FJsonObject> Defaults;
+	TArray<FEpicUnrealMCPStructurePrimitive> Primitives;
+	int32 NumPieces;
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UStaticMeshComponent;
+class FEpicUnrealMCPActorFilter;
+
+/** Contents of one instanced static mesh component, in component space */
+struct UNREALMCP_API FEpicUnrealMCPInstanceRecord
+{
+	FName Component;
+	FString StaticMesh;
+	// Per-slot override material paths; empty entries keep the mesh default
+	TArray<FString> Materials;
+	TArray<FTransform> Instances;
+
+	friend FArchive& operator<<(FArchive& Ar, FEpicUnrealMCPInstanceRecord& Record);
+};
+
+/**
+ * Restorable state of one actor: class, label, outliner folder, transform,
+ * the root static mesh and its material overrides, the contents of instanced
+ * static mesh components, and editable actor properties that differ from
+ * the class defaults. Other component state is not recorded.
+ *
+ * Every record keeps a hash per property; the export text restore_world
+ * applies is only captured when asked for, since exporting is the bulk of
+ * the capture cost and must stay on the game thread.
+ */
+struct UNREALMCP_API FEpicUnrealMCPActorRecord
+{
+	FName Name;
+	// FEpicUnrealMCPActorIndex::GetLevelName of the actor's level; names are only unique per level
+	FName Level;
+	FString ClassPath;
+	FString Label;
+	FName FolderPath;
+	FTransform Transform;
+	FString StaticMesh;
+	TArray<FString> Materials;
+	TArray<FName> PropertyNames;
+	TArray<uint32> PropertyHashes;
+	// Export text per property; empty unless captured with bExportValues
+	TArray<FString> PropertyValues;
+	TArray<FEpicUnrealMCPInstanceRecord> InstanceGroups;
+
+	// Hash of everything but the name and level. Transforms are quantized, so float noise
+	// from re-applying a transform does not count as a change.
+	uint64 Hash = 0;
+
+	/** Level and name, which identify the actor across captures */
+	TPair<FName, FName> GetKey() const { return TPair<FName, FName>(Level, Name); }
+
+	/** Game thread only */
+	void Capture(AActor* Actor, bool bExportValues = true);
+
+	/**
+	 * Capture many actors. Reading actor state (labels, export text) is only
+	 * safe on the game thread, so the records are filled there and only the
+	 * hashing is spread across worker threads. Comparisons only need the
+	 * hashes; pass bExportValues = false unless the records will be restored.
+	 */
+	static void CaptureAll(const TArray<AActor*>& Actors, TArray<FEpicUnrealMCPActorRecord>& OutRecords, bool bExportValues = true);
+
+	/** Editable, non-transient actor properties whose value differs from the class defaults */
+	static void ExportNonDefaultProperties(AActor* Actor, TArray<FName>& OutNames, TArray<FString>& OutValues);
+
+	/** The root component if it is a plain (non-instanced) static mesh component */
+	static UStaticMeshComponent* GetMeshComponent(AActor* Actor);
+
+	friend FArchive& operator<<(FArchive& Ar, FEpicUnrealMCPActorRecord& Record);
+
+private:
+	void ReadActor(AActor* Actor, bool bExportValues);
+	uint64 ComputeHash();
+};
+
+/**
+ * Actors captured by snapshot_world.
+ *
+ * Snapshots stay in memory and can be written to a flat, versioned binary
+ * file (Saved/MCPSnapshots/<name>.mcpsnap) that loads back with a single
+ * read. Records are looked up by level and actor name.
+ */
+class UNREALMCP_API FEpicUnrealMCPWorldSnapshot
+{
+public:
+	static constexpr uint32 FileMagic = 0x534E504D;
+	static constexpr int32 FileVersion = 3;
+
+	FString Name;
+	FString MapName;
+	// Filter fields that defined the snapshot's scope, as JSON; empty for the whole level
+	FString FilterJson;
+	FDateTime Created;
+	TArray<FEpicUnrealMCPActorRecord> Actors;
+
+	/** World settings, the builder brush and transient actors cannot be respawned and are never captured */
+	static bool CanCapture(const AActor* Actor);
+
+	static FString GetFilePath(const FString& SnapshotName);
+
+	/** Replace the records with captures of Actors */
+	void CaptureActors(const TArray<AActor*>& InActors);
+
+	/** The filter stored in FilterJson; an empty filter means the whole level */
+	bool CompileFilter(FEpicUnrealMCPActorFilter& OutFilter) const;
+
+	const FEpicUnrealMCPActorRecord* FindRecord(FName LevelName, FName ActorName) const;
+
+	void SaveToBytes(TArray<uint8>& OutBytes);
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+private:
+	void Serialize(FArchive& Ar);
+	void BuildIndex();
+
+	TMap<TPair<FName, FName>, int32> RecordIndex;
+};
+
+/**
+ * Per-actor differences between two sets of records, matched by level and
+ * actor name.
+ *
+ * Records with equal hashes are unchanged. The rest are compared field by
+ * field on worker threads; an actor can be both moved and changed.
+ */
+struct UNREALMCP_API FEpicUnrealMCPWorldDiff
+{
+	// Indices into the target records
+	TArray<int32> Added;
+	// Indices into the base records
+	TArray<int32> Removed;
+	// (base, target) index pairs whose transform differs
+	TArray<TPair<int32, int32>> Moved;
+	// (base, target) index pairs with other differences, and what differs for each
+	TArray<TPair<int32, int32>> Changed;
+	TArray<TArray<FString>> ChangedFields;
+	int32 NumUnchanged = 0;
+
+	void Compute(const TArray<FEpicUnrealMCPActorRecord>& Base, const TArray<FEpicUnrealMCPActorRecord>& Target);
+};
@@ -68,6 +68,9 @@ public class UnrealMCP : ModuleRules
 		// - KismetCompiler (simplifying for core features)
 		// - DeveloperSettings (not needed for core features)
 
+		// ICU directly, to validate regex patterns before FRegexMatcher sees them
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "ICU");
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -0,0 +1,87 @@
+"""
+Time 10k single-actor transform edits with and without a bulk edit scope.
+Run with the editor open and the plugin listening.
+
+Usage: python bench_bulk_edit.py [actor_count]
+
+The actors are spawned once into the BenchBulkEdit folder and moved twice:
+first with per-edit notifications, then inside begin_bulk_edit/end_bulk_edit.
+"""
+import json
+import socket
+import sys
+import time
+
+HOST, PORT = "127.0.0.1", 55557
+CUBE = "/Engine/BasicShapes/Cube.Cube"
+FOLDER = "BenchBulkEdit"
+
+
+def send(command_type, params):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.settimeout(300)
+    sock.connect((HOST, PORT))
+    try:
+        sock.sendall(json.dumps({"type": command_type, "params": params}).encode("utf-8"))
+        response_data = b""
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            response_data += chunk
+            try:
+                return json.loads(response_data.decode("utf-8"))
+            except (json.JSONDecodeError, UnicodeDecodeError):
+                continue
+        return None
+    finally:
+        sock.close()
+
+
+def spawn_grid(count):
+    side = int(count ** 0.5) + 1
+    specs = [{
+        "name": f"{FOLDER}_{i}",
+        "type": "StaticMeshActor",
+        "static_mesh": CUBE,
+        "location": [(i % side) * 150.0, (i // side) * 150.0, 50.0],
+        "folder": FOLDER,
+    } for i in range(count)]
+    response = send("spawn_actors", {"actors": specs, "unique_names": True, "return_names": True})
+    return [name for name in (response or {}).get("names", []) if name]
+
+
+def move_all(names, scale_z):
+    start = time.perf_counter()
+    for name in names:
+        send("set_actor_transform", {"name": name, "scale": [1.0, 1.0, scale_z]})
+    return time.perf_counter() - start
+
+
+def run(label, names, scale_z, bulk):
+    if bulk:
+        send("begin_bulk_edit", {"timeout": 600})
+    elapsed = move_all(names, scale_z)
+    flush = None
+    if bulk:
+        start = time.perf_counter()
+        flush = send("end_bulk_edit", {})
+        elapsed += time.perf_counter() - start
+    print(f"{label:>10}: {len(names)} edits in {elapsed * 1000:.0f} ms "
+          f"({elapsed * 1e6 / max(len(names), 1):.0f} us/edit)")
+    if flush:
+        print(f"            flush: {flush.get('moved', 0)} moves, {flush.get('packages', 0)} packages "
+              f"in {flush.get('flush_ms', 0):.1f} ms")
+
+
+if __name__ == "__main__":
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+
+    names = spawn_grid(count)
+    print(f"spawned {len(names)} actors into folder {FOLDER}")
+
+    run("per-edit", names, 2.0, False)
+    run("bulk", names, 3.0, True)
+
+    stats = send("get_server_stats", {})
+    print("bulk_edit stats:", json.dumps((stats or {}).get("bulk_edit", {})))
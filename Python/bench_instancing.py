@@ -0,0 +1,80 @@
+"""
+Compare building a castle-sized block layout as separate StaticMeshActors
+versus HISM instances. Run with the editor open and the plugin listening.
+
+Usage: python bench_instancing.py [blocks_per_side] [layers]
+
+Frame time has to be read in the editor (console: stat unit) after each run.
+"""
+import json
+import socket
+import sys
+import time
+
+HOST, PORT = "127.0.0.1", 55557
+CUBE = "/Engine/BasicShapes/Cube.Cube"
+
+
+def send(command_type, params):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.settimeout(300)
+    sock.connect((HOST, PORT))
+    try:
+        sock.sendall(json.dumps({"type": command_type, "params": params}).encode("utf-8"))
+        response_data = b""
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            response_data += chunk
+            try:
+                return json.loads(response_data.decode("utf-8"))
+            except (json.JSONDecodeError, UnicodeDecodeError):
+                continue
+        return None
+    finally:
+        sock.close()
+
+
+def castle_walls(prefix, blocks_per_side, layers, size=100.0):
+    """Four walls of blocks around a square courtyard, like build_outer_bailey_walls."""
+    specs = []
+    half = blocks_per_side * size / 2.0
+    for layer in range(layers):
+        z = layer * size + size / 2.0
+        for i in range(blocks_per_side):
+            offset = -half + i * size
+            for side, (x, y) in enumerate([(offset, -half), (offset, half), (-half, offset), (half, offset)]):
+                specs.append({
+                    "name": f"{prefix}_{layer}_{i}_{side}",
+                    "type": "StaticMeshActor",
+                    "static_mesh": CUBE,
+                    "location": [x, y, z],
+                    "folder": prefix,
+                })
+    return specs
+
+
+def run(label, specs, instanced):
+    start = time.perf_counter()
+    response = send("spawn_actors", {"actors": specs, "unique_names": True, "instanced": instanced})
+    elapsed = time.perf_counter() - start
+    spawned = response.get("spawned", 0) if response else 0
+    print(f"{label:>10}: {spawned} blocks in {elapsed * 1000:.0f} ms")
+    print("            check 'stat unit' in the editor now, then press Enter")
+    input()
+
+
+if __name__ == "__main__":
+    blocks_per_side = int(sys.argv[1]) if len(sys.argv) > 1 else 50
+    layers = int(sys.argv[2]) if len(sys.argv) > 2 else 10
+
+    run("actors", castle_walls("BenchActors", blocks_per_side, layers), False)
+    run("instanced", castle_walls("BenchInstanced", blocks_per_side, layers), True)
+
+    # Converting the actor version should land in the same group as the instanced run
+    start = time.perf_counter()
+    response = send("convert_to_instances", {"folder": "BenchActors"})
+    elapsed = time.perf_counter() - start
+    converted = response.get("converted_count", 0) if response else 0
+    print(f"   convert: {converted} actors in {elapsed * 1000:.0f} ms")
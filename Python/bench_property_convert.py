@@ -0,0 +1,72 @@
+"""
+Time row-to-JSON conversion over every row of a DataTable.
+Run with the editor open and the plugin listening.
+
+Usage: python bench_property_convert.py <data_table_path> [passes]
+
+Pick a table with a wide row struct (dozens of fields, nested structs and
+arrays). get_data_table_row reports the server-side conversion time as
+convert_ms. The first pass includes compiling the row struct plans; later
+passes reuse them. Run the same table against a build from before the
+conversion plans for the baseline (convert_ms is missing there, so compare
+the round-trip column).
+"""
+import json
+import socket
+import sys
+import time
+
+HOST, PORT = "127.0.0.1", 55557
+
+
+def send(command_type, params):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.settimeout(300)
+    sock.connect((HOST, PORT))
+    try:
+        sock.sendall(json.dumps({"type": command_type, "params": params}).encode("utf-8"))
+        response_data = b""
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            response_data += chunk
+            try:
+                return json.loads(response_data.decode("utf-8"))
+            except (json.JSONDecodeError, UnicodeDecodeError):
+                continue
+        return None
+    finally:
+        sock.close()
+
+
+def run_pass(label, table, rows):
+    convert_ms = 0.0
+    fields = 0
+    start = time.perf_counter()
+    for row in rows:
+        response = send("get_data_table_row", {"data_table_path": table, "row_name": row}) or {}
+        convert_ms += response.get("convert_ms", 0.0)
+        fields += len(response.get("row_data", {}))
+    elapsed = time.perf_counter() - start
+    print(f"{label:>8}: {len(rows)} rows, {fields} fields | round trip {elapsed * 1000:.0f} ms "
+          f"| convert {convert_ms:.2f} ms ({convert_ms * 1000 / max(fields, 1):.2f} us/field)")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    table = sys.argv[1]
+    passes = int(sys.argv[2]) if len(sys.argv) > 2 else 3
+
+    listing = send("list_data_table_rows", {"data_table_path": table}) or {}
+    rows = listing.get("row_names", [])
+    print(f"{table}: {len(rows)} rows of {listing.get('row_struct', '?')}")
+
+    for i in range(passes):
+        run_pass("cold" if i == 0 else f"warm {i}", table, rows)
+
+    stats = send("get_server_stats", {})
+    print("property_conversion stats:", json.dumps((stats or {}).get("property_conversion", {})))
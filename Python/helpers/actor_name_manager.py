@@ -8,7 +8,7 @@ Prevents duplicate name errors by automatically generating unique names and trac
 import logging
 import time
 import uuid
-from typing import Dict, Any, Set, Optional
+from typing import Dict, Any, List, Set, Optional
 
 # Configure logging
 logger = logging.getLogger("ActorNameManager")
@@ -186,6 +186,37 @@ def safe_spawn_actor(unreal_connection, params: Dict[str, Any], auto_unique_name
         logger.error(f"Error in safe_spawn_actor: {e}")
         return {"success": False, "status": "error", "error": str(e)}
 
+def safe_spawn_actors(unreal_connection, params_list: List[Dict[str, Any]]) -> Dict[str, Any]:
+    """
+    Spawn a batch of actors with one spawn_actors request.
+
+    Unreal resolves name clashes itself (unique_names), so no per-actor
+    find_actors_by_name round trips are needed.
+
+    Args:
+        unreal_connection: The Unreal connection to use
+        params_list: List of spawn_actor parameter dicts
+
+    Returns:
+        Response from Unreal Engine; result["names"] holds the final name per spec
+    """
+    if not unreal_connection:
+        return {"success": False, "status": "error", "error": "No Unreal connection available"}
+
+    try:
+        response = unreal_connection.send_command("spawn_actors", {"actors": params_list, "unique_names": True})
+
+        if response and response.get("status") == "success":
+            for name in response.get("result", {}).get("names", []):
+                if name:
+                    _global_actor_name_manager.mark_actor_created(name)
+
+        return response or {"success": False, "status": "error", "error": "No response from Unreal"}
+
+    except Exception as e:
+        logger.error(f"Error in safe_spawn_actors: {e}")
+        return {"success": False, "status": "error", "error": str(e)}
+
 def safe_delete_actor(unreal_connection, actor_name: str) -> Dict[str, Any]:
     """
     Safely delete an actor and update the name tracking.
@@ -441,17 +441,25 @@ def editor_create_object(
     location: List[float] = None,
     rotation: List[float] = None,
     scale: List[float] = None,
-    static_mesh: str = ""
+    static_mesh: str = "",
+    material: str = "",
+    instanced: bool = False,
+    async_load: bool = False
 ) -> Dict[str, Any]:
     """Create a new object/actor in the world.
 
     Args:
-        name: Unique name for the actor
+        name: Unique name for the actor (ignored when instanced)
         actor_type: Type of actor (StaticMeshActor, PointLight, SpotLight, DirectionalLight, CameraActor)
         location: [X, Y, Z] position in the world
         rotation: [Pitch, Yaw, Roll] rotation in degrees
         scale: [X, Y, Z] scale factors
         static_mesh: Path to static mesh asset (for StaticMeshActor)
+        material: Optional material for slot 0 (for StaticMeshActor)
+        instanced: Add an instance to the shared HISM group for this mesh/material
+            instead of spawning a StaticMeshActor. Returns the group actor name and instance_index.
+        async_load: Stream in an unloaded mesh/material without blocking the editor and
+            return {pending, job_id}; poll get_async_job for the spawn result
     """
     unreal = get_unreal_connection()
     try:
@@ -467,6 +475,12 @@ def editor_create_object(
             params["scale"] = scale
         if static_mesh:
             params["static_mesh"] = static_mesh
+        if material:
+            params["material"] = material
+        if instanced:
+            params["instanced"] = True
+        if async_load:
+            params["async"] = True
 
         response = unreal.send_command("spawn_actor", params)
         return response or {"success": False, "message": "No response from Unreal"}
@@ -533,16 +547,45 @@ def editor_delete_object(name: str) -> Dict[str, Any]:
 # Tool 12: Get Actor Property
 # ============================================================================
 @mcp.tool()
-def get_actor_property(name: str, property: str) -> Dict[str, Any]:
+def get_actor_property(
+    name: str,
+    property: str = "",
+    max_elements: int = 500,
+    max_depth: int = 8,
+    offset: int = 0,
+    continuation: str = "",
+    packed: bool = False
+) -> Dict[str, Any]:
     """Get a property value from an actor.
 
     Args:
         name: Name of the actor
-        property: Name of the property to get
+        property: Name of the property to get or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
+        max_elements: Containers longer than this come back as a slice
+            {_truncated, type, count, offset, items, continuation}; 0 = no limit
+        max_depth: Structs and containers nested deeper than this come back as
+            {_truncated, type, count, continuation}; 0 = no limit
+        offset: First element to return when the property itself is a container
+        continuation: Token from a truncated value; fetches the next slice and
+            replaces property and offset
+        packed: Return arrays of numbers and of all-numeric structs (vectors, colors)
+            as {encoding: "base64", element, components, fields, count, data} with
+            data the little-endian array memory, e.g. decode f32 with
+            struct.unpack(f"<{count * components}f", base64.b64decode(data))
     """
     unreal = get_unreal_connection()
     try:
         params = {"name": name, "property": property}
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if continuation:
+            params["continuation"] = continuation
+        elif offset:
+            params["offset"] = offset
+        if packed:
+            params["packed"] = True
         response = unreal.send_command("get_actor_property", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -559,8 +602,10 @@ def set_actor_property(name: str, property: str, value: Any) -> Dict[str, Any]:
 
     Args:
         name: Name of the actor
-        property: Name of the property to set
+        property: Name of the property to set or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
         value: The value to set (type depends on property)
+            Numeric arrays may also be given in the packed form returned with packed=True;
+            its element, components and fields must match the target array exactly
     """
     unreal = get_unreal_connection()
     try:
@@ -576,16 +621,45 @@ def set_actor_property(name: str, property: str, value: Any) -> Dict[str, Any]:
 # Tool 14: Get Asset Property
 # ============================================================================
 @mcp.tool()
-def get_asset_property(asset_path: str, property: str) -> Dict[str, Any]:
+def get_asset_property(
+    asset_path: str,
+    property: str = "",
+    max_elements: int = 500,
+    max_depth: int = 8,
+    offset: int = 0,
+    continuation: str = "",
+    packed: bool = False
+) -> Dict[str, Any]:
     """Get a property value from a Data Asset or any UObject asset.
 
     Args:
         asset_path: Path to the asset (e.g., "/Game/Data/DA_GameDifficultySettings")
-        property: Name of the property to get
+        property: Name of the property to get or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
+        max_elements: Containers longer than this come back as a slice
+            {_truncated, type, count, offset, items, continuation}; 0 = no limit
+        max_depth: Structs and containers nested deeper than this come back as
+            {_truncated, type, count, continuation}; 0 = no limit
+        offset: First element to return when the property itself is a container
+        continuation: Token from a truncated value; fetches the next slice and
+            replaces property and offset
+        packed: Return arrays of numbers and of all-numeric structs (vectors, colors)
+            as {encoding: "base64", element, components, fields, count, data} with
+            data the little-endian array memory, e.g. decode f32 with
+            struct.unpack(f"<{count * components}f", base64.b64decode(data))
     """
     unreal = get_unreal_connection()
     try:
         params = {"asset_path": asset_path, "property": property}
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if continuation:
+            params["continuation"] = continuation
+        elif offset:
+            params["offset"] = offset
+        if packed:
+            params["packed"] = True
         response = unreal.send_command("get_asset_property", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -602,8 +676,10 @@ def set_asset_property(asset_path: str, property: str, value: Any) -> Dict[str,
 
     Args:
         asset_path: Path to the asset (e.g., "/Game/Data/DA_GameDifficultySettings")
-        property: Name of the property to set
+        property: Name of the property to set or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
         value: The value to set (type depends on property - supports arrays, maps, structs)
+            Numeric arrays may also be given in the packed form returned with packed=True;
+            its element, components and fields must match the target array exactly
     """
     unreal = get_unreal_connection()
     try:
@@ -668,6 +744,8 @@ def set_data_table_row_field(data_table_path: str, row_name: str, field_name: st
         row_name: Name of the row to modify
         field_name: Name of the field to set
         value: The value to set (supports arrays, maps, structs)
+            Numeric arrays may also be given in the packed form returned with packed=True;
+            its element, components and fields must match the target array exactly
     """
     unreal = get_unreal_connection()
     try:
@@ -781,7 +859,8 @@ def spawn_blueprint_actor(
     blueprint_path: str,
     actor_name: str,
     location: List[float] = None,
-    rotation: List[float] = None
+    rotation: List[float] = None,
+    async_load: bool = False
 ) -> Dict[str, Any]:
     """Spawn an actor from a Blueprint class.
 
@@ -790,6 +869,8 @@ def spawn_blueprint_actor(
         actor_name: Unique name for the new actor
         location: Optional [X, Y, Z] spawn location
         rotation: Optional [Pitch, Yaw, Roll] spawn rotation
+        async_load: If the class is not loaded yet, stream it in without blocking the
+            editor and return {pending, job_id}; poll get_async_job for the spawn result
     """
     unreal = get_unreal_connection()
     try:
@@ -798,6 +879,8 @@ def spawn_blueprint_actor(
             params["location"] = location
         if rotation:
             params["rotation"] = rotation
+        if async_load:
+            params["async"] = True
         response = unreal.send_command("spawn_blueprint_actor", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -862,16 +945,45 @@ def rename_actor(name: str, new_name: str) -> Dict[str, Any]:
 # Tool 23: Get Blueprint Default Property
 # ============================================================================
 @mcp.tool()
-def get_blueprint_default_property(blueprint_path: str, property: str) -> Dict[str, Any]:
+def get_blueprint_default_property(
+    blueprint_path: str,
+    property: str = "",
+    max_elements: int = 500,
+    max_depth: int = 8,
+    offset: int = 0,
+    continuation: str = "",
+    packed: bool = False
+) -> Dict[str, Any]:
     """Get a default property value from a Blueprint's Class Default Object (CDO).
 
     Args:
         blueprint_path: Path to the Blueprint asset
-        property: Name of the property to get
+        property: Name of the property to get or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
+        max_elements: Containers longer than this come back as a slice
+            {_truncated, type, count, offset, items, continuation}; 0 = no limit
+        max_depth: Structs and containers nested deeper than this come back as
+            {_truncated, type, count, continuation}; 0 = no limit
+        offset: First element to return when the property itself is a container
+        continuation: Token from a truncated value; fetches the next slice and
+            replaces property and offset
+        packed: Return arrays of numbers and of all-numeric structs (vectors, colors)
+            as {encoding: "base64", element, components, fields, count, data} with
+            data the little-endian array memory, e.g. decode f32 with
+            struct.unpack(f"<{count * components}f", base64.b64decode(data))
     """
     unreal = get_unreal_connection()
     try:
         params = {"blueprint_path": blueprint_path, "property": property}
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if continuation:
+            params["continuation"] = continuation
+        elif offset:
+            params["offset"] = offset
+        if packed:
+            params["packed"] = True
         response = unreal.send_command("get_blueprint_default_property", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -888,8 +1000,10 @@ def set_blueprint_default_property(blueprint_path: str, property: str, value: An
 
     Args:
         blueprint_path: Path to the Blueprint asset
-        property: Name of the property to set
+        property: Name of the property to set or nested path (e.g. "StaticMeshComponent.RelativeLocation.X", "Items[2].Count", "Stats{Health}")
         value: The value to set (supports arrays, maps, structs)
+            Numeric arrays may also be given in the packed form returned with packed=True;
+            its element, components and fields must match the target array exactly
     """
     unreal = get_unreal_connection()
     try:
@@ -956,21 +1070,1346 @@ def editor_move_camera(
 # Bonus: Find Actors By Name (enhanced search)
 # ============================================================================
 @mcp.tool()
-def find_actors_by_name(pattern: str) -> Dict[str, Any]:
-    """Find actors by name pattern.
+def find_actors_by_name(
+    pattern: str = "",
+    match_mode: str = "contains",
+    case_sensitive: bool = True,
+    match_field: str = "name",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0
+) -> Dict[str, Any]:
+    """Find actors by name pattern and optional class/tag/folder/bounds predicates.
+
+    The query is compiled once in Unreal and evaluated server-side, so prefer
+    narrowing here over fetching every actor and filtering client-side.
 
     Args:
-        pattern: Pattern to match actor names (case-sensitive substring match)
+        pattern: Pattern to match actor names (empty matches everything)
+        match_mode: "contains" (substring), "exact", "glob" (* and ?) or "regex"
+        case_sensitive: Whether the name match is case-sensitive
+        match_field: "name" (object name), "label" (outliner label) or "either"
+        class_name: Only actors of this class or a subclass (e.g. "StaticMeshActor")
+        tags: Only actors carrying all of these tags
+        folder: Only actors in this outliner folder or its subfolders
+        bounds_min: [X, Y, Z] minimum corner of a box the actor location must lie in
+        bounds_max: [X, Y, Z] maximum corner of that box
+        max_results: Stop after this many matches (0 = unlimited)
     """
     unreal = get_unreal_connection()
     try:
-        response = unreal.send_command("find_actors_by_name", {"pattern": pattern})
+        params = {
+            "pattern": pattern,
+            "match_mode": match_mode,
+            "case_sensitive": case_sensitive,
+            "match_field": match_field
+        }
+        if class_name:
+            params["class"] = class_name
+        if tags:
+            params["tags"] = tags
+        if folder:
+            params["folder"] = folder
+        if bounds_min is not None and bounds_max is not None:
+            params["bounds_min"] = bounds_min
+            params["bounds_max"] = bounds_max
+        if max_results > 0:
+            params["max_results"] = max_results
+
+        response = unreal.send_command("find_actors_by_name", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
         logger.error(f"find_actors_by_name error: {e}")
         return {"success": False, "message": str(e)}
 
 
+# ============================================================================
+# Server Stats
+# ============================================================================
+@mcp.tool()
+def get_server_stats() -> Dict[str, Any]:
+    """Get plugin-side cache statistics.
+
+    Returns:
+        asset_cache: entries, hits, misses, load_failures, invalidations, hit_rate
+        actor_index: number of indexed actors
+        async_jobs: async load jobs not yet released
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("get_server_stats", {})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_server_stats error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def reload_notify_policy() -> Dict[str, Any]:
+    """Re-read the struct sub-property notify rules from the Editor ini files on disk.
+
+    Rules live under [UnrealMCP.NotifyPolicy] in Config/DefaultEditor.ini; edits
+    there take effect after this call without restarting the editor.
+
+    Returns:
+        rules (number of rules loaded)
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("reload_notify_policy", {})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"reload_notify_policy error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Bulk Actor Tools
+# ============================================================================
+@mcp.tool()
+def get_actor_transforms_bulk(
+    pattern: str = "",
+    class_name: str = "",
+    folder: str = "",
+    max_results: int = 0
+) -> Dict[str, Any]:
+    """Get the transforms of every actor (or a filtered subset) in one columnar snapshot.
+
+    The result holds a names table plus packed arrays instead of one object per actor:
+        names: actor names joined by "\\n"
+        locations / rotations / scales: base64 of little-endian float32, 3 values per actor
+        (X, Y, Z / Pitch, Yaw, Roll / X, Y, Z), in the same order as names.
+    Decode with e.g. struct.unpack(f"<{count * 3}f", base64.b64decode(result["locations"])).
+
+    Args:
+        pattern: Optional substring filter on actor names
+        class_name: Optional class filter (subclasses included)
+        folder: Optional outliner folder filter
+        max_results: Stop after this many actors (0 = unlimited)
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {}
+        if pattern:
+            params["pattern"] = pattern
+        if class_name:
+            params["class"] = class_name
+        if folder:
+            params["folder"] = folder
+        if max_results > 0:
+            params["max_results"] = max_results
+        response = unreal.send_command("get_actor_transforms_bulk", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_actor_transforms_bulk error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def spawn_actors(
+    actors: List[Dict[str, Any]],
+    unique_names: bool = False,
+    instanced: bool = False,
+    async_load: bool = False,
+    no_undo: bool = False
+) -> Dict[str, Any]:
+    """Spawn many actors in one request.
+
+    Classes and meshes are resolved once for the whole batch, actors are spawned with
+    deferred construction and finished in a single sweep. Much cheaper than one
+    spawn_actor call per block.
+
+    Args:
+        actors: List of specs. Each spec takes the spawn_actor fields:
+            name, type (StaticMeshActor, PointLight, SpotLight, DirectionalLight, CameraActor)
+            or blueprint_path or class (full class path), location, rotation, scale, static_mesh,
+            material (slot 0) or materials (one path or null per slot), properties
+            ({name: exported text}), and optional folder.
+        unique_names: If a name is taken, spawn under a unique variant instead of failing
+        instanced: StaticMeshActor specs with a static_mesh become instances of one
+            HISM group per mesh/material instead of separate actors. Use this for
+            walls, floors and other repeated blocks. Instances have no name or folder
+            of their own; specs that set them are listed in warnings.
+        async_load: Stream in every unloaded class/mesh/material first without blocking
+            the editor. Returns {pending, job_id} if anything had to load; the batch
+            result is then delivered by get_async_job.
+        no_undo: Do not record an undo transaction (for very large generated content)
+
+    Returns:
+        names: actual actor name per spec (null for failures; the group actor for instances),
+        instance_indices: instance index per spec when instanced,
+        warnings: [{index, ignored, warning}] when instanced, errors: [{index, error}]
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"actors": actors, "unique_names": unique_names, "instanced": instanced}
+        if async_load:
+            params["async"] = True
+        if no_undo:
+            params["no_undo"] = True
+        response = unreal.send_command("spawn_actors", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"spawn_actors error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def convert_to_instances(
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    keep_source: bool = False
+) -> Dict[str, Any]:
+    """Collapse matching StaticMeshActors into HISM instance groups.
+
+    Actors are grouped by mesh and material overrides; each group gets one actor
+    holding a HierarchicalInstancedStaticMeshComponent. Takes the same filter fields
+    as find_actors_by_name; at least one is required.
+
+    Args:
+        pattern: Name pattern
+        match_mode: "contains", "exact", "glob" or "regex"
+        class_name: Restrict to a StaticMeshActor subclass
+        tags: Actor tags that must all be present
+        folder: Outliner folder (subfolders included)
+        bounds_min: [X, Y, Z] corner of a box the actor location must be in
+        bounds_max: [X, Y, Z] opposite corner
+        max_results: Convert at most this many actors (0 = unlimited)
+        keep_source: Keep the original actors instead of deleting them
+
+    Returns:
+        groups: [{actor, mesh, added, instance_count}],
+        converted: [{source, group, index}] mapping each source actor to its instance
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"pattern": pattern, "match_mode": match_mode, "keep_source": keep_source}
+        if class_name:
+            params["class"] = class_name
+        if tags:
+            params["tags"] = tags
+        if folder:
+            params["folder"] = folder
+        if bounds_min and bounds_max:
+            params["bounds_min"] = bounds_min
+            params["bounds_max"] = bounds_max
+        if max_results:
+            params["max_results"] = max_results
+        response = unreal.send_command("convert_to_instances", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"convert_to_instances error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+def _actor_query_params(names, pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results):
+    """Selection fields shared by the query-driven bulk commands."""
+    if names:
+        return {"names": names}
+    params = {"pattern": pattern, "match_mode": match_mode}
+    if class_name:
+        params["class"] = class_name
+    if tags:
+        params["tags"] = tags
+    if folder:
+        params["folder"] = folder
+    if bounds_min and bounds_max:
+        params["bounds_min"] = bounds_min
+        params["bounds_max"] = bounds_max
+    if max_results:
+        params["max_results"] = max_results
+    return params
+
+
+@mcp.tool()
+def set_actor_transforms(
+    actors: List[Dict[str, Any]] = None,
+    delta: bool = False,
+    operation: Dict[str, Any] = None,
+    names: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0
+) -> Dict[str, Any]:
+    """Move many actors in one request, with one notification flush at the end.
+
+    Per-actor mode - pass actors:
+        [{"name": "Wall_1", "location": [X,Y,Z], "rotation": [P,Y,R], "scale": [X,Y,Z] or number}, ...]
+        With delta=True values are offsets: location is added, rotation is applied
+        on top, scale multiplies.
+
+    Group mode - pass operation plus names or the find_actors_by_name filter fields:
+        {"type": "translate", "offset": [X,Y,Z]}
+        {"type": "rotate", "rotation": [P,Y,R], "pivot": ...}
+        {"type": "scale", "scale": [X,Y,Z] or number, "pivot": ...}
+        {"type": "mirror", "plane_normal": [X,Y,Z], "pivot": ...}
+        pivot is [X,Y,Z], "center" (default, center of the group's bounds) or "centroid".
+
+    Returns:
+        moved count and missing names
+    """
+    unreal = get_unreal_connection()
+    try:
+        if actors is not None:
+            params = {"actors": actors, "delta": delta}
+        else:
+            params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                         bounds_min, bounds_max, max_results)
+            params["operation"] = operation or {}
+        response = unreal.send_command("set_actor_transforms", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_actor_transforms error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def delete_actors(
+    names: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    dry_run: bool = False,
+    return_names: bool = False
+) -> Dict[str, Any]:
+    """Delete every actor picked by names or the find_actors_by_name filter.
+
+    Runs as a single undo step. At least one filter field is required so the
+    whole level cannot be deleted by accident. World settings and the builder
+    brush are always skipped.
+
+    Args:
+        names: Explicit actor names; if given the filter fields are ignored
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results:
+            Same filter as find_actors_by_name
+        dry_run: Only report what would be deleted
+        return_names: Include the matched actor names
+
+    Returns:
+        count, deleted, classes (count per class), skipped, missing
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, max_results)
+        params["dry_run"] = dry_run
+        params["return_names"] = return_names
+        response = unreal.send_command("delete_actors", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"delete_actors error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_actors_folder(
+    new_folder: str,
+    names: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    dry_run: bool = False
+) -> Dict[str, Any]:
+    """Move every actor picked by names or the find_actors_by_name filter into an outliner folder.
+
+    Runs as a single undo step.
+
+    Args:
+        new_folder: Destination folder path (e.g. "Castle/Walls"); "" moves to the root
+        names: Explicit actor names; if given the filter fields are ignored
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results:
+            Same filter as find_actors_by_name (folder is the source folder)
+        dry_run: Only report what would be moved
+
+    Returns:
+        count, moved, already_in_folder, classes (count per class), missing
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, max_results)
+        params["new_folder"] = new_folder
+        params["dry_run"] = dry_run
+        response = unreal.send_command("set_actors_folder", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_actors_folder error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Async Asset Loading Tools
+# ============================================================================
+@mcp.tool()
+def preload_assets(paths: List[str]) -> Dict[str, Any]:
+    """Start loading assets in the background so later spawns do not hitch.
+
+    Args:
+        paths: Object paths of meshes, materials or Blueprint classes
+            (e.g. "/Game/Blueprints/BP_Tower.BP_Tower_C")
+
+    Returns:
+        job_id to pass to get_async_job. The loaded assets stay resident until
+        the job is released, or until a finished job expires (10 minutes after
+        it completes, or sooner once more than 64 finished jobs are waiting).
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("preload_assets", {"paths": paths})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"preload_assets error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_async_job(job_id: int, release: bool = False) -> Dict[str, Any]:
+    """Poll an async load started by preload_assets or a spawn with async_load.
+
+    Args:
+        job_id: Id returned by the starting command
+        release: Drop a preload job and let its assets be garbage collected.
+            Spawn jobs are released automatically once their result is returned.
+            Finished jobs that are never polled expire 10 minutes after they
+            complete, or oldest first once more than 64 are waiting; polling an
+            expired job reports it as unknown.
+
+    Returns:
+        status ("loading" or "complete"), progress, elapsed_ms, loaded/failed paths,
+        and for spawn jobs the spawn command's result
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("get_async_job", {"job_id": job_id, "release": release})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_async_job error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Structure Builder Tools
+# ============================================================================
+@mcp.tool()
+def build_structure(
+    name: str,
+    elements: List[Dict[str, Any]],
+    location: List[float] = None,
+    rotation: List[float] = None,
+    defaults: Dict[str, Any] = None,
+    instanced: bool = True,
+    return_names: bool = False,
+    async_load: bool = False,
+    no_undo: bool = False
+) -> Dict[str, Any]:
+    """Build a whole structure from a declarative spec in a single request.
+
+    The spec is expanded inside Unreal and spawned in one batch, so a castle of
+    thousands of blocks costs one round trip instead of one per block.
+
+    Every element has an optional "kind" (default "primitive") and an optional
+    local location/rotation/scale relative to its parent. Containers take their
+    children in "elements" (list) or "element" (single object).
+        primitive: spawn fields (type, static_mesh, material, blueprint_path, name, folder)
+        group:     children under a shared transform
+        repeat:    count, offset [X,Y,Z], rotation_step [P,Y,R]
+        grid:      counts [X,Y,Z], spacing [X,Y,Z], centered
+        ring:      count, radius, start_angle, arc (degrees, default 360), face_outward,
+                   rings, ring_spacing, proportional (same fields as spawn_pattern radial)
+        stack:     count, height (alias "floors")
+        wall:      start, end, height, thickness, segment_length, segment_height,
+                   battlements, merlon_height, unit_size (mesh edge at scale 1, default 100)
+
+    Example - four walls with battlements and a ring of towers:
+        defaults={"type": "StaticMeshActor", "static_mesh": "/Engine/BasicShapes/Cube.Cube"}
+        elements=[
+            {"kind": "ring", "count": 4, "radius": 2000, "start_angle": 45, "face_outward": True,
+             "element": {"kind": "stack", "count": 6, "height": 200,
+                         "element": {"static_mesh": "/Engine/BasicShapes/Cylinder.Cylinder",
+                                     "scale": [4, 4, 2]}}},
+            {"kind": "ring", "count": 4, "radius": 1414, "start_angle": 0,
+             "element": {"kind": "wall", "start": [0, -1414, 0], "end": [0, 1414, 0],
+                         "height": 800, "battlements": True}},
+        ]
+
+    Args:
+        name: Structure name, used as actor name prefix and outliner folder
+        elements: Top-level elements
+        location: [X, Y, Z] origin of the structure
+        rotation: [Pitch, Yaw, Roll] of the structure
+        defaults: Spawn fields applied to every primitive unless overridden
+        instanced: Emit static mesh pieces as HISM instances (default True)
+        return_names: Include per-piece names and instance indices in the result
+        async_load: Stream in unloaded assets first; returns {pending, job_id}
+        no_undo: Do not record an undo transaction (for very large generated content)
+
+    Returns:
+        pieces, primitives, spawned, failed, errors
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {
+            "name": name,
+            "elements": elements,
+            "instanced": instanced,
+            "return_names": return_names
+        }
+        if location:
+            params["location"] = location
+        if rotation:
+            params["rotation"] = rotation
+        if defaults:
+            params["defaults"] = defaults
+        if async_load:
+            params["async"] = True
+        if no_undo:
+            params["no_undo"] = True
+        response = unreal.send_command("build_structure", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"build_structure error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Prefab Tools
+# ============================================================================
+@mcp.tool()
+def capture_prefab(
+    name: str,
+    actors: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    pivot: List[float] = None,
+    save: bool = False
+) -> Dict[str, Any]:
+    """Record a set of actors as a reusable prefab template.
+
+    Captures each actor's class, mesh, material overrides, transform relative to
+    the pivot, and editable properties that differ from the class defaults.
+
+    Args:
+        name: Prefab name
+        actors: Explicit actor names; if omitted the filter fields select the actors
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max:
+            Same filter as find_actors_by_name
+        pivot: [X, Y, Z] origin of the prefab (default: XY centroid at the lowest actor)
+        save: Also write the prefab to Saved/MCPPrefabs/<name>.json
+
+    Returns:
+        members, properties (count of captured property overrides), pivot, missing names
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"name": name, "save": save}
+        if actors:
+            params["actors"] = actors
+        else:
+            params["pattern"] = pattern
+            params["match_mode"] = match_mode
+            if class_name:
+                params["class"] = class_name
+            if tags:
+                params["tags"] = tags
+            if folder:
+                params["folder"] = folder
+            if bounds_min and bounds_max:
+                params["bounds_min"] = bounds_min
+                params["bounds_max"] = bounds_max
+        if pivot:
+            params["pivot"] = pivot
+        response = unreal.send_command("capture_prefab", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"capture_prefab error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def stamp_prefab(
+    name: str,
+    transforms: List[Dict[str, Any]] = None,
+    location: List[float] = None,
+    rotation: List[float] = None,
+    name_prefix: str = "",
+    folder: str = "",
+    instanced: bool = False,
+    async_load: bool = False,
+    no_undo: bool = False
+) -> Dict[str, Any]:
+    """Place a captured prefab at one or many transforms in a single batch.
+
+    Args:
+        name: Prefab name (looked up in memory, then in Saved/MCPPrefabs)
+        transforms: List of {location, rotation, scale}; one copy per entry
+        location: Single placement when transforms is omitted
+        rotation: Single placement rotation when transforms is omitted
+        name_prefix: Actor name prefix (default: prefab name)
+        folder: Outliner folder (default: prefab name); each copy gets a subfolder
+        instanced: Place plain mesh members as HISM instances
+        async_load: Stream in unloaded assets first; returns {pending, job_id}
+        no_undo: Do not record an undo transaction (for very large generated content)
+
+    Returns:
+        stamps, members, spawned, failed, names, errors
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"name": name, "instanced": instanced}
+        if transforms:
+            params["transforms"] = transforms
+        else:
+            if location:
+                params["location"] = location
+            if rotation:
+                params["rotation"] = rotation
+        if name_prefix:
+            params["name_prefix"] = name_prefix
+        if folder:
+            params["folder"] = folder
+        if async_load:
+            params["async"] = True
+        if no_undo:
+            params["no_undo"] = True
+        response = unreal.send_command("stamp_prefab", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"stamp_prefab error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Pattern Spawn Tools
+# ============================================================================
+@mcp.tool()
+def spawn_pattern(
+    pattern: str,
+    actor: Dict[str, Any],
+    name: str = "",
+    location: List[float] = None,
+    rotation: List[float] = None,
+    options: Dict[str, Any] = None,
+    seed: int = 0,
+    spline_actor: str = "",
+    avoid: Dict[str, Any] = None,
+    instanced: bool = True,
+    return_names: bool = False,
+    async_load: bool = False,
+    no_undo: bool = False
+) -> Dict[str, Any]:
+    """Spawn one actor spec at every point of a generated pattern in a single request.
+
+    Points are generated inside Unreal, so tens of thousands of placements cost
+    one round trip instead of a Python loop of spawn calls.
+
+    Pattern options (pass in options):
+        grid:    counts [X,Y,Z], spacing [X,Y,Z], centered
+        radial:  count, radius, rings, ring_spacing, start_angle, arc (degrees),
+                 face_outward (default True), proportional (more copies on outer rings)
+        spline:  points [[X,Y,Z], ...] (local to location), closed, curved (default True),
+                 spacing or count, align (face along the curve, default True);
+                 or spline_actor to follow an existing spline component
+        scatter: size [X,Y] centered on location, min_distance, count (maximum)
+    Variation and rejection (any pattern, reproducible per seed):
+        jitter [X,Y,Z], random_yaw, random_rotation [P,Y,R], scale_range [min,max],
+        min_distance (drop points closer than this), clearance (padding around avoid bounds)
+
+    Example - a row of annex blocks like _spawn_annex_row:
+        spawn_pattern("grid", {"type": "StaticMeshActor", "static_mesh": "/Engine/BasicShapes/Cube.Cube",
+                               "scale": [3, 3, 2]},
+                      name="AnnexRow", location=[0, 2000, 100],
+                      options={"counts": [8, 1, 1], "spacing": [400, 0, 0]})
+
+    Args:
+        pattern: "grid", "radial", "spline" or "scatter"
+        actor: Spawn spec (type/blueprint_path/class, static_mesh, material(s), properties,
+               and location/rotation/scale as an offset from each point)
+        name: Name prefix and outliner folder (default: actor name or "Pattern")
+        location: [X, Y, Z] origin of the pattern
+        rotation: [Pitch, Yaw, Roll] of the pattern
+        options: Pattern, variation and rejection fields listed above
+        seed: Random seed for scatter and variation
+        spline_actor: Actor whose spline component the spline pattern follows
+        avoid: Actor filter (pattern, class, tags, folder, bounds) whose bounds reject points
+        instanced: Emit static mesh pieces as HISM instances (default True)
+        return_names: Include per-point names and instance indices in the result
+        async_load: Stream in unloaded assets first; returns {pending, job_id}
+        no_undo: Do not record an undo transaction (for very large generated content)
+
+    Returns:
+        generated, rejected, spawned, failed, errors
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = dict(options or {})
+        params.update({
+            "pattern": pattern,
+            "actor": actor,
+            "seed": seed,
+            "instanced": instanced,
+            "return_names": return_names
+        })
+        if name:
+            params["name"] = name
+        if location:
+            params["location"] = location
+        if rotation:
+            params["rotation"] = rotation
+        if spline_actor:
+            params["spline_actor"] = spline_actor
+        if avoid:
+            params["avoid"] = avoid
+        if async_load:
+            params["async"] = True
+        if no_undo:
+            params["no_undo"] = True
+        response = unreal.send_command("spawn_pattern", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"spawn_pattern error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Bulk Edit Tools
+# ============================================================================
+@mcp.tool()
+def begin_bulk_edit(timeout: float = 60.0, no_undo: bool = False) -> Dict[str, Any]:
+    """Start a bulk edit scope that spans several requests.
+
+    Until end_bulk_edit, property change notifications, PostEditMove, package
+    dirtying and viewport redraws are recorded instead of run per edit, and the
+    level viewports stop rendering in realtime. Everything is flushed once at the
+    end. Batch commands (spawn_actors, build_structure, ...) already do this
+    internally for their own work.
+
+    Args:
+        timeout: Seconds after which the scope is ended automatically (default 60)
+        no_undo: Record nothing for undo until end_bulk_edit; by default the whole
+            scope becomes a single undo step, and requests made inside it with
+            no_undo=true are rejected
+
+    The undo step stays open between requests. The first key press or mouse click
+    in the editor closes it, so the user's own edits are never recorded into it;
+    requests after that are undone one by one again. end_bulk_edit reports
+    recording_stopped when this happened.
+
+    Returns:
+        already_active (True if a scope was open; its timeout is extended)
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("begin_bulk_edit", {"timeout": timeout, "no_undo": no_undo})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"begin_bulk_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def end_bulk_edit() -> Dict[str, Any]:
+    """End the bulk edit scope started by begin_bulk_edit and flush deferred work.
+
+    Returns:
+        properties, moved, packages (notifications run by the flush), flush_ms and
+        recording_stopped (True if editor input closed the undo step early)
+    """
+    unreal = get_unreal_connection()
+    try:
+        response = unreal.send_command("end_bulk_edit", {})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"end_bulk_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# World Snapshot Tools
+# ============================================================================
+@mcp.tool()
+def snapshot_world(
+    name: str,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    save: bool = False
+) -> Dict[str, Any]:
+    """Capture the level, or the actors matching a filter, as a named snapshot.
+
+    Each actor is recorded with its class, label, folder, transform, static mesh,
+    material overrides, instanced mesh contents and non-default actor properties.
+    Snapshots are kept in memory for the editor session; save also writes a
+    binary file to Saved/MCPSnapshots that restore_world finds by name later.
+
+    Args:
+        name: Snapshot name; capturing again under the same name replaces it
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max:
+            Same filter as find_actors_by_name; without any the whole level is captured
+        save: Also write the snapshot to disk
+
+    Returns:
+        actors, bytes (binary size), capture_ms, file (when saved)
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(None, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, 0)
+        params["name"] = name
+        params["save"] = save
+        response = unreal.send_command("snapshot_world", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"snapshot_world error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def restore_world(
+    name: str,
+    delete_extra: bool = True,
+    dry_run: bool = False,
+    no_undo: bool = False,
+    force: bool = False
+) -> Dict[str, Any]:
+    """Bring the level back to a snapshot taken with snapshot_world.
+
+    Only differences are applied: missing actors are respawned under their
+    recorded names, changed actors are patched in place, and actors inside the
+    snapshot's filter that it does not contain are deleted. Actors that still
+    match the snapshot are not touched. Runs as a single undo step.
+
+    Args:
+        name: Snapshot name (in memory, or saved under Saved/MCPSnapshots)
+        delete_extra: Delete actors in the snapshot's scope that were added since
+        dry_run: Only report what would change, with the affected names
+        no_undo: Skip recording the restore for undo
+        force: Restore a snapshot taken in a different map. Without it the restore
+            (and its dry run) fails, since every actor of the current map in the
+            snapshot's scope would be deleted as extra.
+
+    Returns:
+        spawned, patched, deleted, unchanged, errors and restore_ms
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"name": name, "delete_extra": delete_extra, "dry_run": dry_run, "no_undo": no_undo}
+        if force:
+            params["force"] = True
+        response = unreal.send_command("restore_world", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"restore_world error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def diff_world(
+    snapshot: str = "",
+    saved_map: bool = False,
+    target: str = "",
+    max_entries: int = 1000
+) -> Dict[str, Any]:
+    """Report what changed in the level since a snapshot or since the map was last saved.
+
+    Actors are matched by name and compared by a per-actor hash; only actors
+    whose hash differs are compared field by field. Give exactly one of
+    snapshot or saved_map.
+
+    Args:
+        snapshot: Name of a snapshot taken with snapshot_world to compare against
+        saved_map: Compare against the map file on disk (persistent level only)
+        target: Compare against this second snapshot instead of the current level
+        max_entries: Longest list returned per category; counts are always complete
+
+    Returns:
+        counts {added, removed, moved, changed, unchanged}, added and removed names,
+        moved [{name, from, to}] where from and to are {location, rotation, scale},
+        changed [{name, fields}], truncated, capture_ms, diff_ms
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"saved_map": saved_map, "max_entries": max_entries}
+        if snapshot:
+            params["snapshot"] = snapshot
+        if target:
+            params["target"] = target
+        response = unreal.send_command("diff_world", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"diff_world error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Multi-Object Property Tools
+# ============================================================================
+@mcp.tool()
+def get_properties(
+    properties: List[str],
+    names: List[str] = None,
+    assets: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    component: str = "",
+    component_class: str = "",
+    max_elements: int = 100,
+    max_depth: int = 4,
+    packed: bool = False
+) -> Dict[str, Any]:
+    """Read several properties from many actors and assets in one request.
+
+    Targets are the actors picked by names or the find_actors_by_name filter,
+    plus any asset paths. Blueprint assets are read through their class
+    defaults. A property that does not resolve on a target leaves that cell
+    null and adds an entry to errors instead of failing the request.
+
+    Args:
+        properties: Property paths, same syntax as get_actor_property
+            (e.g. ["bHidden", "StaticMeshComponent.RelativeLocation", "Items[0].Count"])
+        names: Explicit actor names; if given the filter fields are ignored
+        assets: Asset paths to read as well (Data Assets, Blueprints, any UObject asset)
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results:
+            Same filter as find_actors_by_name
+        component: Read this component of each actor instead of the actor (row "Actor.Component");
+            actors without it are listed in missing
+        component_class: Read every component of this class on each actor instead (e.g. "PointLightComponent")
+        max_elements, max_depth: Size limits per cell, as in get_actor_property;
+            page a truncated cell with get_actor_property or get_asset_property(continuation=...)
+        packed: Packed base64 arrays, as in get_actor_property
+
+    Returns:
+        properties, types (per column; a list with one type per row when the column's type
+        differs between targets), targets (per row), values (rows x columns),
+        errors [{target, property, error}] by target name and property path, missing, count, elapsed_ms
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, max_results)
+        params["properties"] = properties
+        if assets:
+            params["assets"] = assets
+        if component:
+            params["component"] = component
+        if component_class:
+            params["component_class"] = component_class
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if packed:
+            params["packed"] = True
+        response = unreal.send_command("get_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_properties(
+    values: Dict[str, Any],
+    names: List[str] = None,
+    assets: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    component: str = "",
+    component_class: str = "",
+    no_undo: bool = False
+) -> Dict[str, Any]:
+    """Write the same property values to many actors and assets in one request.
+
+    Each value is converted once and copied to every target. Change events are
+    sent once per object and property and each package is dirtied once. Runs
+    as a single undo step. Blueprint assets are written through their class
+    defaults (without recompiling). Writes that fail on a target are listed
+    in errors; the rest still apply.
+
+    Args:
+        values: Property path to value, e.g. {"bHidden": true, "StaticMeshComponent.RelativeScale3D": [2, 2, 2]}
+        names: Explicit actor names; if given the filter fields are ignored
+        assets: Asset paths to write as well
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results:
+            Same filter as find_actors_by_name
+        component: Write this component of each actor instead of the actor
+        component_class: Write every component of this class on each actor instead
+        no_undo: Do not record an undo transaction (for very large generated content)
+
+    Returns:
+        count (targets), written (values written), objects (objects modified),
+        errors [{target, property, error}], missing, elapsed_ms
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, max_results)
+        params["values"] = values
+        if assets:
+            params["assets"] = assets
+        if component:
+            params["component"] = component
+        if component_class:
+            params["component_class"] = component_class
+        if no_undo:
+            params["no_undo"] = True
+        response = unreal.send_command("set_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def dump_overrides(
+    name: str = "",
+    blueprint_path: str = "",
+    asset_path: str = "",
+    recursive: bool = True,
+    include_components: bool = True
+) -> Dict[str, Any]:
+    """List only the properties that were customized on an actor, a Blueprint or an asset.
+
+    Give exactly one target. Actors and assets are compared with their archetype
+    (usually the class defaults); a Blueprint's class defaults are compared with
+    its parent class defaults. Only editable, non-transient properties count.
+
+    Args:
+        name: Actor name
+        blueprint_path: Blueprint asset path
+        asset_path: Data Asset or any other UObject asset path
+        recursive: Report only the differing fields of nested structs instead of the whole struct
+        include_components: Also compare actor components (or Blueprint component templates)
+
+    Returns:
+        object, archetype, overrides {property: value}, components {component: {property: value}}, count
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"recursive": recursive, "include_components": include_components}
+        if name:
+            params["name"] = name
+        if blueprint_path:
+            params["blueprint_path"] = blueprint_path
+        if asset_path:
+            params["asset_path"] = asset_path
+        response = unreal.send_command("dump_overrides", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"dump_overrides error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Component Tools
+# ============================================================================
+@mcp.tool()
+def list_components(name: str, component_class: str = "") -> Dict[str, Any]:
+    """List the components of an actor.
+
+    Args:
+        name: Name of the actor
+        component_class: Only components of this class (e.g. "StaticMeshComponent")
+
+    Returns:
+        root, components [{name, class, property, scene, parent, location, rotation,
+        scale, world_location}], count. property is the actor property that refers to
+        the component, usable in place of name; the transform fields are relative to
+        parent and only present for scene components.
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"name": name}
+        if component_class:
+            params["component_class"] = component_class
+        response = unreal.send_command("list_components", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"list_components error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_component_property(
+    path: str = "",
+    name: str = "",
+    component: str = "",
+    property: str = "",
+    max_elements: int = 500,
+    max_depth: int = 8,
+    offset: int = 0,
+    continuation: str = "",
+    packed: bool = False
+) -> Dict[str, Any]:
+    """Get a property value from one component of an actor.
+
+    Args:
+        path: "Actor.Component.Property" with an optional nested property path
+            (e.g. "Lamp.PointLightComponent0.LightColor.R"); replaces name, component and property
+        name: Name of the actor
+        component: Component object name or the actor property that refers to it
+            (e.g. "StaticMeshComponent"); see list_components
+        property: Property name or nested path on the component
+        max_elements, max_depth, offset, continuation, packed: As in get_actor_property
+    """
+    unreal = get_unreal_connection()
+    try:
+        if path:
+            params = {"path": path}
+        else:
+            params = {"name": name, "component": component, "property": property}
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if continuation:
+            params["continuation"] = continuation
+        elif offset:
+            params["offset"] = offset
+        if packed:
+            params["packed"] = True
+        response = unreal.send_command("get_component_property", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_component_property error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_component_property(
+    value: Any,
+    path: str = "",
+    name: str = "",
+    component: str = "",
+    property: str = ""
+) -> Dict[str, Any]:
+    """Set a property value on one component of an actor. Undoable.
+
+    Args:
+        value: New value, in the same JSON form get_component_property returns
+        path: "Actor.Component.Property"; replaces name, component and property
+        name: Name of the actor
+        component: Component object name or the actor property that refers to it
+        property: Property name or nested path on the component
+    """
+    unreal = get_unreal_connection()
+    try:
+        if path:
+            params = {"path": path, "value": value}
+        else:
+            params = {"name": name, "component": component, "property": property, "value": value}
+        response = unreal.send_command("set_component_property", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_component_property error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_component_transform(
+    name: str,
+    component: str,
+    location: List[float] = None,
+    rotation: List[float] = None,
+    scale: List[float] = None,
+    world: bool = False
+) -> Dict[str, Any]:
+    """Move, rotate or scale one scene component of an actor. Undoable.
+
+    Args:
+        name: Name of the actor
+        component: Component object name or the actor property that refers to it
+        location: [X, Y, Z]
+        rotation: [Pitch, Yaw, Roll] in degrees
+        scale: [X, Y, Z]
+        world: Values are in world space instead of relative to the attach parent
+
+    Returns:
+        The component as listed by list_components
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"name": name, "component": component, "world": world}
+        if location is not None:
+            params["location"] = location
+        if rotation is not None:
+            params["rotation"] = rotation
+        if scale is not None:
+            params["scale"] = scale
+        response = unreal.send_command("set_component_transform", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_component_transform error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+# ============================================================================
+# Property Watch Tools
+# ============================================================================
+@mcp.tool()
+def watch_properties(
+    properties: List[str],
+    names: List[str] = None,
+    assets: List[str] = None,
+    pattern: str = "",
+    match_mode: str = "contains",
+    class_name: str = "",
+    tags: List[str] = None,
+    folder: str = "",
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    max_results: int = 0,
+    component: str = "",
+    component_class: str = "",
+    pie: bool = False,
+    budget_ms: float = 0
+) -> Dict[str, Any]:
+    """Watch property values for changes instead of polling get_actor_property.
+
+    The editor checks every watched value once per frame, within a small time
+    budget, and remembers which ones changed. Collect them with
+    poll_property_changes; stop with unwatch_properties.
+
+    Args:
+        properties: Property paths, same syntax as get_actor_property
+        names: Explicit actor names; if given the filter fields are ignored
+        assets: Asset paths to watch as well
+        pattern, match_mode, class_name, tags, folder, bounds_min, bounds_max, max_results:
+            Same filter as find_actors_by_name
+        component, component_class: Watch components of each actor, as in get_properties
+        pie: Watch the Play in Editor copies of the actors (a session must be running);
+            their watches are reported as removed when it ends
+        budget_ms: Time the editor may spend checking watches per frame (default 0.5, max 5)
+
+    Returns:
+        watches [{id, target, property}], errors [{target, property, error}], missing,
+        count (new watches), total (all watches)
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = _actor_query_params(names, pattern, match_mode, class_name, tags, folder,
+                                     bounds_min, bounds_max, max_results)
+        params["properties"] = properties
+        if assets:
+            params["assets"] = assets
+        if component:
+            params["component"] = component
+        if component_class:
+            params["component_class"] = component_class
+        if pie:
+            params["pie"] = True
+        if budget_ms:
+            params["budget_ms"] = budget_ms
+        response = unreal.send_command("watch_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"watch_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def poll_property_changes(
+    wait_ms: int = 0,
+    max_elements: int = 100,
+    max_depth: int = 4,
+    packed: bool = False
+) -> Dict[str, Any]:
+    """Get the watched properties that changed since the last poll.
+
+    Args:
+        wait_ms: If nothing has changed yet, wait up to this long (max 5000) for a change
+            before answering; the wait does not block the editor and is skipped
+            when nothing is watched
+        max_elements, max_depth, packed: Size limits and encoding of values, as in get_actor_property
+
+    Returns:
+        changes [{id, target, property, value, changes, age_ms}] with the current value,
+        how many changes were seen and how long ago the latest was; watches whose object
+        was destroyed appear once with removed=true and are then dropped. count, watches
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {}
+        if wait_ms:
+            params["wait_ms"] = wait_ms
+        if max_elements:
+            params["max_elements"] = max_elements
+        if max_depth:
+            params["max_depth"] = max_depth
+        if packed:
+            params["packed"] = True
+        response = unreal.send_command("poll_property_changes", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"poll_property_changes error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def unwatch_properties(ids: List[int] = None, all: bool = False) -> Dict[str, Any]:
+    """Stop watching properties.
+
+    Args:
+        ids: Watch ids returned by watch_properties
+        all: Stop every watch
+
+    Returns:
+        removed, unknown (ids that were not watched), watches (remaining)
+    """
+    unreal = get_unreal_connection()
+    try:
+        params = {"all": True} if all else {"ids": ids or []}
+        response = unreal.send_command("unwatch_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"unwatch_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 # ============================================================================
 # Widget Blueprint Tools
 # ============================================================================
@@ -1267,6 +2706,7 @@ if __name__ == "__main__":
     print("    - editor_take_screenshot")
     print("    - editor_move_camera")
     print("    - find_actors_by_name")
+    print("    - get_server_stats")
     print()
     print("  Widget Blueprint Tools:")
     print("    - create_widget_blueprint")